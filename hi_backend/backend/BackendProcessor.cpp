@@ -166,6 +166,10 @@ scriptUnlocker(this)
 	if (!inUnitTestMode())
 	{
 		getAutoSaver().updateAutosaving();
+
+#if HISE_INCLUDE_SNEX && SNEX_MIR_BACKEND
+		snex::mir::MirCompiler::CodeCache::setDirectory(ProjectHandler::getAppDataDirectory(nullptr).getChildFile("SnexCodeCache"));
+#endif
 	}
 	
 	clearPreset(dontSendNotification);
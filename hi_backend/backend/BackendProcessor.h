@@ -324,6 +324,12 @@ struct ScopedAnalyser
 		milliSeconds = Time::getMillisecondCounterHiRes();
 	}
 
+	/** Returns true if the processor is analysed. The analyser buffers are not thread safe, so these processors must be rendered on the audio thread. */
+	static bool isAnalysed(MainController* mc, Processor* p)
+	{
+		return static_cast<BackendProcessor*>(mc)->getAnalyserInfoForProcessor(p) != nullptr;
+	}
+
 	~ScopedAnalyser()
 	{
 		if(buffer != nullptr)
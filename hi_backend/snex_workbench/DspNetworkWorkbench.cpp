@@ -299,7 +299,7 @@ String DspNetworkCodeProvider::createCppForNetwork() const
 
         
         
-		snex::cppgen::ValueTreeBuilder v(chain, snex::cppgen::ValueTreeBuilder::Format::JitCompiledInstance);
+		snex::cppgen::ValueTreeBuilder v(chain, snex::cppgen::ValueTreeBuilder::Format::CppDynamicLibrary);
 
 		v.setCodeProvider(new BackendDllManager::FileCodeProvider(getMainController()));
 
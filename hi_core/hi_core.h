@@ -398,6 +398,16 @@ OpenGL should be enabled by default or not.
 #define HISE_DEFAULT_OPENGL_VALUE 1
 #endif
 
+/** Config: HISE_USE_DRAW_ACTION_CACHE
+
+If enabled, the draw actions of a paint routine are hashed and compared with the previous paint call so that panels
+with an unchanged paint routine will not be repainted. Layers with post effects will also be cached as images until their
+input changes. Set this to 0 if you suspect that the cache is causing rendering glitches.
+*/
+#ifndef HISE_USE_DRAW_ACTION_CACHE
+#define HISE_USE_DRAW_ACTION_CACHE 1
+#endif
+
 /** Config: HISE_USE_SYSTEM_APP_DATA_FOLDER
 
     If enabled, the compiled plugin will use the global app data folder instead of the local one.
@@ -429,6 +439,38 @@ some weird side effects in the streaming engine).
 #define HISE_MAX_PROCESSING_BLOCKSIZE 512
 #endif
 
+/** Config: HISE_NUM_AUDIO_WORKER_THREADS
+
+The number of additional realtime threads that can be used by the audio rendering (the audio thread itself is not counted).
+If this is bigger than zero, you can enable the parallel rendering of sound generators in a container, which will distribute
+the child sound generators across the workers. The worker threads will spin for a short while after each audio callback,
+so only use this if you actually need the extra CPU power.
+*/
+#ifndef HISE_NUM_AUDIO_WORKER_THREADS
+#define HISE_NUM_AUDIO_WORKER_THREADS 0
+#endif
+
+/** The number of threads that can render audio at the same time (see RealtimeWorkerPool::NumLanes).
+
+The unit tests create their own worker pool to compare the parallel and the serial rendering, so they
+need a few lanes even if the MainController doesn't use any workers.
+*/
+#if HI_RUN_UNIT_TESTS && HISE_NUM_AUDIO_WORKER_THREADS < 3
+#define HISE_NUM_AUDIO_WORKER_LANES 4
+#else
+#define HISE_NUM_AUDIO_WORKER_LANES (HISE_NUM_AUDIO_WORKER_THREADS + 1)
+#endif
+
+/** Config: HISE_NUM_PRELOAD_THREADS
+
+The maximum number of threads that are used for loading the preload buffers of a sampler (it will never use more threads than
+there are CPU cores). Samples that are read from the same file (or monolith) are always loaded by the same thread, and every
+thread only keeps one file handle open at a time. Set this to 1 to load the samples on the sample loading thread only.
+*/
+#ifndef HISE_NUM_PRELOAD_THREADS
+#define HISE_NUM_PRELOAD_THREADS 8
+#endif
+
 /** Config: ENABLE_CPU_MEASUREMENT
 
 Set this to 0 to deactivate the CPU peak meter.
@@ -800,7 +800,11 @@ void PoolHelpers::Reference::parseReferenceString(const MainController* mc, cons
 
 bool PoolBase::DataProvider::isEmbeddedResource(PoolReference r)
 {
-	return r.isEmbeddedReference() || hashCodes.contains(r.getHashCode());
+	if (r.isEmbeddedReference())
+		return true;
+
+	DefaultElementComparator<int64> hashSorter;
+	return getEmbeddedData()->hashCodes.indexOfSorted(hashSorter, r.getHashCode()) != -1;
 }
 
 hise::PoolReference PoolBase::DataProvider::getEmbeddedReference(PoolReference other)
@@ -812,11 +816,19 @@ juce::Result PoolBase::DataProvider::restorePool(InputStream* ownedInputStream)
 {
 	pool->clearData();
 
-	input = ownedInputStream;
+	EmbeddedData::Ptr newData = new EmbeddedData();
+
+	newData->input = ownedInputStream;
+
+	auto input = newData->input.get();
+
 	int64 metadataSize = input->readInt64();
 
 	if (metadataSize == 0)
+	{
+		setEmbeddedData(newData);
 		return Result::ok();
+	}
 
 	MemoryBlock metadataBlock;
 
@@ -825,49 +837,139 @@ juce::Result PoolBase::DataProvider::restorePool(InputStream* ownedInputStream)
 	jassert((int64)metadataBlock.getSize() == metadataSize);
 
 	zstd::ZDefaultCompressor mDecomp;
-	mDecomp.expand(metadataBlock, metadata);
+	mDecomp.expand(metadataBlock, newData->metadata);
 
-	jassert(metadata.isValid());
-	jassert(metadata.getType() == Identifier("PoolData"));
+	jassert(newData->metadata.isValid());
+	jassert(newData->metadata.getType() == Identifier("PoolData"));
 
 	static const Identifier hc("HashCode");
 
-	for (const auto& item : metadata)
+	DefaultElementComparator<int64> hashSorter;
+
+	for (const auto& item : newData->metadata)
+		newData->hashCodes.addSorted(hashSorter, (int64)item.getProperty(hc));
+
+	newData->rebuildIndex();
+
+	newData->metadataOffset = input->getPosition();
+
+	newData->embeddedSize = input->getTotalLength();
+
+	// Map the pool data so that createInputStream() doesn't need to copy the chunks
+	if (auto fis = dynamic_cast<FileInputStream*>(input))
 	{
-		hashCodes.add(item.getProperty(hc));
-	}
+		newData->mappedFile = new MemoryMappedFile(fis->getFile(), MemoryMappedFile::readOnly);
 
-	metadataOffset = input->getPosition();
+		if (newData->mappedFile->getData() != nullptr && (int64)newData->mappedFile->getSize() >= newData->embeddedSize)
+		{
+			newData->data = static_cast<const uint8*>(newData->mappedFile->getData()) + newData->metadataOffset;
+			newData->dataSize = (size_t)(newData->embeddedSize - newData->metadataOffset);
+		}
+		else
+			newData->mappedFile = nullptr;
+	}
+	else if (auto mis = dynamic_cast<MemoryInputStream*>(input))
+	{
+		newData->data = static_cast<const uint8*>(mis->getData()) + newData->metadataOffset;
+		newData->dataSize = mis->getDataSize() - (size_t)newData->metadataOffset;
+	}
 
-	embeddedSize = input->getTotalLength();
+	setEmbeddedData(newData);
 
 	return Result::ok();
 }
 
-juce::MemoryInputStream* PoolBase::DataProvider::createInputStream(const String& referenceString)
+void PoolBase::DataProvider::EmbeddedData::rebuildIndex()
+{
+	static const Identifier id("ID");
+	static const Identifier cs("ChunkStart");
+	static const Identifier ce("ChunkEnd");
+
+	index.clearQuick();
+	index.ensureStorageAllocated(metadata.getNumChildren());
+
+	for (int i = 0; i < metadata.getNumChildren(); i++)
+	{
+		auto item = metadata.getChild(i);
+		index.add({ item.getProperty(id).toString().hashCode64(), (int64)item.getProperty(cs), (int64)item.getProperty(ce), i });
+	}
+
+	index.sort();
+}
+
+const PoolBase::DataProvider::IndexEntry* PoolBase::DataProvider::EmbeddedData::findEntry(const String& referenceString) const
+{
+	IndexEntry key = { referenceString.hashCode64(), 0, 0, -1 };
+
+	auto range = std::equal_range(index.begin(), index.end(), key);
+
+	// Resolve hash collisions by comparing the ID
+	for (auto e = range.first; e != range.second; ++e)
+	{
+		if (metadata.getChild(e->metadataIndex).getProperty("ID").toString() == referenceString)
+			return e;
+	}
+
+	return nullptr;
+}
+
+/** A view into the embedded data that keeps the data (and the memory mapped file) alive. */
+struct PoolBase::DataProvider::EmbeddedInputStream : public MemoryInputStream
+{
+	EmbeddedInputStream(EmbeddedData::Ptr data_, const uint8* start, size_t numBytes) :
+		MemoryInputStream(start, numBytes, false),
+		data(data_)
+	{}
+
+	EmbeddedData::Ptr data;
+};
+
+PoolBase::DataProvider::EmbeddedData::Ptr PoolBase::DataProvider::getEmbeddedData() const
+{
+	ScopedLock sl(embeddedLock);
+	return embedded;
+}
+
+void PoolBase::DataProvider::setEmbeddedData(EmbeddedData::Ptr newData)
 {
-	if (metadata.isValid())
 	{
-		auto item = metadata.getChildWithProperty("ID", referenceString);
+		ScopedLock sl(embeddedLock);
+		std::swap(embedded, newData);
+	}
+
+	// The old data will be deleted here (or by the last stream that still points into it)
+}
 
-		if (item.isValid())
+juce::MemoryInputStream* PoolBase::DataProvider::createInputStream(const String& referenceString)
+{
+	auto d = getEmbeddedData();
+
+	if (d->metadata.isValid())
+	{
+		if (auto e = d->findEntry(referenceString))
 		{
-			auto offset = (int64)item.getProperty("ChunkStart");
-			auto end = (int64)item.getProperty("ChunkEnd");
+			auto offset = e->chunkStart;
+			auto end = e->chunkEnd;
 
-			if (input != nullptr && (input->getTotalLength() > offset + metadataOffset))
+			// Return a view into the mapped data
+			if (d->data != nullptr && end <= (int64)d->dataSize)
+				return new EmbeddedInputStream(d, d->data + offset, (size_t)(end - offset));
+
+			ScopedLock sl(d->inputLock);
+
+			if (d->input != nullptr && (d->input->getTotalLength() > offset + d->metadataOffset))
 			{
-				input->setPosition(offset + metadataOffset);
+				d->input->setPosition(offset + d->metadataOffset);
 
 				MemoryBlock mb;
-				input->readIntoMemoryBlock(mb, (size_t)(end - offset));
+				d->input->readIntoMemoryBlock(mb, (size_t)(end - offset));
 
 				return new MemoryInputStream(mb, true);
 			}
 		}
 		else
 		{
-			for (auto i : metadata)
+			for (auto i : d->metadata)
 				DBG(i.getProperty("ID").toString());
 		}
 
@@ -887,7 +989,10 @@ juce::Result PoolBase::DataProvider::writePool(OutputStream* ownedOutputStream,
 	
 	MemoryOutputStream dataOutputStream;
 
-	metadata = ValueTree("PoolData");
+	// The new metadata is only swapped in after the pool was written successfully
+	EmbeddedData::Ptr newData = new EmbeddedData();
+
+	newData->metadata = ValueTree("PoolData");
 
 	for (int i = 0; i < pool->getNumLoadedFiles(); i++)
 	{
@@ -923,18 +1028,17 @@ juce::Result PoolBase::DataProvider::writePool(OutputStream* ownedOutputStream,
 		dataOutputStream.write(itemData.getData(), itemData.getDataSize());
 		child.setProperty("ChunkEnd", dataOutputStream.getPosition(), nullptr);
 
-		metadata.addChild(child, -1, nullptr);
+		newData->metadata.addChild(child, -1, nullptr);
 	}
 
 	if (Thread::currentThreadShouldExit())
 		return Result::fail("Aborted");
 
-
 	MemoryBlock compressedMetadata;
 
 	zstd::ZDefaultCompressor mComp;
 
-	auto result = mComp.compress(metadata, compressedMetadata);
+	auto result = mComp.compress(newData->metadata, compressedMetadata);
 
 	if (result.failed())
 	{
@@ -957,15 +1061,24 @@ juce::Result PoolBase::DataProvider::writePool(OutputStream* ownedOutputStream,
 
 	output->flush();
 
+	// The written chunks aren't backed by any data, so the hash codes stay empty and
+	// createInputStream() won't return anything until the pool is restored.
+	newData->rebuildIndex();
+	newData->embeddedSize = sizeof(int64) + metadataOutputStream.getDataSize() + dataOutputStream.getDataSize();
+
+	setEmbeddedData(newData);
+
 	return Result::ok();
 }
 
 var PoolBase::DataProvider::createAdditionalData(PoolReference r)
 {
-	auto item = metadata.getChildWithProperty("ID", r.getReferenceString());
+	auto d = getEmbeddedData();
 
-	if (item.isValid())
+	if (auto e = d->findEntry(r.getReferenceString()))
 	{
+		auto item = d->metadata.getChild(e->metadataIndex);
+
 		var data = ValueTreeConverters::convertValueTreeToDynamicObject(item);
 		
 		if (auto obj = data.getDynamicObject())
@@ -984,7 +1097,7 @@ Array<hise::PoolReference> PoolBase::DataProvider::getListOfAllEmbeddedReference
 {
 	Array<PoolReference> references;
 
-	for (const auto& c : metadata)
+	for (const auto& c : getEmbeddedData()->metadata)
 	{
 		auto rString = c.getProperty("ID").toString();
 
@@ -1012,7 +1125,7 @@ PoolBase::DataProvider::Compressor::~Compressor()
 
 PoolBase::DataProvider::DataProvider(PoolBase* pool_):
 	pool(pool_),
-	metadataOffset(-1),
+	embedded(new EmbeddedData()),
 	compressor(new Compressor())
 {}
 
@@ -1026,7 +1139,7 @@ void PoolBase::DataProvider::setCompressor(Compressor* newCompressor)
 { compressor = newCompressor; }
 
 size_t PoolBase::DataProvider::getSizeOfEmbeddedReferences() const
-{ return embeddedSize; }
+{ return getEmbeddedData()->embeddedSize; }
 
 PoolBase::Listener::~Listener()
 {}
@@ -377,13 +377,60 @@ public:
         
     private:
         
-        ValueTree metadata;
-        int64 metadataOffset;
+        /** A lookup entry for a pool item, sorted by the hash of its reference string. */
+        struct IndexEntry
+        {
+            bool operator<(const IndexEntry& other) const { return hash < other.hash; }
+            
+            int64 hash;
+            int64 chunkStart;
+            int64 chunkEnd;
+            int metadataIndex;
+        };
+        
+        /** The metadata, the lookup tables and the data backing of the embedded resources.
+        
+            It is rebuilt as a whole by restorePool() and writePool() and swapped in one step
+            so that the lookup never mixes an old index with new metadata. The input streams
+            returned by createInputStream() hold a reference to it, which keeps the mapped
+            region alive until the last stream is deleted.
+        */
+        struct EmbeddedData : public ReferenceCountedObject
+        {
+            using Ptr = ReferenceCountedObjectPtr<EmbeddedData>;
+            
+            /** Rebuilds the sorted lookup tables from the metadata. */
+            void rebuildIndex();
+            
+            /** Returns the index entry for the given reference string or nullptr if it isn't embedded. */
+            const IndexEntry* findEntry(const String& referenceString) const;
+            
+            ValueTree metadata;
+            int64 metadataOffset = -1;
+            
+            ScopedPointer<InputStream> input;
+            CriticalSection inputLock;
+            
+            Array<int64> hashCodes;
+            Array<IndexEntry> index;
+            size_t embeddedSize = 0;
+            
+            /** If the pool was restored from a file, it will be memory mapped so that the input
+                streams can point directly into the mapped region. */
+            ScopedPointer<MemoryMappedFile> mappedFile;
+            const uint8* data = nullptr;
+            size_t dataSize = 0;
+        };
+        
+        struct EmbeddedInputStream;
+        
+        EmbeddedData::Ptr getEmbeddedData() const;
+        void setEmbeddedData(EmbeddedData::Ptr newData);
         
         PoolBase* pool = nullptr;
-        ScopedPointer<InputStream> input;
-        Array<int64> hashCodes;
-        size_t embeddedSize = 0;
+        
+        CriticalSection embeddedLock;
+        EmbeddedData::Ptr embedded;
         
         ScopedPointer<Compressor> compressor;
     };
@@ -671,6 +671,12 @@ void MainController::KillStateHandler::addThreadIdToAudioThreadList()
 	audioThreads.insert(threadId);
 }
 
+void MainController::KillStateHandler::addThreadIdToAudioThreadList(void* threadId)
+{
+	jassert(threadId != nullptr);
+	audioThreads.insert(threadId);
+}
+
 void MainController::KillStateHandler::removeThreadIdFromAudioThreadList()
 {
 	if (MessageManager::getInstance()->isThisTheMessageThread())
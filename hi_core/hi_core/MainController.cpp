@@ -161,8 +161,31 @@ bool MainController::unitTestMode = false;
 
 	javascriptThreadPool->startThread(8);
 	getKillStateHandler().setScriptingThreadId(javascriptThreadPool->getThreadId());
+
+#if HISE_NUM_AUDIO_WORKER_THREADS > 0
+	realtimeWorkerPool = new RealtimeWorkerPool(HISE_NUM_AUDIO_WORKER_THREADS);
+
+	for (int i = 0; i < realtimeWorkerPool->getNumWorkers(); i++)
+		getKillStateHandler().addThreadIdToAudioThreadList(realtimeWorkerPool->getWorkerThreadId(i));
+#endif
 };
 
+#if HI_RUN_UNIT_TESTS
+void MainController::createRealtimeWorkerPoolForUnitTests(int numWorkers)
+{
+	if (realtimeWorkerPool != nullptr)
+		return;
+
+	// The workers need their own lanes...
+	jassert(numWorkers < RealtimeWorkerPool::NumLanes);
+
+	realtimeWorkerPool = new RealtimeWorkerPool(jmin(numWorkers, RealtimeWorkerPool::NumLanes - 1));
+
+	for (int i = 0; i < realtimeWorkerPool->getNumWorkers(); i++)
+		getKillStateHandler().addThreadIdToAudioThreadList(realtimeWorkerPool->getWorkerThreadId(i));
+}
+#endif
+
 
 MainController::~MainController()
 {
@@ -182,6 +205,7 @@ MainController::~MainController()
 
 	sampleManager = nullptr;
 	javascriptThreadPool = nullptr;
+	realtimeWorkerPool = nullptr;
 }
 
 
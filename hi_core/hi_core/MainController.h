@@ -190,6 +190,12 @@ public:
 		/** returns a pointer to the thread pool that streams the samples from disk. */
 		SampleThreadPool *getGlobalSampleThreadPool() { return samplerLoaderThreadPool; }
 
+		/** Returns the thread pool that preloads the samples in parallel (see HISE_NUM_PRELOAD_THREADS). 
+		
+			This is created when it's used for the first time and must only be used by the sample loading thread.
+		*/
+		ThreadPool& getPreloadThreadPool();
+
 		/** returns a pointer to the global sample pool */
 		ModulatorSamplerSoundPool *getModulatorSamplerSoundPool2() const;
 
@@ -271,6 +277,12 @@ public:
 			nonRealtime = shouldBeNonRealtime;
 		}
 
+		/** Sets the streaming buffer size that the samplers use in non-realtime mode. If this is zero, 
+		    the normal streaming buffers are used. */
+		void setDirectStreamingBufferSize(int numSamples) { directStreamingBufferSize = numSamples; }
+
+		int getDirectStreamingBufferSize() const noexcept { return directStreamingBufferSize; }
+
 		String getPreloadMessage() const
 		{
 			return currentPreloadMessage;
@@ -280,6 +292,7 @@ public:
 
 		bool nonRealtime = false;
 		bool internalsSetToNonRealtime = false;
+		int directStreamingBufferSize = 0;
 
 		String currentPreloadMessage;
 
@@ -357,6 +370,7 @@ public:
 		ValueTree sampleMaps;
 
 		ScopedPointer<SampleThreadPool> samplerLoaderThreadPool;
+		ScopedPointer<ThreadPool> preloadThreadPool;
 
 		bool hddMode = false;
 		bool skipPreloading = false;
@@ -1312,6 +1326,9 @@ public:
 
 		void addThreadIdToAudioThreadList();
 
+		/** Registers a thread that is not the audio callback thread but renders audio on its behalf (eg. a realtime worker). */
+		void addThreadIdToAudioThreadList(void* threadId);
+
 		void removeThreadIdFromAudioThreadList();
 
 		bool test() const noexcept override;
@@ -1509,6 +1526,25 @@ public:
 	JavascriptThreadPool& getJavascriptThreadPool() noexcept { return *javascriptThreadPool.get(); }
 	const JavascriptThreadPool& getJavascriptThreadPool() const noexcept { return *javascriptThreadPool.get(); }
 
+	/** Returns the pool of realtime workers that can be used by the audio rendering. This will be nullptr if HISE_NUM_AUDIO_WORKER_THREADS is zero. */
+	RealtimeWorkerPool* getRealtimeWorkerPool() noexcept { return realtimeWorkerPool.get(); }
+
+#if HI_RUN_UNIT_TESTS
+	/** Creates a worker pool with the given amount of threads (if there is none yet). 
+	
+		The unit tests use this to compare the parallel rendering against the serial rendering in builds without
+		realtime workers. Call this before you add any processors, because some of them fetch the pool on creation.
+	*/
+	void createRealtimeWorkerPoolForUnitTests(int numWorkers);
+#endif
+
+	/** Returns a counter that is incremented whenever a processor is added, removed or bypassed (or changes a property that
+		affects the parallel rendering). This can be used to invalidate cached properties of the module tree. */
+	uint32 getModuleTreeRevision() const noexcept { return moduleTreeRevision.load(); }
+
+	/** Increments the module tree revision. This is lockfree and can be called from any thread. */
+	void bumpModuleTreeRevision() noexcept { moduleTreeRevision++; }
+
 	PooledUIUpdater* getGlobalUIUpdater() { return &globalUIUpdater; }
 	const PooledUIUpdater* getGlobalUIUpdater() const { return &globalUIUpdater; }
 
@@ -2153,6 +2189,10 @@ private:
 
 	ScopedPointer<JavascriptThreadPool> javascriptThreadPool;
 
+	ScopedPointer<RealtimeWorkerPool> realtimeWorkerPool;
+
+	std::atomic<uint32> moduleTreeRevision = { 0 };
+
 	friend class UserPresetHandler;
     friend class PresetLoadingThread;
 	friend class DelayedRenderer;
@@ -1615,8 +1615,7 @@ bool AudioRendererBase::renderAudio()
 
 	getMainController()->getKillStateHandler().setCurrentExportThread(getCurrentThreadId());
 	
-	dynamic_cast<AudioProcessor*>(getMainController())->setNonRealtime(true);
-	getMainController()->getSampleManager().handleNonRealtimeState();
+	ScopedOfflineState offlineState(*this);
 
 	if(sendArtificialTransportMessages)
 		getMainController()->sendArtificialTransportMessage(true);
@@ -1655,9 +1654,14 @@ bool AudioRendererBase::renderAudio()
 
 			auto& bufferToUse = numThrowAway > 0 ? nirvana : ab;
 
+			auto blockStart = Time::getHighResolutionTicks();
+
 			// call this directly to avoid messing with the logic that copes with
 			// weird buffer lenghts (this is not multithread-safe like the internal audio rendering)...
 			getMainController()->processBlockCommon(bufferToUse, mb);
+
+			if (numThrowAway == 0)
+				blockRendered(numThisTime, Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - blockStart));
 			
 			if (numThrowAway > 0)
 			{
@@ -1679,7 +1683,9 @@ bool AudioRendererBase::renderAudio()
 				auto p = (double)numTodo / (double)numSamplesToRender;
 				callUpdateCallback(false, 1.0 - p);
 				startTime = now;
-				Thread::wait(skipCallbacks ? 60 : 5);
+
+				if (throttleRendering)
+					Thread::wait(skipCallbacks ? 60 : 5);
 			}
 		}
 
@@ -1700,12 +1706,54 @@ bool AudioRendererBase::renderAudio()
 	if(sendArtificialTransportMessages)
 		getMainController()->sendArtificialTransportMessage(false);
 
-	getMainController()->getKillStateHandler().setCurrentExportThread(nullptr);
-	dynamic_cast<AudioProcessor*>(getMainController())->setNonRealtime(false);
-	getMainController()->getSampleManager().handleNonRealtimeState();
 	return true;
 }
 
+AudioRendererBase::ScopedOfflineState::ScopedOfflineState(AudioRendererBase& parent_):
+	parent(parent_)
+{
+	auto mc = parent.getMainController();
+
+	mc->getSampleManager().setDirectStreamingBufferSize(parent.directStreamingBufferSize);
+
+	dynamic_cast<AudioProcessor*>(mc)->setNonRealtime(true);
+	mc->getSampleManager().handleNonRealtimeState();
+
+	if (parent.renderInParallel && mc->getRealtimeWorkerPool() != nullptr)
+	{
+		Processor::Iterator<ModulatorSynthChain> iter(mc->getMainSynthChain());
+
+		while (auto c = iter.getNextProcessor())
+		{
+			if (!c->isUsingParallelRendering())
+			{
+				c->setUseParallelRendering(true);
+				parallelChains.add(c);
+			}
+		}
+
+		// The flags are usually updated by a timer on the message thread, which
+		// might be blocked during the export, so we update them here once.
+		mc->getMainSynthChain()->updateParallelRenderingFlags();
+	}
+}
+
+AudioRendererBase::ScopedOfflineState::~ScopedOfflineState()
+{
+	auto mc = parent.getMainController();
+
+	for (auto c : parallelChains)
+	{
+		if (auto sc = dynamic_cast<ModulatorSynthChain*>(c.get()))
+			sc->setUseParallelRendering(false);
+	}
+
+	mc->getKillStateHandler().setCurrentExportThread(nullptr);
+	dynamic_cast<AudioProcessor*>(mc)->setNonRealtime(false);
+	mc->getSampleManager().handleNonRealtimeState();
+	mc->getSampleManager().setDirectStreamingBufferSize(0);
+}
+
 AudioSampleBuffer AudioRendererBase::getChunk(int startSample, int numSamples)
 {
 	for (int i = 0; i < numChannelsToRender; i++)
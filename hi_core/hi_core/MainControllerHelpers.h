@@ -804,6 +804,10 @@ protected:
 
 	virtual void callUpdateCallback(bool isFinished, double progress) = 0;
 
+	/** Called on the export thread after each block that ends up in the output (the warm-up
+	    blocks are skipped) with the time it took to render it. Override this for measurements. */
+	virtual void blockRendered(int /*numSamples*/, double /*renderSeconds*/) {}
+
 	/** Call this after creating the Event buffer content and it will prepare all internal buffers. */
 	void initAfterFillingEventBuffer();
 
@@ -813,8 +817,30 @@ protected:
     bool skipCallbacks = true;
 	bool sendArtificialTransportMessages = false;
 
+	/** If true, the export thread pauses after each progress callback so that the UI can catch up.
+	    Disable this if you want to measure the rendering time. */
+	bool throttleRendering = true;
+
+	/** If true, the child sound generators of all containers are rendered on the realtime worker pool
+	    during the export (this requires HISE_NUM_AUDIO_WORKER_THREADS to be bigger than zero). */
+	bool renderInParallel = false;
+
+	/** If this is bigger than zero, the samplers read the samples directly in the rendering thread with
+	    streaming buffers of this size instead of the default streaming buffer size. */
+	int directStreamingBufferSize = 0;
+
 private:
 
+	/** Switches the main controller to the offline rendering state and restores it when it goes out of scope. */
+	struct ScopedOfflineState
+	{
+		ScopedOfflineState(AudioRendererBase& parent_);
+		~ScopedOfflineState();
+
+		AudioRendererBase& parent;
+		Array<WeakReference<Processor>> parallelChains;
+	};
+
 	static constexpr int NumThrowAwayBuffers = 12;
 
 	int thisNumThrowAway = 0;
@@ -556,15 +556,112 @@ void MouseCallbackComponent::sendToListeners(var clickInformation)
 	}
 }
 
+DrawActions::HashBuilder::HashBuilder(const dispatch::HashedCharPtr& actionId):
+	h(14695981039346656037ULL)
+{
+	*this << actionId.hash();
+}
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(int64 v)
+{
+	h = (h ^ (uint64)v) * 1099511628211ULL;
+	return *this;
+}
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(int v)
+{ return *this << (int64)v; }
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(float v)
+{
+	uint32 bits;
+	memcpy(&bits, &v, sizeof(float));
+	return *this << (int64)bits;
+}
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(bool v)
+{ return *this << (int64)(v ? 1 : 0); }
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(const String& s)
+{ return *this << s.hashCode64(); }
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(Colour c)
+{ return *this << (int64)c.getARGB(); }
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(Rectangle<float> r)
+{ return *this << r.getX() << r.getY() << r.getWidth() << r.getHeight(); }
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(Rectangle<int> r)
+{ return *this << r.getX() << r.getY() << r.getWidth() << r.getHeight(); }
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(const Path& p)
+{
+	*this << p.isUsingNonZeroWinding();
+
+	Path::Iterator it(p);
+
+	while (it.next())
+	{
+		*this << (int)it.elementType;
+
+		switch (it.elementType)
+		{
+		case Path::Iterator::cubicTo:	*this << it.x3 << it.y3; // fall through
+		case Path::Iterator::quadraticTo: *this << it.x2 << it.y2; // fall through
+		case Path::Iterator::startNewSubPath:
+		case Path::Iterator::lineTo:	*this << it.x1 << it.y1; break;
+		case Path::Iterator::closePath: break;
+		}
+	}
+
+	return *this;
+}
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(const AffineTransform& t)
+{ return *this << t.mat00 << t.mat01 << t.mat02 << t.mat10 << t.mat11 << t.mat12; }
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(const Font& f)
+{
+	return *this << f.getTypefaceName() << f.getTypefaceStyle() << f.getHeight() 
+				 << f.getExtraKerningFactor() << f.getHorizontalScale() << f.isUnderlined();
+}
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(const ColourGradient& g)
+{
+	*this << g.point1.getX() << g.point1.getY() << g.point2.getX() << g.point2.getY() << g.isRadial;
+
+	for (int i = 0; i < g.getNumColours(); i++)
+		*this << g.getColour(i) << (float)g.getColourPosition(i);
+
+	return *this;
+}
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(const PathStrokeType& s)
+{ return *this << s.getStrokeThickness() << (int)s.getJointStyle() << (int)s.getEndStyle(); }
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(Justification j)
+{ return *this << j.getFlags(); }
+
+DrawActions::HashBuilder& DrawActions::HashBuilder::operator<<(const Image& img)
+{ return *this << (int64)(pointer_sized_int)img.getPixelData() << img.getBounds(); }
+
+int64 DrawActions::HashBuilder::get() const
+{ return h != 0 ? (int64)h : 1; }
+
 bool DrawActions::PostActionBase::needsStackData() const
 { return false; }
 
+int64 DrawActions::PostActionBase::getHashCode() const
+{ return 0; }
+
 DrawActions::ActionBase::ActionBase()
 {}
 
 DrawActions::ActionBase::~ActionBase()
 {}
 
+int64 DrawActions::ActionBase::getHashCode() const
+{ return 0; }
+
 bool DrawActions::ActionBase::wantsCachedImage() const
 { return false; }
 
@@ -649,6 +746,35 @@ void DrawActions::ActionLayer::perform(Graphics& g)
 	}
 }
 
+int64 DrawActions::ActionLayer::getHashCode() const
+{
+	HashBuilder b(getDispatchId());
+
+	b << drawOnParent;
+
+	for (auto a : internalActions)
+	{
+		auto h = a->getHashCode();
+
+		if (h == 0)
+			return 0;
+
+		b << h;
+	}
+
+	for (auto p : postActions)
+	{
+		auto h = p->getHashCode();
+
+		if (h == 0)
+			return 0;
+
+		b << h;
+	}
+
+	return b.get();
+}
+
 void DrawActions::ActionLayer::addDrawAction(ActionBase* a)
 {
 	internalActions.add(a);
@@ -670,6 +796,18 @@ DrawActions::BlendingLayer::BlendingLayer(gin::BlendMode m, float alpha_):
 bool DrawActions::BlendingLayer::wantsCachedImage() const
 { return true; }
 
+int64 DrawActions::BlendingLayer::getHashCode() const
+{
+	auto h = ActionLayer::getHashCode();
+
+	if (h == 0)
+		return 0;
+
+	HashBuilder b(getDispatchId());
+	b << h << (int)blendMode << alpha;
+	return b.get();
+}
+
 void DrawActions::NoiseMapManager::drawNoiseMap(Graphics& g, Rectangle<int> area, float alpha, bool monochrom,
 	float scale)
 {
@@ -798,14 +936,37 @@ void DrawActions::Handler::addDrawAction(ActionBase* newDrawAction)
 
 void DrawActions::Handler::flush(uint64_t perfettoTrackId)
 {
+	int64 newHash = 0;
+
+#if HISE_USE_DRAW_ACTION_CACHE
+	newHash = getHashCode(currentActions);
+#endif
+
+	statistics.numFlushes++;
+
+	bool unchanged = false;
+
 	{
 		SpinLock::ScopedLockType sl(lock);
 
-		nextActions.swapWith(currentActions);
+		// If the paint routine created the exact same actions as the last time,
+		// we keep the old actions and don't bother the listeners at all
+		unchanged = newHash != 0 && newHash == lastHash;
+
+		if (!unchanged)
+			nextActions.swapWith(currentActions);
+
+		lastHash = newHash;
 		currentActions.clear();
 		layerStack.clear();
 	}
 
+	if (unchanged)
+	{
+		statistics.numSkippedFlushes++;
+		return;
+	}
+
 	if(perfettoTrackId != 0)
 		flowManager.continueFlow(perfettoTrackId, "flush draw handler");
 
@@ -840,6 +1001,73 @@ float DrawActions::Handler::getScaleFactor() const
 DrawActions::NoiseMapManager* DrawActions::Handler::getNoiseMapManager()
 { return &noiseManager.getObject(); }
 
+Image DrawActions::Handler::getCachedRaster(int64 key)
+{
+	SpinLock::ScopedLockType sl(rasterLock);
+
+	for (auto& r : rasterCache)
+	{
+		if (r.key == key)
+		{
+			r.used = true;
+			statistics.numRasterCacheHits++;
+			return r.img;
+		}
+	}
+
+	statistics.numRasterCacheMisses++;
+	return {};
+}
+
+void DrawActions::Handler::setCachedRaster(int64 key, const Image& img)
+{
+	SpinLock::ScopedLockType sl(rasterLock);
+	rasterCache.add({ key, img, true });
+}
+
+int64 DrawActions::Handler::getHashCode(const ReferenceCountedArray<ActionBase>& actions)
+{
+	HashBuilder b("paint");
+
+	for (auto a : actions)
+	{
+		auto h = a->getHashCode();
+
+		if (h == 0)
+			return 0;
+
+		b << h;
+	}
+
+	return b.get();
+}
+
+void DrawActions::Handler::purgeUnusedRasters()
+{
+	SpinLock::ScopedLockType sl(rasterLock);
+
+	for (int i = 0; i < rasterCache.size(); i++)
+	{
+		if (!rasterCache.getReference(i).used)
+			rasterCache.remove(i--);
+		else
+			rasterCache.getReference(i).used = false;
+	}
+}
+
+var DrawActions::Handler::Statistics::toJSON() const
+{
+	auto obj = new DynamicObject();
+
+	obj->setProperty("NumPaintCalls", numFlushes.load());
+	obj->setProperty("NumSkippedRepaints", numSkippedFlushes.load());
+	obj->setProperty("NumRenders", numRenders.load());
+	obj->setProperty("NumCacheHits", numRasterCacheHits.load());
+	obj->setProperty("NumCacheMisses", numRasterCacheMisses.load());
+
+	return var(obj);
+}
+
 void DrawActions::Handler::handleAsyncUpdate()
 {
 	auto x = flowManager.flushAllButLastOne("flush draw handler", {});
@@ -1424,6 +1652,8 @@ void DrawActions::Handler::Iterator::render(Graphics& g, Component* c)
 	if (handler->recursion)
 		return;
 
+	handler->statistics.numRenders++;
+
 	UnblurryGraphics ug(g, *c);
 
 	auto sf = ug.getTotalScaleFactor();
@@ -1471,6 +1701,35 @@ void DrawActions::Handler::Iterator::render(Graphics& g, Component* c)
 
 			if (action->wantsCachedImage())
 			{
+				int64 rasterKey = 0;
+
+#if HISE_USE_DRAW_ACTION_CACHE
+				// A layer that doesn't draw on its parent will always create the same image
+				// from the same actions so we can skip the (expensive) post effects
+				if (auto layer = dynamic_cast<ActionLayer*>(action.get()))
+				{
+					auto layerHash = !layer->wantsToDrawOnParent() ? layer->getHashCode() : 0;
+
+					if (layerHash != 0)
+					{
+						HashBuilder b("layerRaster");
+						b << layerHash << cachedImg.getBounds() << (float)sf;
+						rasterKey = b.get();
+					}
+				}
+
+				if (rasterKey != 0)
+				{
+					auto cachedLayer = handler->getCachedRaster(rasterKey);
+
+					if (cachedLayer.isValid())
+					{
+						g2.drawImageAt(cachedLayer, 0, 0);
+						continue;
+					}
+				}
+#endif
+
 				Image actionImage;
 
 				if (action->wantsToDrawOnParent())
@@ -1490,6 +1749,9 @@ void DrawActions::Handler::Iterator::render(Graphics& g, Component* c)
                 {
                     g2.drawImageAt(actionImage, 0, 0);
                 }
+
+				if (rasterKey != 0)
+					handler->setCachedRaster(rasterKey, actionImage);
 					//GraphicHelpers::quickDraw(cachedImg, actionImage);
 			}
 			else
@@ -1512,6 +1774,8 @@ void DrawActions::Handler::Iterator::render(Graphics& g, Component* c)
 		}
 			
 	}
+
+	handler->purgeUnusedRasters();
 }
 
 DrawActions::NoiseMapManager::NoiseMap::NoiseMap(Rectangle<int> a, bool monochrom_) :
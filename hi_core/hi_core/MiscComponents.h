@@ -299,12 +299,50 @@ private:
 
 struct DrawActions
 {
+	/** A small helper class that creates a hash from the parameters of a draw action.
+	
+		This is used to compare the draw actions of two paint calls so that unchanged panels
+		do not need to be repainted.
+	*/
+	struct HashBuilder
+	{
+		HashBuilder(const dispatch::HashedCharPtr& actionId);
+
+		HashBuilder& operator<<(int64 v);
+		HashBuilder& operator<<(int v);
+		HashBuilder& operator<<(float v);
+		HashBuilder& operator<<(bool v);
+		HashBuilder& operator<<(const String& s);
+		HashBuilder& operator<<(Colour c);
+		HashBuilder& operator<<(Rectangle<float> r);
+		HashBuilder& operator<<(Rectangle<int> r);
+		HashBuilder& operator<<(const Path& p);
+		HashBuilder& operator<<(const AffineTransform& t);
+		HashBuilder& operator<<(const Font& f);
+		HashBuilder& operator<<(const ColourGradient& g);
+		HashBuilder& operator<<(const PathStrokeType& s);
+		HashBuilder& operator<<(Justification j);
+
+		/** Adds the pixel data pointer of the image. This assumes that images are not modified after they were passed into a draw action. */
+		HashBuilder& operator<<(const Image& img);
+
+		/** Returns the hash value. This will never be zero (which is used to indicate a action that can't be hashed). */
+		int64 get() const;
+
+	private:
+
+		uint64 h;
+	};
+
 	class PostActionBase : public ReferenceCountedObject
 	{
 	public:
 
 		virtual void perform(PostGraphicsRenderer& r) = 0;
 		virtual bool needsStackData() const;
+
+		/** Returns a hash of the parameters or 0 if the post action can't be hashed. */
+		virtual int64 getHashCode() const;
 	};
 
 	class ActionBase: public ReferenceCountedObject
@@ -321,6 +359,13 @@ struct DrawActions
 
 		virtual dispatch::HashedCharPtr getDispatchId() const = 0;
 
+		/** Returns a hash of all parameters that affect the rendering of this action.
+		
+			If the output of the action might change without its parameters being changed (eg. a shader or a spectrum image), 
+			return 0, which will disable the repaint diffing for the entire paint call.
+		*/
+		virtual int64 getHashCode() const;
+
 		virtual void setCachedImage(Image& actionImage_, Image& mainImage_);
 		virtual void setScaleFactor(float sf);
 
@@ -372,6 +417,8 @@ struct DrawActions
 
 		void perform(Graphics& g);
 
+		int64 getHashCode() const override;
+
 		void addDrawAction(ActionBase* a);
 
 		void addPostAction(PostActionBase* a);
@@ -397,6 +444,8 @@ struct DrawActions
 
 		void perform(Graphics& g) override;
 
+		int64 getHashCode() const override;
+
 		float alpha;
 		
 		Image blendSource;
@@ -459,6 +508,18 @@ struct DrawActions
 			JUCE_DECLARE_WEAK_REFERENCEABLE(Listener);
 		};
 
+		/** Some counters that can be used to check how effective the repaint diffing and the raster cache is. */
+		struct Statistics
+		{
+			var toJSON() const;
+
+			std::atomic<int> numFlushes = { 0 };
+			std::atomic<int> numSkippedFlushes = { 0 };
+			std::atomic<int> numRenders = { 0 };
+			std::atomic<int> numRasterCacheHits = { 0 };
+			std::atomic<int> numRasterCacheMisses = { 0 };
+		};
+
         ~Handler();
 
 		void beginDrawing();
@@ -493,8 +554,34 @@ struct DrawActions
 
 		NoiseMapManager* getNoiseMapManager();
 
+		/** Returns an image that was rendered with the given key or an invalid image if it isn't cached. */
+		Image getCachedRaster(int64 key);
+
+		/** Stores an image in the raster cache. The image will be kept until a render call doesn't use it anymore. */
+		void setCachedRaster(int64 key, const Image& img);
+
+		const Statistics& getStatistics() const { return statistics; }
+
 	private:
 
+		struct CachedRaster
+		{
+			int64 key;
+			Image img;
+			bool used;
+		};
+
+		static int64 getHashCode(const ReferenceCountedArray<ActionBase>& actions);
+
+		void purgeUnusedRasters();
+
+		Statistics statistics;
+
+		int64 lastHash = 0;
+
+		SpinLock rasterLock;
+		Array<CachedRaster> rasterCache;
+
 		dispatch::AccumulatedFlowManager flowManager;
 
 		SharedResourcePointer<NoiseMapManager> noiseManager;
@@ -0,0 +1,183 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+namespace hise {
+using namespace juce;
+
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+thread_local int RealtimeWorkerPool::currentLane = 0;
+#endif
+
+RealtimeWorkerPool::RealtimeWorkerPool(int numWorkers, int threadPriority)
+{
+	for (int i = 0; i < numWorkers; i++)
+	{
+		auto w = workers.add(new Worker(*this, i));
+		w->startThread(threadPriority);
+	}
+}
+
+RealtimeWorkerPool::~RealtimeWorkerPool()
+{
+	jassert(currentBatch.load() == nullptr);
+
+	for (auto w : workers)
+		w->signalThreadShouldExit();
+
+	for (auto w : workers)
+		w->stopThread(1000);
+
+	workers.clear();
+}
+
+void RealtimeWorkerPool::run(int numTasks, TaskFunction f, void* context)
+{
+	if (numTasks <= 0)
+		return;
+
+	Batch b;
+	b.f = f;
+	b.context = context;
+	b.numTasks = numTasks;
+
+	Batch* expected = nullptr;
+
+	if (numTasks == 1 || workers.isEmpty() || !currentBatch.compare_exchange_strong(expected, &b))
+	{
+		// Either there's nothing to distribute or another batch is running, so we'll do it ourself...
+		for (int i = 0; i < numTasks; i++)
+			f(context, i);
+
+		return;
+	}
+
+	lastBatchTime.store(Time::getMillisecondCounter());
+
+	processTasks(b);
+
+	while (b.numFinished.load() < numTasks)
+		_mm_pause();
+
+	currentBatch.store(nullptr);
+
+	// A worker might have picked up the pointer but not started processing yet.
+	// We need to wait until it has left the batch before the batch goes out of scope.
+	while (numWorkersInBatch.load() != 0)
+		_mm_pause();
+}
+
+juce::Thread::ThreadID RealtimeWorkerPool::getWorkerThreadId(int index) const
+{
+	if (auto w = workers[index])
+		return w->getThreadId();
+
+	return nullptr;
+}
+
+void RealtimeWorkerPool::processTasks(Batch& b)
+{
+	for (;;)
+	{
+		auto taskIndex = b.nextTask.fetch_add(1);
+
+		if (taskIndex >= b.numTasks)
+			return;
+
+		b.f(b.context, taskIndex);
+		b.numFinished.fetch_add(1);
+	}
+}
+
+bool RealtimeWorkerPool::processCurrentBatch()
+{
+	if (currentBatch.load() == nullptr)
+		return false;
+
+	numWorkersInBatch.fetch_add(1);
+
+	auto b = currentBatch.load();
+
+	if (b != nullptr)
+		processTasks(*b);
+
+	numWorkersInBatch.fetch_sub(1);
+
+	return b != nullptr;
+}
+
+RealtimeWorkerPool::Worker::Worker(RealtimeWorkerPool& parent_, int index_) :
+	Thread("Realtime Worker " + String(index_ + 1)),
+	parent(parent_),
+	index(index_)
+{
+	// The pool must not have more workers than lanes...
+	jassert(index < NumLanes - 1);
+}
+
+void RealtimeWorkerPool::Worker::run()
+{
+	// The time the workers keep spinning after the last batch. This should be
+	// longer than the time between two audio callbacks.
+	static constexpr uint32 SpinTimeoutMilliseconds = 50;
+
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+	currentLane = index + 1;
+#endif
+
+	// The denormal flags are stored per thread, so we need to set them for the workers too
+	ScopedNoDenormals noDenormals;
+
+	while (!threadShouldExit())
+	{
+		if (parent.processCurrentBatch())
+			continue;
+
+		auto timeSinceLastBatch = Time::getMillisecondCounter() - parent.lastBatchTime.load();
+
+		if (timeSinceLastBatch < SpinTimeoutMilliseconds)
+		{
+			for (int i = 0; i < 64; i++)
+			{
+				if (parent.currentBatch.load() != nullptr)
+					break;
+
+				_mm_pause();
+			}
+		}
+		else
+		{
+			wait(1);
+		}
+	}
+}
+
+} // namespace hise
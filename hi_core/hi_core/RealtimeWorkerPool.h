@@ -0,0 +1,174 @@
+/*  ===========================================================================
+*
+*   This file is part of HISE.
+*   Copyright 2016 Christoph Hart
+*
+*   HISE is free software: you can redistribute it and/or modify
+*   it under the terms of the GNU General Public License as published by
+*   the Free Software Foundation, either version 3 of the License, or
+*   (at your option) any later version.
+*
+*   HISE is distributed in the hope that it will be useful,
+*   but WITHOUT ANY WARRANTY; without even the implied warranty of
+*   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+*   GNU General Public License for more details.
+*
+*   You should have received a copy of the GNU General Public License
+*   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+*
+*   Commercial licenses for using HISE in an closed source project are
+*   available on request. Please visit the project's website to get more
+*   information about commercial licensing:
+*
+*   http://www.hise.audio/
+*
+*   HISE is based on the JUCE library,
+*   which must be separately licensed for closed source applications:
+*
+*   http://www.juce.com
+*
+*   ===========================================================================
+*/
+
+#ifndef REALTIMEWORKERPOOL_H_INCLUDED
+#define REALTIMEWORKERPOOL_H_INCLUDED
+
+namespace hise {
+using namespace juce;
+
+/** A small pool of worker threads that can be used to distribute work from the audio thread.
+
+	Unlike the ThreadPool class, this can be used from within the audio callback: starting a batch
+	doesn't allocate, lock or signal anything, it just publishes a pointer to a task list that lives
+	on the stack of the calling thread. The workers pick up the tasks while the calling thread
+	processes tasks itself and then spin-waits until every task is finished.
+
+	The workers keep spinning for a short time after the last batch so that they are hot for the
+	next audio callback. If nothing happens for a while they go back to sleep (and the calling thread
+	will just process all tasks by itself until they wake up again).
+
+	Only one batch can be processed at the same time. If you call run() while another batch is
+	being processed (eg. from a nested call within a task), the tasks will be executed serially
+	on the calling thread.
+*/
+class RealtimeWorkerPool
+{
+public:
+
+	using TaskFunction = void(*)(void* context, int taskIndex);
+
+	/** The number of threads that can render audio at the same time (the audio thread and the workers). */
+	static constexpr int NumLanes = HISE_NUM_AUDIO_WORKER_LANES;
+
+	/** Returns the lane index of the current thread. This is 0 for any thread that is not a realtime worker. */
+	static int getCurrentLane() noexcept
+	{
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+		return currentLane;
+#else
+		return 0;
+#endif
+	}
+
+	/** Creates a pool with the given amount of threads (the calling thread is not counted). */
+	RealtimeWorkerPool(int numWorkers, int threadPriority=9);
+
+	~RealtimeWorkerPool();
+
+	/** Calls f(taskIndex) for every index between 0 and numTasks and returns when all tasks are done. */
+	template <typename F> void parallelFor(int numTasks, F& f)
+	{
+		run(numTasks, [](void* obj, int taskIndex) { (*static_cast<F*>(obj))(taskIndex); }, &f);
+	}
+
+	/** Calls the function with the context for every index between 0 and numTasks and returns when all tasks are done. */
+	void run(int numTasks, TaskFunction f, void* context);
+
+	int getNumWorkers() const noexcept { return workers.size(); }
+
+	/** Returns the thread ID of the worker. Use this in order to register the workers as audio threads. */
+	Thread::ThreadID getWorkerThreadId(int index) const;
+
+private:
+
+	struct Batch
+	{
+		TaskFunction f;
+		void* context;
+		int numTasks;
+
+		std::atomic<int> nextTask = { 0 };
+		std::atomic<int> numFinished = { 0 };
+	};
+
+	struct Worker : public Thread
+	{
+		Worker(RealtimeWorkerPool& parent_, int index_);
+
+		void run() override;
+
+		RealtimeWorkerPool& parent;
+		const int index;
+	};
+
+	static void processTasks(Batch& b);
+
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+	static thread_local int currentLane;
+#endif
+
+	bool processCurrentBatch();
+
+	std::atomic<Batch*> currentBatch = { nullptr };
+	std::atomic<int> numWorkersInBatch = { 0 };
+	std::atomic<uint32> lastBatchTime = { 0 };
+
+	OwnedArray<Worker> workers;
+
+	JUCE_DECLARE_NON_COPYABLE(RealtimeWorkerPool);
+};
+
+/** A wrapper that holds a separate object for each lane of the RealtimeWorkerPool.
+
+	Use this for the state of an object that is used by multiple voices that might be rendered in parallel
+	(eg. the scratch buffers of a modulator). Every thread will access the object of its lane, so as long as
+	the voices are distributed across the workers by the RealtimeWorkerPool, there won't be any data race.
+
+	If HISE_NUM_AUDIO_WORKER_LANES is one, this is just a thin wrapper around a single object.
+*/
+template <typename T> struct LaneLocal
+{
+	LaneLocal() = default;
+
+	LaneLocal(const T& initialValue)
+	{
+		setAll(initialValue);
+	}
+
+	T& get() noexcept { return lanes[RealtimeWorkerPool::getCurrentLane()]; }
+	const T& get() const noexcept { return lanes[RealtimeWorkerPool::getCurrentLane()]; }
+
+	T& getForLane(int laneIndex) noexcept { return lanes[laneIndex]; }
+	const T& getForLane(int laneIndex) const noexcept { return lanes[laneIndex]; }
+
+	/** Sets the value for every lane. Use this when you change the state outside the voice rendering. */
+	void setAll(const T& newValue)
+	{
+		for (auto& l : lanes)
+			l = newValue;
+	}
+
+	T* operator->() noexcept { return &get(); }
+	const T* operator->() const noexcept { return &get(); }
+
+	T* begin() noexcept { return lanes; }
+	T* end() noexcept { return lanes + RealtimeWorkerPool::NumLanes; }
+
+private:
+
+	T lanes[RealtimeWorkerPool::NumLanes];
+};
+
+} // namespace hise
+
+#endif  // REALTIMEWORKERPOOL_H_INCLUDED
@@ -63,6 +63,7 @@ MainController::SampleManager::~SampleManager()
 
 	internalPreloadJob.signalJobShouldExit();
 	samplerLoaderThreadPool->stopThread(2000);
+	preloadThreadPool = nullptr;
 
 	pendingFunctions.clear();
 
@@ -132,6 +133,14 @@ void MainController::SampleManager::addDeferredFunction(Processor* p, const Proc
 	triggerSamplePreloading();
 }
 
+ThreadPool& MainController::SampleManager::getPreloadThreadPool()
+{
+	if (preloadThreadPool == nullptr)
+		preloadThreadPool = new ThreadPool(jmax(1, jmin(HISE_NUM_PRELOAD_THREADS, SystemStats::getNumCpus())));
+
+	return *preloadThreadPool;
+}
+
 double& MainController::SampleManager::getPreloadProgress()
 {
 	return internalPreloadJob.progress;
@@ -96,6 +96,7 @@
 #include "GlobalScriptCompileBroadcaster.h"
 #include "MainControllerHelpers.h"
 #include "LockHelpers.h"
+#include "RealtimeWorkerPool.h"
 #include "MainController.h"
 #include "Console.h"
 
@@ -277,6 +277,8 @@ void Processor::setBypassed(bool shouldBeBypassed, NotificationType notifyChange
 		bypassed = shouldBeBypassed;
 		currentValues.clear();
 
+		getMainController()->bumpModuleTreeRevision();
+
 #if HISE_OLD_PROCESSOR_DISPATCH
 #if 0
 		sendSynchronousBypassChangeMessage();
@@ -501,6 +503,9 @@ void Processor::setParentProcessor(Processor* newParent)
 
 	parentProcessor = newParent;
 
+	// Invalidate the cached properties of the module tree before the processor is inserted into the processing chain
+	getMainController()->bumpModuleTreeRevision();
+
 	for (int i = 0; i < getNumChildProcessors(); i++)
 		getChildProcessor(i)->setParentProcessor(this);
 }
@@ -841,6 +841,9 @@ void Chain::Handler::removePostEventListener(Listener* l)
 
 void Chain::Handler::notifyListeners(Listener::EventType t, Processor* p)
 {
+	if (p != nullptr)
+		p->getMainController()->bumpModuleTreeRevision();
+
 	ScopedLock sl(listeners.getLock());
 
 	for (auto l : listeners)
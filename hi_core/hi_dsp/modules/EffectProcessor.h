@@ -334,6 +334,9 @@ public:
 
 	void setForceMonoMode(bool shouldUseMonoMode);
 
+	/** Overwrite this and return true if applyEffect() can be called for different voices at the same time. */
+	virtual bool isSafeForVoiceParallelRendering() const { return false; }
+
 protected:
 
 	bool forceMono = false;
@@ -132,9 +132,9 @@ void ModulatorChain::ModChainWithBuffer::setScratchBufferFunction(
 
 void ModulatorChain::ModChainWithBuffer::setConstantVoiceValueInternal(int voiceIndex, float newValue)
 {
-	lastConstantVoiceValue = newValue;
+	lastConstantVoiceValue.get() = newValue;
 	currentConstantVoiceValues[voiceIndex] = newValue;
-	currentConstantValue = newValue;
+	currentConstantValue.get() = newValue;
 }
 
 const Chain::Handler* ModulatorChain::getHandler() const
@@ -345,10 +345,10 @@ void ModulatorChain::ModChainWithBuffer::setDisplayValueInternal(int voiceIndex,
 	{
 		float displayValue;
 
-		if (currentVoiceData == nullptr)
+		if (currentVoiceData.get() == nullptr)
 			displayValue = getConstantModulationValue();
 		else
-			displayValue = currentVoiceData[startSample];
+			displayValue = currentVoiceData.get()[startSample];
 
 		if (c->getMode() == Modulation::PanMode)
 		{
@@ -358,8 +358,8 @@ void ModulatorChain::ModChainWithBuffer::setDisplayValueInternal(int voiceIndex,
 
 		c->setOutputValue(displayValue);
 
-		if(currentVoiceData != nullptr)
-			c->pushPlotterValues(currentVoiceData, startSample, numSamples);
+		if(currentVoiceData.get() != nullptr)
+			c->pushPlotterValues(currentVoiceData.get(), startSample, numSamples);
 	}
 }
 
@@ -385,7 +385,8 @@ ModulatorChain::ModChainWithBuffer::~ModChainWithBuffer()
 {
 	c = nullptr;
 
-	modBuffer.clear();
+	for (auto& b : modBuffer)
+		b.clear();
 }
 
 void ModulatorChain::ModChainWithBuffer::prepareToPlay(double sampleRate, int samplesPerBlock)
@@ -393,7 +394,10 @@ void ModulatorChain::ModChainWithBuffer::prepareToPlay(double sampleRate, int sa
 	c->prepareToPlay(sampleRate, samplesPerBlock);
 
 	if (type == Type::Normal)
-		modBuffer.setMaxSize(samplesPerBlock);
+	{
+		for (auto& b : modBuffer)
+			b.setMaxSize(samplesPerBlock);
+	}
 }
 
 void ModulatorChain::ModChainWithBuffer::handleHiseEvent(const HiseEvent& m)
@@ -439,7 +443,9 @@ void ModulatorChain::ModChainWithBuffer::startVoice(int voiceIndex)
 
 	setConstantVoiceValueInternal(voiceIndex, c->getConstantVoiceValue(voiceIndex));
 
-	
+	// The voice start happens outside the voice rendering, so we need to update every lane
+	currentConstantValue.setAll(currentConstantValue.get());
+	lastConstantVoiceValue.setAll(lastConstantVoiceValue.get());
 
 	currentRampValues[voiceIndex] = firstDynamicValue;
 
@@ -450,21 +456,21 @@ void ModulatorChain::ModChainWithBuffer::startVoice(int voiceIndex)
 
 void ModulatorChain::ModChainWithBuffer::expandVoiceValuesToAudioRate(int voiceIndex, int startSample, int numSamples)
 {
-	if (currentVoiceData != nullptr)
+	if (currentVoiceData.get() != nullptr)
 	{
-		polyExpandChecker = true;
+		polyExpandChecker.get() = true;
 
-		if (!ModBufferExpansion::expand(currentVoiceData, startSample, numSamples, currentRampValues[voiceIndex]))
+		if (!ModBufferExpansion::expand(currentVoiceData.get(), startSample, numSamples, currentRampValues[voiceIndex]))
 		{
 			// Don't use the dynamic data for further processing...
 
-			currentConstantValue = currentRampValues[voiceIndex];
+			currentConstantValue.get() = currentRampValues[voiceIndex];
 
-			currentVoiceData = nullptr;
+			currentVoiceData.get() = nullptr;
 		}
 		else
 		{
-			currentConstantValue = 1.0f;
+			currentConstantValue.get() = 1.0f;
 		}
 	}
 }
@@ -517,21 +523,21 @@ void ModulatorChain::ModChainWithBuffer::calculateMonophonicModulationValues(int
 
 		ModIterator<TimeVariantModulator> iter(c);
 		
-		FloatVectorOperations::fill(modBuffer.monoValues + startSample_cr, c->getInitialValue(), numSamples_cr);
+		FloatVectorOperations::fill(modBuffer.getForLane(0).monoValues + startSample_cr, c->getInitialValue(), numSamples_cr);
 
 		while (auto mod = iter.next())
 		{
-			mod->render(modBuffer.monoValues, modBuffer.scratchBuffer, startSample_cr, numSamples_cr);
+			mod->render(modBuffer.getForLane(0).monoValues, modBuffer->scratchBuffer, startSample_cr, numSamples_cr);
 		}
 
 		ModIterator<MonophonicEnvelope> iter2(c);
 
 		while (auto mod = iter2.next())
 		{
-			mod->render(0, modBuffer.monoValues, modBuffer.scratchBuffer, startSample_cr, numSamples_cr);
+			mod->render(0, modBuffer.getForLane(0).monoValues, modBuffer->scratchBuffer, startSample_cr, numSamples_cr);
 		}
 
-		currentMonoValue = modBuffer.monoValues[startSample_cr];
+		currentMonoValue = modBuffer.getForLane(0).monoValues[startSample_cr];
 
 		monoExpandChecker = false;
 	}
@@ -547,14 +553,14 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 	}
 
 	jassert(voiceIndex >= 0);
-	jassert(modBuffer.isInitialised());
+	jassert(modBuffer->isInitialised());
 
 	c->polyManager.setCurrentVoice(voiceIndex);
 
 	const bool useMonophonicData = options.includeMonophonicValues && c->hasMonophonicTimeModulationMods();
 
-	auto voiceData = modBuffer.voiceValues;
-	const auto monoData = modBuffer.monoValues;
+	auto voiceData = modBuffer->voiceValues;
+	const auto monoData = modBuffer.getForLane(0).monoValues;
 
 	jassert(startSample % HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR == 0);
 
@@ -599,10 +605,10 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 
 			while (auto mod = iter.next())
 			{
-				mod->render(voiceIndex, voiceData, modBuffer.scratchBuffer, startSample_cr, numSamples_cr);
+				mod->render(voiceIndex, voiceData, modBuffer->scratchBuffer, startSample_cr, numSamples_cr);
 
 				if (scratchBufferFunction)
-					scratchBufferFunction(voiceIndex, mod, modBuffer.scratchBuffer, startSample_cr, numSamples_cr);
+					scratchBufferFunction(voiceIndex, mod, modBuffer->scratchBuffer, startSample_cr, numSamples_cr);
 			}
 
 			if (useMonophonicData)
@@ -610,10 +616,10 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 				applyMonophonicValuesToVoiceInternal(voiceData + startSample_cr, monoData + startSample_cr, numSamples_cr);
 			}
 
-			currentVoiceData = voiceData;
+			currentVoiceData.get() = voiceData;
 			
 #if JUCE_DEBUG
-			polyExpandChecker = false;
+			polyExpandChecker.get() = false;
 #endif
 		}
 		else if (useMonophonicData)
@@ -621,16 +627,16 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 			applyMonophonicValuesToVoiceInternal(voiceData + startSample_cr, monoData + startSample_cr, numSamples_cr);
 
 			
-			currentVoiceData = voiceData;
+			currentVoiceData.get() = voiceData;
 
 #if JUCE_DEBUG
-			polyExpandChecker = false;
+			polyExpandChecker.get() = false;
 #endif
 		}
 		else
 		{
 			// Set it to nullptr, and let the module use the constant value instead...
-			currentVoiceData = nullptr;
+			currentVoiceData.get() = nullptr;
 		}
 	}
 	else if (useMonophonicData)
@@ -643,7 +649,7 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 		{
 			// Use the default logic for pan
 			FloatVectorOperations::copy(voiceData + startSample_cr, monoData + startSample_cr, numSamples_cr);
-			currentVoiceData = voiceData;
+			currentVoiceData.get() = voiceData;
 		}
 		else
 		{
@@ -662,28 +668,28 @@ void ModulatorChain::ModChainWithBuffer::calculateModulationValuesForCurrentVoic
 				*wp++ = value * value;
 			}
 
-			currentVoiceData = voiceData;
+			currentVoiceData.get() = voiceData;
 		}
 
 		
 
 #else
 		if (options.voiceValuesReadOnly)
-			currentVoiceData = monoData;
+			currentVoiceData.get() = monoData;
 		else
 		{
 			FloatVectorOperations::copy(voiceData + startSample_cr, monoData + startSample_cr, numSamples_cr);
-			currentVoiceData = voiceData;
+			currentVoiceData.get() = voiceData;
 		}
 #endif
 
 #if JUCE_DEBUG
-		polyExpandChecker = false;
+		polyExpandChecker.get() = false;
 #endif
 	}
 	else
 	{
-		currentVoiceData = nullptr;
+		currentVoiceData.get() = nullptr;
 
 		setConstantVoiceValueInternal(voiceIndex, 1.0f);
 	}
@@ -699,7 +705,7 @@ void ModulatorChain::ModChainWithBuffer::applyMonophonicModulationValues(AudioSa
 	{
 		for (int i = 0; i < b.getNumSamples(); i++)
 		{
-			FloatVectorOperations::multiply(b.getWritePointer(i, startSample), modBuffer.monoValues, numSamples);
+			FloatVectorOperations::multiply(b.getWritePointer(i, startSample), modBuffer.getForLane(0).monoValues, numSamples);
 		}
 	}
 }
@@ -708,9 +714,9 @@ const float* ModulatorChain::ModChainWithBuffer::getReadPointerForVoiceValues(in
 {
 	// You need to expand the modulation values to audio rate before calling this method.
 	// Either call setExpandAudioRate(true) in the constructor, or manually expand them
-	jassert(currentVoiceData == nullptr || polyExpandChecker);
+	jassert(currentVoiceData.get() == nullptr || polyExpandChecker.get());
 
-	return currentVoiceData != nullptr ? currentVoiceData + startSample : nullptr;
+	return currentVoiceData.get() != nullptr ? currentVoiceData.get() + startSample : nullptr;
 }
 
 float* ModulatorChain::ModChainWithBuffer::getWritePointerForVoiceValues(int startSample)
@@ -719,9 +725,9 @@ float* ModulatorChain::ModChainWithBuffer::getWritePointerForVoiceValues(int sta
 
 	// You need to expand the modulation values to audio rate before calling this method.
 	// Either call setExpandAudioRate(true) in the constructor, or manually expand them
-	jassert(currentVoiceData == nullptr || polyExpandChecker);
+	jassert(currentVoiceData.get() == nullptr || polyExpandChecker.get());
 
-	return currentVoiceData != nullptr ? const_cast<float*>(currentVoiceData) + startSample : nullptr;
+	return currentVoiceData.get() != nullptr ? const_cast<float*>(currentVoiceData.get()) + startSample : nullptr;
 }
 
 float* ModulatorChain::ModChainWithBuffer::getWritePointerForManualExpansion(int startSample)
@@ -734,9 +740,9 @@ float* ModulatorChain::ModChainWithBuffer::getWritePointerForManualExpansion(int
 
 	int startSample_cr = startSample / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
 
-	manualExpansionPending = true;
+	manualExpansionPending.get() = true;
 
-	return currentVoiceData != nullptr ? const_cast<float*>(currentVoiceData) + startSample_cr : nullptr;
+	return currentVoiceData.get() != nullptr ? const_cast<float*>(currentVoiceData.get()) + startSample_cr : nullptr;
 }
 
 const float* ModulatorChain::ModChainWithBuffer::getMonophonicModulationValues(int startSample) const
@@ -746,7 +752,7 @@ const float* ModulatorChain::ModChainWithBuffer::getMonophonicModulationValues(i
 
 	if (c->hasMonophonicTimeModulationMods())
 	{
-		return modBuffer.monoValues + startSample;
+		return modBuffer.getForLane(0).monoValues + startSample;
 	}
 
 	return nullptr;
@@ -754,12 +760,12 @@ const float* ModulatorChain::ModChainWithBuffer::getMonophonicModulationValues(i
 
 float ModulatorChain::ModChainWithBuffer::getConstantModulationValue() const
 {
-	return currentConstantValue;
+	return currentConstantValue.get();
 }
 
 float ModulatorChain::ModChainWithBuffer::getModValueForVoiceWithOffset(int startSample) const
 {
-	return currentVoiceData != nullptr ? currentVoiceData[startSample] : currentConstantValue;
+	return currentVoiceData.get() != nullptr ? currentVoiceData.get()[startSample] : currentConstantValue.get();
 }
 
 float ModulatorChain::ModChainWithBuffer::getOneModulationValue(int startSample) const
@@ -767,16 +773,16 @@ float ModulatorChain::ModChainWithBuffer::getOneModulationValue(int startSample)
 	// If you set this, you probably don't need this method...
 	jassert(!options.expandToAudioRate);
 
-	if (currentVoiceData == nullptr)
+	if (currentVoiceData.get() == nullptr)
 		return getConstantModulationValue();
 
 	const int downsampledOffset = startSample / HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
-	return currentVoiceData[downsampledOffset];
+	return currentVoiceData.get()[downsampledOffset];
 }
 
 float* ModulatorChain::ModChainWithBuffer::getScratchBuffer()
 {
-	return modBuffer.scratchBuffer;
+	return modBuffer->scratchBuffer;
 }
 
 void ModulatorChain::ModChainWithBuffer::setAllowModificationOfVoiceValues(bool mightBeOverwritten)
@@ -792,8 +798,8 @@ void ModulatorChain::ModChainWithBuffer::setIncludeMonophonicValuesInVoiceRender
 
 void ModulatorChain::ModChainWithBuffer::clear()
 {
-	currentVoiceData = nullptr;
-	currentConstantValue = c->getInitialValue();
+	currentVoiceData.setAll(nullptr);
+	currentConstantValue.setAll(c->getInitialValue());
 }
 
 ModulatorChain::ModulatorChain(MainController *mc, const String &uid, int numVoices, Mode m, Processor *p): 
@@ -289,26 +289,29 @@ public:
 
 		Type type;
 
-		Buffer modBuffer;
+		// The voice rendering state is stored for every lane of the RealtimeWorkerPool so that
+		// multiple voices can be calculated at the same time. The monophonic values are always
+		// stored in the buffer of the first lane.
+		LaneLocal<Buffer> modBuffer;
 
 		bool monoExpandChecker = false;
-		bool polyExpandChecker = false;
+		LaneLocal<bool> polyExpandChecker = false;
 
-		bool manualExpansionPending = false;
+		LaneLocal<bool> manualExpansionPending = false;
 
 		
 
 		Options options;
 		
-		float currentConstantValue = 1.0f;
+		LaneLocal<float> currentConstantValue = 1.0f;
 
 		float currentMonoValue = 1.0f;
-		float lastConstantVoiceValue = 1.0f;
+		LaneLocal<float> lastConstantVoiceValue = 1.0f;
 		float currentConstantVoiceValues[NUM_POLYPHONIC_VOICES];
 		float currentRampValues[NUM_POLYPHONIC_VOICES];
 		
 		float currentMonophonicRampValue;
-		float const* currentVoiceData = nullptr;
+		LaneLocal<float const*> currentVoiceData = nullptr;
 
 		JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(ModChainWithBuffer);
 	};
@@ -68,7 +68,8 @@ iconColour(Colours::transparentBlack),
 clockSpeed(ClockSpeed::Inactive),
 lastClockCounter(0),
 wasPlayingInLastBuffer(false),
-bypassState(false)
+bypassState(false),
+parallelRenderingFlags(*this)
 {
 	modChains += { this, "GainModulation", ModulatorChain::ModulationType::Normal, Modulation::Mode::GainMode};
 	modChains += { this, "PitchModulation", ModulatorChain::ModulationType::Normal, Modulation::Mode::PitchMode};
@@ -104,6 +105,8 @@ bypassState(false)
 
 ModulatorSynth::~ModulatorSynth()
 {
+	parallelRenderingFlags.stopTimer();
+
 	deleteAllVoices();
 	
 	midiProcessorChain = nullptr;
@@ -129,6 +132,9 @@ ValueTree ModulatorSynth::exportAsValueTree() const
 
 	v.setProperty("IconColour", iconColour.toString(), nullptr);
 
+	if (useVoiceParallelRendering)
+		v.setProperty("VoiceParallelRendering", true, nullptr);
+
 	return v;
 }
 
@@ -143,6 +149,8 @@ void ModulatorSynth::restoreFromValueTree(const ValueTree &v)
 
 	iconColour = Colour::fromString(v.getProperty("IconColour", Colours::transparentBlack.toString()).toString());
 
+	setUseVoiceParallelRendering(v.getProperty("VoiceParallelRendering", false));
+
 	Processor::restoreFromValueTree(v);
 }
 
@@ -293,7 +301,7 @@ void ModulatorSynth::setKillRetriggeredNote(bool shouldBeKilled)
 
 float* ModulatorSynth::getPitchValuesForVoice() const
 {
-	if (useScratchBufferForArtificialPitch)
+	if (useScratchBufferForArtificialPitch.get())
 		return modChains[BasicChains::PitchChain].getScratchBuffer();
 		
 	return modChains[BasicChains::PitchChain].getWritePointerForVoiceValues(0);
@@ -301,7 +309,7 @@ float* ModulatorSynth::getPitchValuesForVoice() const
 
 void ModulatorSynth::overwritePitchValues(const float* modDataValues, int startSample, int numSamples)
 {
-	useScratchBufferForArtificialPitch = true;
+	useScratchBufferForArtificialPitch.get() = true;
 
 	auto destination = modChains[BasicChains::PitchChain].getScratchBuffer();
 
@@ -338,6 +346,8 @@ void ModulatorSynth::setUseUniformVoiceHandler(bool shouldUseVoiceHandler, Unifo
 {
 	currentUniformVoiceHandler = shouldUseVoiceHandler ? externalHandlerToUse :
 		                             nullptr;
+
+	getMainController()->bumpModuleTreeRevision();
 }
 
 bool ModulatorSynth::isUsingUniformVoiceHandler() const
@@ -349,6 +359,170 @@ UniformVoiceHandler* ModulatorSynth::getUniformVoiceHandler() const
         
 }
 
+namespace ParallelRenderingHelpers
+{
+	static bool isSafe(const Processor* p)
+	{
+		for (int i = 0; i < p->getNumChildProcessors(); i++)
+		{
+			auto c = p->getChildProcessor(i);
+
+			if (c == nullptr)
+				continue;
+
+			if (auto childSynth = dynamic_cast<const ModulatorSynth*>(c))
+			{
+				if (!childSynth->isSafeForParallelRendering())
+					return false;
+
+				continue;
+			}
+
+			// MIDI processors can create artificial events (eg. the MIDI player or the arpeggiator)
+			// or send choke messages to other sound generators, which changes the event ID state
+			// of the MainController and the state of the siblings that are rendered concurrently.
+			if (auto midiChain = dynamic_cast<const MidiProcessorChain*>(c))
+			{
+				if (midiChain->getNumChildProcessors() > 0)
+					return false;
+
+				continue;
+			}
+
+			if (dynamic_cast<const JavascriptProcessor*>(c) != nullptr)
+				return false;
+
+			if (dynamic_cast<const SendEffect*>(c) != nullptr)
+				return false;
+
+			if (!isSafe(c))
+				return false;
+		}
+
+		return true;
+	}
+}
+
+bool ModulatorSynth::isSafeForParallelRendering() const
+{
+	if (isUsingUniformVoiceHandler())
+		return false;
+
+	// The output must be added exactly once per channel or the result will not be identical to the serial rendering
+	auto& m = getMatrix();
+
+	for (int i = 0; i < m.getNumSourceChannels(); i++)
+	{
+		auto d = m.getConnectionForSourceChannel(i);
+
+		if (d == -1)
+			continue;
+
+		for (int j = i + 1; j < m.getNumSourceChannels(); j++)
+		{
+			if (m.getConnectionForSourceChannel(j) == d)
+				return false;
+		}
+	}
+
+	return ParallelRenderingHelpers::isSafe(this);
+}
+
+void ModulatorSynth::updateParallelRenderingFlags()
+{
+	if (!isValidAndInitialised())
+		return;
+
+	// Fetch the revision before checking the tree so that any change during the update invalidates the result
+	auto revision = getMainController()->getModuleTreeRevision();
+
+	LockHelpers::SafeLock sl(getMainController(), LockHelpers::Type::IteratorLock, !getMainController()->isFlakyThreadingAllowed());
+
+	// The global cables and signals can connect any two sound generators,
+	// so we can't tell whether they share state with their siblings.
+	const bool usesGlobalRouting = getMainController()->getGlobalRoutingManager() != nullptr;
+
+	parallelRenderingFlags.safeForParallelRendering = !usesGlobalRouting && isSafeForParallelRendering();
+	parallelRenderingFlags.safeForVoiceParallelRendering = !usesGlobalRouting && useVoiceParallelRendering && isSafeForVoiceParallelRendering();
+	parallelRenderingFlags.revision = revision;
+}
+
+bool ModulatorSynth::canBeRenderedInParallel() const noexcept
+{
+	return parallelRenderingFlags.revision.load() == getMainController()->getModuleTreeRevision() &&
+		   parallelRenderingFlags.safeForParallelRendering.load();
+}
+
+bool ModulatorSynth::canRenderVoicesInParallel() const noexcept
+{
+	return parallelRenderingFlags.revision.load() == getMainController()->getModuleTreeRevision() &&
+		   parallelRenderingFlags.safeForVoiceParallelRendering.load();
+}
+
+void ModulatorSynth::refreshParallelRenderingFlags()
+{
+	if (needsParallelRenderingFlags())
+	{
+		if (MessageManager::getInstanceWithoutCreating() != nullptr && MessageManager::getInstance()->isThisTheMessageThread())
+			updateParallelRenderingFlags();
+
+		parallelRenderingFlags.startTimer(100);
+	}
+	else
+	{
+		parallelRenderingFlags.stopTimer();
+	}
+}
+
+void ModulatorSynth::setUseVoiceParallelRendering(bool shouldRenderVoicesInParallel)
+{
+	useVoiceParallelRendering = shouldRenderVoicesInParallel;
+	refreshParallelRenderingFlags();
+}
+
+bool ModulatorSynth::isSafeForVoiceParallelRendering() const
+{
+	return false;
+}
+
+bool ModulatorSynth::checkVoiceParallelRenderingContract() const
+{
+	// The group renders the voices of its children and the uniform voice handler counts the voices of all synths
+	if (isInGroup() || isUsingUniformVoiceHandler())
+		return false;
+
+	Processor::Iterator<const Processor> iter(this, false);
+
+	while (auto p = iter.getNextProcessor())
+	{
+		if (p == this)
+			continue;
+
+		// Voice start and time variant modulators are calculated before the voice rendering,
+		// so we only need to check the modulators that are calculated for each voice.
+		if (auto env = dynamic_cast<const EnvelopeModulator*>(p))
+		{
+			if (dynamic_cast<const ModulatorChain*>(p) != nullptr)
+				continue;
+
+			if (env->isBypassed())
+				continue;
+
+			if (env->isInMonophonicMode() || !env->isSafeForVoiceParallelRendering() || env->isIntensitySmoothing())
+				return false;
+		}
+
+		if (auto fx = dynamic_cast<const VoiceEffectProcessor*>(p))
+		{
+			// The silence detection updates the tail state of the effect for each voice
+			if (!fx->isBypassed() && (fx->isSuspendedOnSilence() || !fx->isSafeForVoiceParallelRendering()))
+				return false;
+		}
+	}
+
+	return true;
+}
+
 bool ModulatorSynth::synthNeedsEnvelope() const
 { return true; }
 
@@ -631,6 +805,12 @@ void ModulatorSynth::renderVoice(int startSample, int numThisTime)
     
 	clearPendingRemoveVoices();
 
+	if (renderVoicesInParallel(startSample, numThisTime))
+	{
+		clearPendingRemoveVoices();
+		return;
+	}
+
 	for (auto v : activeVoices)
 	{
 		jassert(!v->isInactive());
@@ -644,6 +824,63 @@ void ModulatorSynth::renderVoice(int startSample, int numThisTime)
 };
 
 	
+bool ModulatorSynth::renderVoicesInParallel(int startSample, int numThisTime)
+{
+	if (!useVoiceParallelRendering || activeVoices.size() < MinNumVoicesForParallelRendering)
+		return false;
+
+	auto pool = getMainController()->getRealtimeWorkerPool();
+
+	if (pool == nullptr)
+		return false;
+
+	// The debug logger collects its statistics without any synchronisation
+	if (getMainController()->getDebugLogger().isLogging())
+		return false;
+
+	if (!canRenderVoicesInParallel())
+		return false;
+
+	const int numVoices = activeVoices.size();
+	const int numTasks = jmin(numVoices, RealtimeWorkerPool::NumLanes);
+
+	auto renderChunk = [&](int taskIndex)
+	{
+		const int start = taskIndex * numVoices / numTasks;
+		const int end = (taskIndex + 1) * numVoices / numTasks;
+
+		for (int i = start; i < end; i++)
+		{
+			auto v = activeVoices[i];
+
+			jassert(!v->isInactive());
+
+			calculateModulationValuesForVoice(v, startSample, numThisTime);
+			v->renderVoiceBuffer(startSample, numThisTime);
+		}
+	};
+
+	renderingVoicesInParallel = true;
+	pool->parallelFor(numTasks, renderChunk);
+	renderingVoicesInParallel = false;
+
+	// Now add the voices in the same order as the serial rendering
+	// so that the output and the voice removal order is identical.
+	for (int i = 0; i < numVoices; i++)
+	{
+		auto v = activeVoices[i];
+
+		v->handleDeferredParallelUpdates();
+
+		if (v->isInactive())
+			flagVoiceAsRemoved(v);
+
+		v->addVoiceBufferAndCheckRelease(internalBuffer, startSample, numThisTime);
+	}
+
+	return true;
+}
+
 void ModulatorSynth::calculateModulationValuesForVoice(ModulatorSynthVoice * v, int startSample, int numThisTime)
 {
 	auto index = v->getVoiceIndex();
@@ -659,7 +896,7 @@ void ModulatorSynth::calculateModulationValuesForVoice(ModulatorSynthVoice * v,
 
 	v->applyConstantPitchFactor(getConstantPitchModValue());
 
-	useScratchBufferForArtificialPitch = false;
+	useScratchBufferForArtificialPitch.get() = false;
 
 	if (v->isPitchFadeActive())
 	{
@@ -669,7 +906,7 @@ void ModulatorSynth::calculateModulationValuesForVoice(ModulatorSynthVoice * v,
 		{
 			bufferToUse = modChains[BasicChains::PitchChain].getScratchBuffer();
 			FloatVectorOperations::fill(bufferToUse + startSample, 1.0f, numThisTime);
-			useScratchBufferForArtificialPitch = true;
+			useScratchBufferForArtificialPitch.get() = true;
 		}
 
 		v->applyScriptPitchFactors(bufferToUse + startSample, numThisTime);
@@ -971,6 +1208,9 @@ void ModulatorSynth::prepareToPlay(double newSampleRate, int samplesPerBlock)
 
 	LockHelpers::SafeLock audioLock(getMainController(), LockHelpers::Type::AudioLock, isOnAir());
 
+	// The voice buffers might be resized, so we need to check the parallel rendering contract again
+	getMainController()->bumpModuleTreeRevision();
+
 	// You must call finaliseModChains() in your Constructor...
 	jassert(finalised);
 
@@ -1092,6 +1332,10 @@ void ModulatorSynth::flagVoiceAsRemoved(ModulatorSynthVoice* v)
 {
 	jassert(v->isInactive());
 
+	// The voice will be flagged after all voices are rendered
+	if (renderingVoicesInParallel)
+		return;
+
 	pendingRemoveVoices.insert(v);
 }
 
@@ -2165,33 +2409,41 @@ void ModulatorSynthVoice::renderNextBlock (AudioSampleBuffer& outputBuffer, int
 {
 	if (isActive)
     { 
-		calculateBlock(startSample, numSamples);
+		renderVoiceBuffer(startSample, numSamples);
+		addVoiceBufferAndCheckRelease(outputBuffer, startSample, numSamples);
+    }
+}
 
-		if (gainFader.isSmoothing())
-		{
-			applyEventVolumeFade(startSample, numSamples);
-		}
-		else if (eventGainFactor != 1.0f)
-		{
-			applyEventVolumeFactor(startSample, numSamples);
-		}
+void ModulatorSynthVoice::renderVoiceBuffer(int startSample, int numSamples)
+{
+	calculateBlock(startSample, numSamples);
 
-		if(killThisVoice)
-		{
-			applyKillFadeout(startSample, numSamples);
-		}
+	if (gainFader.isSmoothing())
+	{
+		applyEventVolumeFade(startSample, numSamples);
+	}
+	else if (eventGainFactor != 1.0f)
+	{
+		applyEventVolumeFactor(startSample, numSamples);
+	}
 
-		const int maxChannelAmount = jmin<int>(voiceBuffer.getNumChannels(), outputBuffer.getNumChannels());
+	if(killThisVoice)
+	{
+		applyKillFadeout(startSample, numSamples);
+	}
+}
 
-		for (int i = 0; i < maxChannelAmount; i++)
-		{
-			FloatVectorOperations::add(outputBuffer.getWritePointer(i, startSample), voiceBuffer.getReadPointer(i, startSample), numSamples);
-		}
+void ModulatorSynthVoice::addVoiceBufferAndCheckRelease(AudioSampleBuffer& outputBuffer, int startSample, int numSamples)
+{
+	const int maxChannelAmount = jmin<int>(voiceBuffer.getNumChannels(), outputBuffer.getNumChannels());
 
+	for (int i = 0; i < maxChannelAmount; i++)
+	{
+		FloatVectorOperations::add(outputBuffer.getWritePointer(i, startSample), voiceBuffer.getReadPointer(i, startSample), numSamples);
+	}
 
-		// checks if any envelopes are active and in their release state and calls stopNote until they are finished.
-		checkRelease();
-    }
+	// checks if any envelopes are active and in their release state and calls stopNote until they are finished.
+	checkRelease();
 }
 
 void ModulatorSynthVoice::setCurrentHiseEvent(const HiseEvent &m)
@@ -489,6 +489,68 @@ public:
 
 	UniformVoiceHandler* getUniformVoiceHandler() const;
 
+	/** Checks whether this synth can be rendered concurrently to its siblings.
+
+		This is used by the parallel rendering of the ModulatorSynthChain. The default implementation
+		returns false if this synth (or any of its child processors) contains a script or a MIDI processor,
+		sends its signal to another sound generator, uses a uniform voice handler or routes multiple channels to the same
+		output channel. Override this and return false if your synth writes to (or reads from) the state
+		of another sound generator during rendering.
+	*/
+	virtual bool isSafeForParallelRendering() const;
+
+	/** Reevaluates the parallel rendering contract and caches the result for the audio thread.
+
+		Checking the contract walks the entire module tree, so this is done on the message thread
+		whenever a parallel rendering mode is active (and the audio thread just reads the cached flags).
+		Call this after you've changed a property that affects isSafeForParallelRendering().
+	*/
+	virtual void updateParallelRenderingFlags();
+
+	/** Returns the cached result of isSafeForParallelRendering().
+
+		This is lockfree and will return false if the module tree has changed since the last update
+		(see MainController::getModuleTreeRevision()), so the audio thread never uses a stale result.
+	*/
+	bool canBeRenderedInParallel() const noexcept;
+
+	/** Enables the voice-parallel rendering of this synth.
+
+		If enabled, the active voices are split into chunks that are rendered by the realtime worker threads
+		(you need to set HISE_NUM_AUDIO_WORKER_THREADS for this). Every worker calculates the modulation values
+		using its own lane of the modulation buffers and renders the voices into their voice buffers. After all
+		voices are rendered, they are added to the internal buffer in the same order as the serial rendering, so
+		the output is identical.
+
+		The voices are rendered serially if isSafeForVoiceParallelRendering() returns false, if there are less than
+		MinNumVoicesForParallelRendering voices or if the debug logger is active.
+	*/
+	void setUseVoiceParallelRendering(bool shouldRenderVoicesInParallel);
+
+	bool isUsingVoiceParallelRendering() const noexcept { return useVoiceParallelRendering; }
+
+	/** Checks whether multiple voices of this synth can be rendered at the same time.
+
+		The contract is that a voice only changes its own state, the state that is indexed by its voice index or
+		data that is stored in a LaneLocal object (eg. the modulation buffers). All modulators that are calculated
+		per voice and all voice effects must fulfill the same contract (see EnvelopeModulator::isSafeForVoiceParallelRendering()).
+
+		The default returns false, so you need to override this in your synth and call checkVoiceParallelRenderingContract()
+		after you've checked that your voice class is safe.
+
+		This is not called on the audio thread, but evaluated with updateParallelRenderingFlags(), so if you change a property
+		that affects the result, call MainController::bumpModuleTreeRevision() to render the voices serially until the next update.
+	*/
+	virtual bool isSafeForVoiceParallelRendering() const;
+
+	/** Returns the cached result of isSafeForVoiceParallelRendering(). This is lockfree and returns false if the module tree has changed since the last update. */
+	bool canRenderVoicesInParallel() const noexcept;
+
+	/** Returns true while the voices are rendered on the worker threads. Use this to defer anything that changes the state of the synth. */
+	bool isRenderingVoicesInParallel() const noexcept { return renderingVoicesInParallel; }
+
+	static constexpr int MinNumVoicesForParallelRendering = 8;
+
 private:
 
 	VoiceStack pendingRemoveVoices;
@@ -500,6 +562,15 @@ protected:
 	virtual bool synthNeedsEnvelope() const;;
 	
 	void finaliseModChains();
+
+	/** Checks the envelopes and voice effects of this synth for voice-parallel rendering. */
+	bool checkVoiceParallelRenderingContract() const;
+
+	/** Override this and return true if the cached parallel rendering flags are required. */
+	virtual bool needsParallelRenderingFlags() const { return useVoiceParallelRendering; }
+
+	/** Starts or stops the periodic update of the parallel rendering flags. */
+	void refreshParallelRenderingFlags();
 	
 
 	bool finalised = false;
@@ -548,7 +619,29 @@ private:
 
 	// If this is true, the script fade things have changed the pitch modulation data
 	// and it must be used.
-	bool useScratchBufferForArtificialPitch = false;
+	LaneLocal<bool> useScratchBufferForArtificialPitch = false;
+
+	bool renderVoicesInParallel(int startSample, int numThisTime);
+
+	bool useVoiceParallelRendering = false;
+	bool renderingVoicesInParallel = false;
+
+	struct ParallelRenderingFlags : public Timer
+	{
+		ParallelRenderingFlags(ModulatorSynth& p) :
+			parent(p)
+		{};
+
+		void timerCallback() override { parent.updateParallelRenderingFlags(); }
+
+		ModulatorSynth& parent;
+
+		std::atomic<uint32> revision = { 0 };
+		std::atomic<bool> safeForParallelRendering = { false };
+		std::atomic<bool> safeForVoiceParallelRendering = { false };
+	};
+
+	ParallelRenderingFlags parallelRenderingFlags;
 
 	
 
@@ -604,6 +697,21 @@ public:
                                   int startSample,
                                   int numSamples) override;
 
+	/** Calculates the voice and applies the event fades to the voice buffer.
+	
+		This is the first part of renderNextBlock() and will be called on a worker thread when the voices are rendered in parallel.
+	*/
+	void renderVoiceBuffer(int startSample, int numSamples);
+
+	/** Adds the voice buffer to the output and checks if the voice should be released. This is the second part of renderNextBlock(). */
+	void addVoiceBufferAndCheckRelease(AudioSampleBuffer& outputBuffer, int startSample, int numSamples);
+
+	/** This will be called on the audio thread after the voice was rendered on a worker thread.
+	
+		Override this and perform all changes to the owner synth that you've deferred because isRenderingVoicesInParallel() returned true.
+	*/
+	virtual void handleDeferredParallelUpdates() {};
+
 
 	virtual void calculateBlock(int startSample, int numSamples) = 0;
 	
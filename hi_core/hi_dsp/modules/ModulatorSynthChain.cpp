@@ -172,6 +172,8 @@ void ModulatorSynthChain::prepareToPlay(double newSampleRate, int samplesPerBloc
 
 	if (ownedUniformVoiceHandler != nullptr)
         ownedUniformVoiceHandler->rebuildChildSynthList();
+
+	updateParallelBuffer();
 }
 
 void ModulatorSynthChain::numSourceChannelsChanged()
@@ -193,7 +195,7 @@ void ModulatorSynthChain::numSourceChannelsChanged()
 
 	ModulatorSynth::numSourceChannelsChanged();
 
-	
+	updateParallelBuffer();
 }
 
 void ModulatorSynthChain::numDestinationChannelsChanged()
@@ -206,6 +208,9 @@ ValueTree ModulatorSynthChain::exportAsValueTree() const
 {
 	ValueTree v = ModulatorSynth::exportAsValueTree();
 
+	if (useParallelRendering)
+		v.setProperty("ParallelRendering", true, nullptr);
+
 	if (this == getMainController()->getMainSynthChain())
 	{
 		v.setProperty("packageName", packageName, nullptr);
@@ -337,13 +342,16 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
 	ScopedAnalyser sa(getMainController(), this, internalBuffer, buffer.getNumSamples());
 
 	// Process the Synths and add store their output in the internal buffer
-	for (int i = 0; i < synths.size(); i++)
-    {
-		ScopedAnalyser sa(getMainController(), synths[i], internalBuffer, internalBuffer.getNumSamples());
+	if (!renderChildSynthsInParallel(numSamples))
+	{
+		for (int i = 0; i < synths.size(); i++)
+		{
+			ScopedAnalyser sa(getMainController(), synths[i], internalBuffer, internalBuffer.getNumSamples());
 
-        if (!synths[i]->isSoftBypassed())
-            synths[i]->renderNextBlockWithModulators(internalBuffer, eventBuffer);
-    }
+			if (!synths[i]->isSoftBypassed())
+				synths[i]->renderNextBlockWithModulators(internalBuffer, eventBuffer);
+		}
+	}
 
 	HiseEventBuffer::Iterator eventIterator(eventBuffer);
 
@@ -397,6 +405,129 @@ void ModulatorSynthChain::renderNextBlockWithModulators(AudioSampleBuffer &buffe
         ownedUniformVoiceHandler->cleanupAfterProcessing();
 }
 
+void ModulatorSynthChain::setUseParallelRendering(bool shouldRenderInParallel)
+{
+	if (useParallelRendering != shouldRenderInParallel)
+	{
+		useParallelRendering = shouldRenderInParallel;
+		updateParallelBuffer();
+		refreshParallelRenderingFlags();
+	}
+}
+
+void ModulatorSynthChain::updateParallelRenderingFlags()
+{
+	ModulatorSynth::updateParallelRenderingFlags();
+
+	if (useParallelRendering)
+	{
+		LockHelpers::SafeLock sl(getMainController(), LockHelpers::Type::IteratorLock, !getMainController()->isFlakyThreadingAllowed());
+
+		for (auto s : synths)
+			s->updateParallelRenderingFlags();
+	}
+}
+
+void ModulatorSynthChain::updateParallelBuffer()
+{
+	int numChannels = 0;
+	int numSamples = 0;
+
+	if (useParallelRendering && getMainController()->getRealtimeWorkerPool() != nullptr)
+	{
+		numChannels = getMatrix().getNumSourceChannels() * synths.size();
+		numSamples = getLargestBlockSize();
+	}
+
+	if (numSamples <= 0)
+		numChannels = 0;
+
+	if (numChannels == parallelBuffer.getNumChannels() && numSamples == parallelBuffer.getNumSamples())
+		return;
+
+	AudioSampleBuffer newBuffer(numChannels, numSamples);
+
+	LOCK_PROCESSING_CHAIN(this);
+	std::swap(parallelBuffer, newBuffer);
+}
+
+bool ModulatorSynthChain::renderChildSynthsInParallel(int numSamples)
+{
+	if (!useParallelRendering)
+		return false;
+
+	auto pool = getMainController()->getRealtimeWorkerPool();
+
+	if (pool == nullptr)
+		return false;
+
+	const int numChannels = internalBuffer.getNumChannels();
+
+	if (parallelBuffer.getNumChannels() < numChannels * synths.size() || parallelBuffer.getNumSamples() < numSamples)
+		return false;
+
+	int startIndex = 0;
+
+	while (startIndex < synths.size())
+	{
+		// Find the next range of sound generators that can be rendered in parallel
+		int numToRender = 0;
+
+		for (int i = startIndex; i < synths.size(); i++)
+		{
+			if (synths[i]->isSoftBypassed() || !synths[i]->canBeRenderedInParallel())
+				break;
+
+			// Render analysed sound generators serially so that the analyser gets its data
+			if (ScopedAnalyser::isAnalysed(getMainController(), synths[i]))
+				break;
+
+			numToRender++;
+		}
+
+		if (numToRender < 2)
+		{
+			auto s = synths[startIndex++];
+
+			ScopedAnalyser sa(getMainController(), s, internalBuffer, numSamples);
+
+			if (!s->isSoftBypassed())
+				s->renderNextBlockWithModulators(internalBuffer, eventBuffer);
+
+			continue;
+		}
+
+		auto renderChild = [&](int taskIndex)
+		{
+			AudioSampleBuffer b(parallelBuffer.getArrayOfWritePointers() + taskIndex * numChannels, numChannels, numSamples);
+			b.clear();
+
+			synths[startIndex + taskIndex]->renderNextBlockWithModulators(b, eventBuffer);
+		};
+
+		pool->parallelFor(numToRender, renderChild);
+
+		// Sum up the results in the original order. Every child adds to a destination
+		// channel only once, so the result is identical to the serial rendering.
+		for (int i = 0; i < numToRender; i++)
+		{
+			auto& m = synths[startIndex + i]->getMatrix();
+
+			for (int c = 0; c < m.getNumSourceChannels(); c++)
+			{
+				auto d = m.getConnectionForSourceChannel(c);
+
+				if (isPositiveAndBelow(d, numChannels))
+					FloatVectorOperations::add(internalBuffer.getWritePointer(d), parallelBuffer.getReadPointer(i * numChannels + d), numSamples);
+			}
+		}
+
+		startIndex += numToRender;
+	}
+
+	return true;
+}
+
 
 void ModulatorSynthChain::restoreFromValueTree(const ValueTree &v)
 {
@@ -404,6 +535,8 @@ void ModulatorSynthChain::restoreFromValueTree(const ValueTree &v)
 
 	ModulatorSynth::restoreFromValueTree(v);
 
+	setUseParallelRendering(v.getProperty("ParallelRendering", false));
+
 	if (!getMainController()->shouldSkipCompiling())
 	{
 		ValueTree autoData = v.getChildWithName("MidiAutomation");
@@ -716,6 +849,8 @@ void ModulatorSynthChain::ModulatorSynthChainHandler::add(Processor *newProcesso
 		synth->synths.insert(index, ms);
 	}
 
+	synth->updateParallelBuffer();
+
 	notifyListeners(Listener::ProcessorAdded, newProcessor);
 }
 
@@ -220,9 +220,33 @@ public:
 	void setUseUniformVoiceHandler(bool shouldUseVoiceHandler, UniformVoiceHandler* externalVoiceHandler) override;
 
     bool isUniformVoiceHandlerRoot() const;;
+
+	/** Enables the parallel rendering of the child sound generators.
+	
+		If this is enabled (and HISE_NUM_AUDIO_WORKER_THREADS is not zero), the child sound generators will be rendered
+		on the realtime worker pool into separate buffers that are summed up in the original order afterwards, so the output
+		is identical to the serial rendering. Sound generators that are not safe for parallel rendering (see
+		ModulatorSynth::isSafeForParallelRendering()) are rendered serially at their position in the chain. If the
+		project uses global cables or signals, all child sound generators are rendered serially.
+	*/
+	void setUseParallelRendering(bool shouldRenderInParallel);
+
+	bool isUsingParallelRendering() const noexcept { return useParallelRendering; }
+
+	/** Updates the cached flags of this container and its child sound generators. */
+	void updateParallelRenderingFlags() override;
 	
 private:
 
+	bool needsParallelRenderingFlags() const override { return useParallelRendering || ModulatorSynth::needsParallelRenderingFlags(); }
+
+	void updateParallelBuffer();
+
+	bool renderChildSynthsInParallel(int numSamples);
+
+	bool useParallelRendering = false;
+	AudioSampleBuffer parallelBuffer;
+
 	ScopedPointer<UniformVoiceHandler> ownedUniformVoiceHandler;
 
 	HiseEvent::ChannelFilterData activeChannels;
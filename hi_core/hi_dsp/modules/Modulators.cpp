@@ -333,7 +333,7 @@ TimeModulation::~TimeModulation()
 
 void TimeModulation::setScratchBuffer(float* scratchBuffer, int numSamples)
 {
-	internalBuffer.setDataToReferTo(&scratchBuffer, 1, numSamples);
+	internalBuffer->setDataToReferTo(&scratchBuffer, 1, numSamples);
 }
 
 double TimeModulation::getControlRate() const noexcept
@@ -344,8 +344,8 @@ VoiceModulation::~VoiceModulation()
 
 VoiceModulation::PolyphonyManager::PolyphonyManager(int voiceAmount_):
 	voiceAmount(voiceAmount_),
-	currentVoice(-1),
-	lastStartedVoice(0)
+	lastStartedVoice(0),
+	currentVoice(-1)
 {}
 
 int VoiceModulation::PolyphonyManager::getVoiceAmount() const
@@ -354,13 +354,13 @@ int VoiceModulation::PolyphonyManager::getVoiceAmount() const
 void VoiceModulation::PolyphonyManager::clearCurrentVoice() noexcept
 {
 	//jassert(currentVoice != -1);
-	currentVoice = -1;
+	currentVoice.get() = -1;
 }
 
 int VoiceModulation::PolyphonyManager::getCurrentVoice() const noexcept
 {
-	jassert (currentVoice != -1);
-	return currentVoice;
+	jassert (currentVoice.get() != -1);
+	return currentVoice.get();
 }
 
 #if JUCE_WINDOWS
@@ -380,7 +380,7 @@ VoiceModulation::VoiceModulation(int numVoices, Modulation::Mode m):
 void TimeModulation::applyTimeModulation(float* destinationBuffer, int startIndex, int samplesToCopy)
 {
 	float *dest = destinationBuffer + startIndex;
-	float *mod = internalBuffer.getWritePointer(0, startIndex);
+	float *mod = internalBuffer->getWritePointer(0, startIndex);
 
 	if (smoothedIntensity.isSmoothing())
 	{
@@ -421,15 +421,14 @@ void TimeModulation::applyTimeModulation(float* destinationBuffer, int startInde
 
 const float * TimeModulation::getCalculatedValues(int /*voiceIndex*/)
 {
-	return internalBuffer.getReadPointer(0);
+	return internalBuffer->getReadPointer(0);
 }
 
 #pragma warning (push)
 #pragma warning (disable: 4589)
 
 TimeModulation::TimeModulation(Mode m) :
-    Modulation(m),
-	internalBuffer(0, 0)
+    Modulation(m)
 {
 }
 
@@ -945,10 +944,10 @@ void VoiceModulation::allNotesOff()
 
 void VoiceModulation::PolyphonyManager::setCurrentVoice(int newCurrentVoice) noexcept
 {
-	jassert(currentVoice == -1);
-	jassert(currentVoice < voiceAmount);
+	jassert(currentVoice.get() == -1);
+	jassert(newCurrentVoice < voiceAmount);
 
-	currentVoice = newCurrentVoice;
+	currentVoice.get() = newCurrentVoice;
 }
 
 void VoiceModulation::PolyphonyManager::setLastStartedVoice(int voiceIndex)
@@ -1062,6 +1061,7 @@ void EnvelopeModulator::setInternalAttribute(int parameterIndex, float newValue)
 	switch (parameterIndex)
 	{
 	case Parameters::Monophonic: isMonophonic = newValue > 0.5f; 
+		getMainController()->bumpModuleTreeRevision();
 		sendSynchronousBypassChangeMessage();
 		break;
 	case Parameters::Retrigger:  shouldRetrigger = newValue > 0.5f; break;
@@ -1260,8 +1260,8 @@ void TimeVariantModulator::render(float* monoModulationValues, float* scratchBuf
 	lastConstantValue = monoModulationValues[startSample];
 
 #if ENABLE_ALL_PEAK_METERS
-	const float displayValue = internalBuffer.getSample(0, startSample);
-	pushPlotterValues(internalBuffer.getReadPointer(0), startSample, numSamples);
+	const float displayValue = internalBuffer->getSample(0, startSample);
+	pushPlotterValues(internalBuffer->getReadPointer(0), startSample, numSamples);
 
 	setOutputValue(displayValue);
 #endif
@@ -173,6 +173,9 @@ public:
 
 	void deactivateIntensitySmoothing();
 
+	/** Returns true if the intensity is currently ramping towards a new value. */
+	bool isIntensitySmoothing() const noexcept { return smoothedIntensity.isSmoothing(); }
+
 	virtual void setMode(Mode newMode, NotificationType n=dontSendNotification);
 
 	LambdaBroadcaster<int> modeBroadcaster;
@@ -364,7 +367,9 @@ protected:
 	}
 #endif
 
-	AudioSampleBuffer internalBuffer;
+	/** The buffer that is used by calculateBlock(). There's one for every lane of the RealtimeWorkerPool, so that
+		multiple voices can be rendered at the same time. */
+	LaneLocal<AudioSampleBuffer> internalBuffer;
 
 	double getControlRate() const noexcept;;
 
@@ -427,7 +432,7 @@ public:
 
 		int lastStartedVoice;
 
-		int currentVoice;
+		LaneLocal<int> currentVoice;
 		const int voiceAmount;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(PolyphonyManager)
@@ -620,6 +625,13 @@ public:
 
 	void render(int voiceIndex, float* voiceBuffer, float* scratchBuffer, int startSample, int numSamples);
 
+	/** Overwrite this and return true if the envelope can be rendered for different voices at the same time.
+	
+		This requires that calculateBlock() only writes to the state of the current voice and uses the
+		internal buffer of the current rendering lane (see RealtimeWorkerPool::LaneLocal).
+	*/
+	virtual bool isSafeForVoiceParallelRendering() const { return false; }
+
 protected:
 
 	int getNumPressedKeys() const;
@@ -170,7 +170,7 @@ void FilterBank::setType(FilterHelpers::FilterSubType newType, int filterSubType
 	
 
 	{
-		SpinLock::ScopedLockType sl(lock);
+		SimpleReadWriteLock::ScopedMultiWriteLock sl(lock);
 		type = newType;
 		subType = filterSubType;
 		object.swapWith(newObject);
@@ -189,7 +189,7 @@ void FilterBank::setType(FilterHelpers::FilterSubType newType, int filterSubType
 
 void FilterBank::renderPoly(FilterHelpers::RenderData& r)
 {
-	SpinLock::ScopedLockType sl(lock);
+	SimpleReadWriteLock::ScopedReadLock sl(lock);
 
 	switch (type)
 	{
@@ -208,7 +208,7 @@ void FilterBank::renderPoly(FilterHelpers::RenderData& r)
 
 void FilterBank::renderMono(FilterHelpers::RenderData& r)
 {
-	SpinLock::ScopedLockType sl(lock);
+	SimpleReadWriteLock::ScopedReadLock sl(lock);
 
 	switch (type)
 	{
@@ -235,7 +235,7 @@ void FilterBank::renderMono(FilterHelpers::RenderData& r)
 
 void FilterBank::reset(int voiceIndex)
 {
-	SpinLock::ScopedLockType sl(lock);
+	SimpleReadWriteLock::ScopedReadLock sl(lock);
 
 	switch (type)
 	{
@@ -253,7 +253,7 @@ void FilterBank::reset(int voiceIndex)
 
 void FilterBank::reset()
 {
-	SpinLock::ScopedLockType sl(lock);
+	SimpleReadWriteLock::ScopedReadLock sl(lock);
 
 	switch (type)
 	{
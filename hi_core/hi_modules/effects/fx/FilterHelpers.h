@@ -119,13 +119,13 @@ public:
 
 	void setSmoothingTime(double newSmoothingTime)
 	{
-		SpinLock::ScopedLockType sl(lock);
+		SimpleReadWriteLock::ScopedMultiWriteLock sl(lock);
 		object->setSmoothingTime(jlimit(0.0, 1.0, newSmoothingTime));
 	}
 
 	void setSampleRate(double newSampleRate)
 	{
-		SpinLock::ScopedLockType sl(lock);
+		SimpleReadWriteLock::ScopedMultiWriteLock sl(lock);
 
 		object->setSampleRate(newSampleRate);
 	}
@@ -296,7 +296,9 @@ private:
 		return static_cast<InternalMonoBank<FilterType>*>(object.get());
 	}
 
-	SpinLock lock;
+	// The voices of a polyphonic filter can be rendered on multiple threads, so the
+	// rendering only acquires a read lock (the filter type changes take the write lock).
+	SimpleReadWriteLock lock;
 
 	FilterMode mode;
 
@@ -391,6 +391,7 @@ void PolyFilterEffect::processorChanged(EventType /*t*/, Processor* /*p*/)
 
 	if (polyMode != before)
 	{
+		getMainController()->bumpModuleTreeRevision();
 		setInternalAttribute(PolyFilterEffect::Parameters::Frequency, frequency);
 		setInternalAttribute(PolyFilterEffect::Parameters::Q, q);
 		setInternalAttribute(PolyFilterEffect::Parameters::Gain, gain);
@@ -450,7 +451,9 @@ void PolyFilterEffect::setInternalAttribute(int parameterIndex, float newValue)
 		break;
     case PolyFilterEffect::Quality:		setRenderQuality((int)newValue); break;
 	case PolyFilterEffect::BipolarIntensity: bipolarParameterValue = jlimit<float>(-1.0f, 1.0f, newValue);
-										bipolarIntensity.setTargetValue(bipolarParameterValue); break;
+										bipolarIntensity.setTargetValue(bipolarParameterValue);
+										// The smoothing is shared between the voices, so they must be rendered serially until it's done
+										getMainController()->bumpModuleTreeRevision(); break;
 	default:							jassertfalse; return;
 	}
 
@@ -206,6 +206,8 @@ public:
 
 	bool hasPolyMods() const noexcept;
 
+	bool isSafeForVoiceParallelRendering() const override { return hasPolyMods() && !bipolarIntensity.isSmoothing(); }
+
 private:
 
 	
@@ -120,6 +120,9 @@ struct SendContainer : public ModulatorSynth
 		prepareToPlay(getSampleRate(), getLargestBlockSize());
 	}
 
+	/** The send effects of other sound generators write into the internal buffer. */
+	bool isSafeForParallelRendering() const override { return false; }
+
 	float getAttribute(int) const override { return 1.0f; };
 	void setInternalAttribute(int, float) override {};
 
@@ -1275,7 +1275,7 @@ void HardcodedTimeVariantModulator::calculateBlock(int startSample, int numSampl
 
     if(opaqueNode != nullptr && channelCountMatches)
     {
-		auto* modData = internalBuffer.getWritePointer(0, startSample);
+		auto* modData = internalBuffer->getWritePointer(0, startSample);
         FloatVectorOperations::clear(modData, numSamples);
         
         ProcessDataDyn d(&modData, numSamples, 1);
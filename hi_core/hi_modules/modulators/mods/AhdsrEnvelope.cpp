@@ -143,6 +143,8 @@ float AhdsrEnvelope::startVoice(int voiceIndex)
 	stateInfo.state = AhdsrEnvelopeState::ATTACK;
 	stateInfo.changeTime = getMainController()->getUptime();
 
+	AhdsrEnvelopeState* state;
+
 	if (isMonophonic)
 	{
 		state = static_cast<AhdsrEnvelopeState*>(monophonicState.get());
@@ -236,6 +238,8 @@ void AhdsrEnvelope::calculateBlock(int startSample, int numSamples)
 
 	jassert(voiceIndex < states.size());
 
+	AhdsrEnvelopeState* state;
+
 	if (isMonophonic)
 		state = static_cast<AhdsrEnvelopeState*>(monophonicState.get());
 	else
@@ -251,7 +255,7 @@ void AhdsrEnvelope::calculateBlock(int startSample, int numSamples)
 		if (FloatSanitizers::isNotSilence(thisSustainValue - lastSustainValue))
 		{
 			const float stepSize = (thisSustainValue - lastSustainValue) / (float)numSamples;
-			float* bufferPointer = internalBuffer.getWritePointer(0, startSample);
+			float* bufferPointer = internalBuffer->getWritePointer(0, startSample);
 			float rampedGain = lastSustainValue;
 
 			for (int i = 0; i < numSamples; i++)
@@ -263,7 +267,7 @@ void AhdsrEnvelope::calculateBlock(int startSample, int numSamples)
 		}
 		else
 		{
-			FloatVectorOperations::fill(internalBuffer.getWritePointer(0, startSample), thisSustainValue, numSamples);
+			FloatVectorOperations::fill(internalBuffer->getWritePointer(0, startSample), thisSustainValue, numSamples);
 			startSample += numSamples;
 		}
 
@@ -274,7 +278,7 @@ void AhdsrEnvelope::calculateBlock(int startSample, int numSamples)
 	{
 		while (numSamples > 0)
 		{
-			internalBuffer.setSample(0, startSample, calculateNewValue(voiceIndex));
+			internalBuffer->setSample(0, startSample, state->tick());
 			++startSample;
 			numSamples--;
 		}
@@ -316,7 +320,7 @@ void AhdsrEnvelope::reset(int voiceIndex)
 		if (voiceIndex == polyManager.getLastStartedVoice())
 			stateInfo.state = AhdsrEnvelopeState::IDLE;
 
-		state = static_cast<AhdsrEnvelopeState*>(states[voiceIndex]);
+		auto state = static_cast<AhdsrEnvelopeState*>(states[voiceIndex]);
 		state->current_state = AhdsrEnvelopeState::IDLE;
 		state->current_value = 0.0f;
 	}
@@ -441,9 +445,12 @@ EnvelopeModulator::ModulatorState * AhdsrEnvelope::createSubclassedState(int voi
 	return new AhdsrEnvelopeState(voiceIndex, this);
 }
 
-float AhdsrEnvelope::calculateNewValue(int /*voiceIndex*/)
+float AhdsrEnvelope::calculateNewValue(int voiceIndex)
 {
-	return state->tick();
+	if (isMonophonic)
+		return static_cast<AhdsrEnvelopeState*>(monophonicState.get())->tick();
+
+	return static_cast<AhdsrEnvelopeState*>(states[voiceIndex])->tick();
 }
 
 
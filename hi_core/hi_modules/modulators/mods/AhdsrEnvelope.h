@@ -138,6 +138,8 @@ public:
 
 	/** @brief returns \c true, if the envelope is not IDLE and not bypassed. */
 	bool isPlaying(int voiceIndex) const override;;
+
+	bool isSafeForVoiceParallelRendering() const override { return true; }
     
 	ModulatorState *createSubclassedState(int voiceIndex) const override;;
 
@@ -192,7 +194,6 @@ private:
 	};
 
 	StateInfo stateInfo;
-	AhdsrEnvelopeState *state;
 
 	ModulatorChain::Collection internalChains;
 
@@ -194,14 +194,14 @@ void ControlModulator::calculateBlock(int startSample, int numSamples)
 		while (--numSamples >= 0)
 		{
 			currentValue = smoother.smooth(targetValue);
-			internalBuffer.setSample(0, startSample, currentValue);
+			internalBuffer->setSample(0, startSample, currentValue);
 			++startSample;
 		}
 	}
 	else
 	{
 		currentValue = targetValue;
-		FloatVectorOperations::fill(internalBuffer.getWritePointer(0, startSample), currentValue, numSamples);
+		FloatVectorOperations::fill(internalBuffer->getWritePointer(0, startSample), currentValue, numSamples);
 	}
 
 	if (useTable && lastInputValue != inputValue)
@@ -290,11 +290,11 @@ void EventDataEnvelope::calculateBlock(int startSample, int numSamples)
 	if (!state->rampValue.isActive())
 	{
 		auto v = state->rampValue.get();
-		FloatVectorOperations::fill(internalBuffer.getWritePointer(0, startSample), v, numSamples);
+		FloatVectorOperations::fill(internalBuffer->getWritePointer(0, startSample), v, numSamples);
 	}
 	else
 	{
-		float *out = internalBuffer.getWritePointer(0, startSample);
+		float *out = internalBuffer->getWritePointer(0, startSample);
 
 		while (--numSamples >= 0)
 				*out++ = state->rampValue.advance();
@@ -531,7 +531,7 @@ void GlobalTimeVariantModulator::calculateBlock(int startSample, int numSamples)
                 
                 while (--numSamples >= 0)
                 {
-                    internalBuffer.setSample(0, startSample++, table->getInterpolatedValue(data[i++], dontSendNotification));
+                    internalBuffer->setSample(0, startSample++, table->getInterpolatedValue(data[i++], dontSendNotification));
                 }
                 
 				if(numSamples > 0)
@@ -539,7 +539,7 @@ void GlobalTimeVariantModulator::calculateBlock(int startSample, int numSamples)
                 
                 
 				table->setNormalisedIndexSync(thisInputValue);
-                setOutputValue(internalBuffer.getSample(0, startIndex));
+                setOutputValue(internalBuffer->getSample(0, startIndex));
                 
                 return;
             }
@@ -548,17 +548,17 @@ void GlobalTimeVariantModulator::calculateBlock(int startSample, int numSamples)
 		{
             if(auto src = getConnectedContainer()->getModulationValuesForModulator(getOriginalModulator(), startSample))
             {
-                FloatVectorOperations::copy(internalBuffer.getWritePointer(0, startSample), src, numSamples);
+                FloatVectorOperations::copy(internalBuffer->getWritePointer(0, startSample), src, numSamples);
                 invertBuffer(startSample, numSamples);
                 
-                setOutputValue(internalBuffer.getSample(0, startSample));
+                setOutputValue(internalBuffer->getSample(0, startSample));
                 
                 return;
             }
 		}
 	}
 	
-    FloatVectorOperations::fill(internalBuffer.getWritePointer(0, startSample), 1.0f, numSamples);
+    FloatVectorOperations::fill(internalBuffer->getWritePointer(0, startSample), 1.0f, numSamples);
     setOutputValue(1.0f);
 }
 
@@ -566,7 +566,7 @@ void GlobalTimeVariantModulator::invertBuffer(int startSample, int numSamples)
 {
 	if (inverted)
 	{
-		float* d = internalBuffer.getWritePointer(0, startSample);
+		float* d = internalBuffer->getWritePointer(0, startSample);
 		FloatVectorOperations::multiply(d, -1.0f, numSamples);
 		FloatVectorOperations::add(d, 1.0f, numSamples);
 	}
@@ -694,7 +694,7 @@ void GlobalEnvelopeModulator::calculateBlock(int startSample, int numSamples)
 
 				while (--numSamples >= 0)
 				{
-					internalBuffer.setSample(0, startSample++, table->getInterpolatedValue(data[i++], dontSendNotification));
+					internalBuffer->setSample(0, startSample++, table->getInterpolatedValue(data[i++], dontSendNotification));
 				}
 
 #if 0
@@ -704,7 +704,7 @@ void GlobalEnvelopeModulator::calculateBlock(int startSample, int numSamples)
 
 
 				table->setNormalisedIndexSync(thisInputValue);
-				setOutputValue(internalBuffer.getSample(0, startIndex));
+				setOutputValue(internalBuffer->getSample(0, startIndex));
 
 				return;
 			}
@@ -713,10 +713,10 @@ void GlobalEnvelopeModulator::calculateBlock(int startSample, int numSamples)
 		{
 			if (auto src = getConnectedContainer()->getEnvelopeValuesForModulator(getOriginalModulator(), startSample, voiceIndex))
 			{
-				FloatVectorOperations::copy(internalBuffer.getWritePointer(0, startSample), src, numSamples);
+				FloatVectorOperations::copy(internalBuffer->getWritePointer(0, startSample), src, numSamples);
 				//invertBuffer(startSample, numSamples);
 
-				setOutputValue(internalBuffer.getSample(0, startSample));
+				setOutputValue(internalBuffer->getSample(0, startSample));
 
 				return;
 			}
@@ -725,7 +725,7 @@ void GlobalEnvelopeModulator::calculateBlock(int startSample, int numSamples)
 	else
 	{
 		auto v = Modulation::getInitialValue();
-		FloatVectorOperations::fill(internalBuffer.getWritePointer(0, startSample), v, numSamples);
+		FloatVectorOperations::fill(internalBuffer->getWritePointer(0, startSample), v, numSamples);
 		setOutputValue(v);
 	}
 
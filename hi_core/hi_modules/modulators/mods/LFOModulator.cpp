@@ -595,7 +595,7 @@ void LfoModulator::calculateBlock(int startSample, int numSamples)
 	const int startIndex = startSample;
 	const int numValues = numSamples;
 
-	auto* modData = internalBuffer.getWritePointer(0, startSample);
+	auto* modData = internalBuffer->getWritePointer(0, startSample);
 
 #if 0
 	if (syncToMasterClock && tempoSync)
@@ -623,7 +623,7 @@ void LfoModulator::calculateBlock(int startSample, int numSamples)
 		getTableUnchecked(0)->setNormalisedIndexSync(isLooped ? newInputValue : 1.0f);
 	}
 
-	float *mod = internalBuffer.getWritePointer(0, startIndex);
+	float *mod = internalBuffer->getWritePointer(0, startIndex);
 
 	const int pseudoOffset = startIndex * HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
 	const int pseudoSize = numValues * HISE_CONTROL_RATE_DOWNSAMPLING_FACTOR;
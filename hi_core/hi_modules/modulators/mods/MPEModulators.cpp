@@ -457,7 +457,7 @@ void MPEModulator::calculateBlock(int startSample, int numSamples)
 
 	if (auto s = getState(voiceIndex))
 	{
-		auto w = internalBuffer.getWritePointer(0, startSample);
+		auto w = internalBuffer->getWritePointer(0, startSample);
 
 		s->process(w, numSamples);
 
@@ -190,7 +190,7 @@ void MacroModulator::calculateBlock(int startSample, int numSamples)
 		while (--numSamples >= 0)
 		{
 			currentValue = smoother.smooth(targetValue);
-			internalBuffer.setSample(0, startSample, currentValue);
+			internalBuffer->setSample(0, startSample, currentValue);
 			++startSample;
 		}
 	}
@@ -198,7 +198,7 @@ void MacroModulator::calculateBlock(int startSample, int numSamples)
 	{
 		currentValue = targetValue;
 
-		FloatVectorOperations::fill(internalBuffer.getWritePointer(0, startSample), currentValue, numSamples);
+		FloatVectorOperations::fill(internalBuffer->getWritePointer(0, startSample), currentValue, numSamples);
 	}
 
 }
@@ -176,7 +176,7 @@ float SimpleEnvelope::startVoice(int voiceIndex)
 
 		if (restartEnvelope)
 		{
-			state = static_cast<SimpleEnvelopeState*>(monophonicState.get());
+			auto s = static_cast<SimpleEnvelopeState*>(monophonicState.get());
 
 			float attackModValue = 1.0f;
 
@@ -189,30 +189,30 @@ float SimpleEnvelope::startVoice(int voiceIndex)
 			const float thisAttackTime = attack * attackModValue;
 
 			if (linearMode)
-				state->attackDelta = this->calcCoefficient(thisAttackTime);
+				s->attackDelta = this->calcCoefficient(thisAttackTime);
 			else
-				setAttackRate(thisAttackTime, state);
+				setAttackRate(thisAttackTime, s);
 
 			// Don't reset the envelope for tailing releases
 			if (shouldRetrigger)
 			{
-				state->current_state = SimpleEnvelopeState::RETRIGGER;
+				s->current_state = SimpleEnvelopeState::RETRIGGER;
 			}
 			else
 			{
-				state->current_state = SimpleEnvelopeState::ATTACK;
+				s->current_state = SimpleEnvelopeState::ATTACK;
 			}
 
 			return thisAttackTime > 0.0f ? 0.0f : 1.0f;
 		}
 
-		return state->current_value;
+		return static_cast<SimpleEnvelopeState*>(monophonicState.get())->current_value;
 	}
 	else
 	{
-		state = static_cast<SimpleEnvelopeState*>(states[voiceIndex]);
+		auto s = static_cast<SimpleEnvelopeState*>(states[voiceIndex]);
 
-		if (state->current_state != SimpleEnvelopeState::IDLE)
+		if (s->current_state != SimpleEnvelopeState::IDLE)
 			reset(voiceIndex);
 
 		float attackModValue = 1.0f;
@@ -226,11 +226,11 @@ float SimpleEnvelope::startVoice(int voiceIndex)
 		const float thisAttackTime = attack * attackModValue;
 
 		if (linearMode)
-			state->attackDelta = this->calcCoefficient(thisAttackTime);
+			s->attackDelta = this->calcCoefficient(thisAttackTime);
 		else
-			setAttackRate(thisAttackTime, state);
+			setAttackRate(thisAttackTime, s);
 
-		state->current_state = SimpleEnvelopeState::ATTACK;
+		s->current_state = SimpleEnvelopeState::ATTACK;
 
 		return thisAttackTime > 0.0f ? 0.0f : 1.0f;
 	}
@@ -298,33 +298,35 @@ void SimpleEnvelope::calculateBlock(int startSample, int numSamples)
 
 	jassert(voiceIndex < states.size());
 
+	SimpleEnvelopeState* s;
+
 	if(isMonophonic)
-		state = static_cast<SimpleEnvelopeState*>(monophonicState.get());
+		s = static_cast<SimpleEnvelopeState*>(monophonicState.get());
 	else
-		state = static_cast<SimpleEnvelopeState*>(states[voiceIndex]);
+		s = static_cast<SimpleEnvelopeState*>(states[voiceIndex]);
 
-	if (state->current_state == SimpleEnvelopeState::SUSTAIN)
+	if (s->current_state == SimpleEnvelopeState::SUSTAIN)
 	{
-		FloatVectorOperations::fill(internalBuffer.getWritePointer(0, startSample), 1.0f, numSamples);
+		FloatVectorOperations::fill(internalBuffer->getWritePointer(0, startSample), 1.0f, numSamples);
 	}
-	else if (state->current_state == SimpleEnvelopeState::IDLE)
+	else if (s->current_state == SimpleEnvelopeState::IDLE)
 	{
-		FloatVectorOperations::fill(internalBuffer.getWritePointer(0, startSample), 0.0f, numSamples);
+		FloatVectorOperations::fill(internalBuffer->getWritePointer(0, startSample), 0.0f, numSamples);
 	}
 	else
 	{
 		
-		float *out = internalBuffer.getWritePointer(0, startSample);
+		float *out = internalBuffer->getWritePointer(0, startSample);
 		
 		if (linearMode)
 		{
 			while (--numSamples >= 0)
-				*out++ = calculateNewValue(voiceIndex);
+				*out++ = calculateNewValue(s);
 		}
 		else
 		{
 			while (--numSamples >= 0)
-				*out++ = calculateNewExpValue();
+				*out++ = calculateNewExpValue(s);
 		}
 	}
 }
@@ -382,95 +384,95 @@ float SimpleEnvelope::calcCoefficient(float time, float targetRatio/*=1.0f*/) co
 	}
 }
 
-float SimpleEnvelope::calculateNewValue(int voiceIndex)
+float SimpleEnvelope::calculateNewValue(SimpleEnvelopeState* s)
 {
-	switch (state->current_state)
+	switch (s->current_state)
 	{
 	
 	case SimpleEnvelopeState::SUSTAIN: break;
 	case SimpleEnvelopeState::IDLE: break;
 	case SimpleEnvelopeState::ATTACK:
-		state->current_value += state->attackDelta;
-		if (state->current_value >= 1.0f)
+		s->current_value += s->attackDelta;
+		if (s->current_value >= 1.0f)
 		{
-			state->current_value = 1.0f;
-			state->current_state = SimpleEnvelopeState::SUSTAIN;
+			s->current_value = 1.0f;
+			s->current_state = SimpleEnvelopeState::SUSTAIN;
 		}
 		break;
 	case SimpleEnvelopeState::RETRIGGER:
 	{
 #if HISE_RAMP_RETRIGGER_ENVELOPES_FROM_ZERO
-		state->current_value -= 0.005f;
-		if (state->current_value <= 0.0f)
+		s->current_value -= 0.005f;
+		if (s->current_value <= 0.0f)
 		{
-			state->current_value = 0.0f;
-			state->current_state = SimpleEnvelopeState::ATTACK;
+			s->current_value = 0.0f;
+			s->current_state = SimpleEnvelopeState::ATTACK;
 		}
 		break;
 #else
-		state->current_state = SimpleEnvelopeState::ATTACK;
-		return calculateNewValue(voiceIndex);
+		s->current_state = SimpleEnvelopeState::ATTACK;
+		return calculateNewValue(s);
 #endif
 	}
 	case SimpleEnvelopeState::RELEASE:
-		state->current_value -= release_delta;
-		if (state->current_value <= 0.0f)
+		s->current_value -= release_delta;
+		if (s->current_value <= 0.0f)
 		{
-			state->current_value = 0.0f;
-			state->current_state = SimpleEnvelopeState::IDLE;
+			s->current_value = 0.0f;
+			s->current_state = SimpleEnvelopeState::IDLE;
 		}
 		break;
 	default:					    jassertfalse; break;
 	}
 
-	return state->current_value;
+	return s->current_value;
 }
 
-float SimpleEnvelope::calculateNewExpValue()
+float SimpleEnvelope::calculateNewExpValue(SimpleEnvelopeState* s)
 {
-	switch (state->current_state)
+	switch (s->current_state)
 	{
 	case SimpleEnvelopeState::SUSTAIN: break;
 	case SimpleEnvelopeState::IDLE: break;
 	case SimpleEnvelopeState::RETRIGGER:
 	{
 #if HISE_RAMP_RETRIGGER_ENVELOPES_FROM_ZERO
-		state->current_value -= 0.005f;
-		if (state->current_value <= 0.0f)
+		s->current_value -= 0.005f;
+		if (s->current_value <= 0.0f)
 		{
-			state->current_value = 0.0f;
-			state->current_state = SimpleEnvelopeState::ATTACK;
+			s->current_value = 0.0f;
+			s->current_state = SimpleEnvelopeState::ATTACK;
 		}
 #else
-		state->current_state = SimpleEnvelopeState::ATTACK;
-		return calculateNewExpValue();
+		s->current_state = SimpleEnvelopeState::ATTACK;
+		return calculateNewExpValue(s);
 #endif
 		break;
 	}
 	case SimpleEnvelopeState::ATTACK:
 		
-		state->current_value = state->expAttackBase + state->current_value * state->expAttackCoef;
+		s->current_value = s->expAttackBase + s->current_value * s->expAttackCoef;
 
 		
 
-		if (state->current_value >= 1.0f)
+		if (s->current_value >= 1.0f)
 		{
-			state->current_value = 1.0f;
-			state->current_state = SimpleEnvelopeState::SUSTAIN;
+			s->current_value = 1.0f;
+			s->current_state = SimpleEnvelopeState::SUSTAIN;
 		}
 		break;
 	case SimpleEnvelopeState::RELEASE:
-		state->current_value = expReleaseBase + state->current_value * expReleaseCoef;
+		s->current_value = expReleaseBase + s->current_value * expReleaseCoef;
 
-		if (state->current_value <= 0.0001f){
-			state->current_value = 0.0f;
-			state->current_state = SimpleEnvelopeState::IDLE;
+		if (s->current_value <= 0.0001f){
+			s->current_value = 0.0f;
+			s->current_state = SimpleEnvelopeState::IDLE;
 		}
 		break;
 	default:					    jassertfalse; break;
 	}
 
-	return state->current_value;
+	return s->current_value;
 }
 
 
@@ -99,6 +99,8 @@ public:
 	void reset(int voiceIndex) override;
 	bool isPlaying(int voiceIndex) const override;
 
+	bool isSafeForVoiceParallelRendering() const override { return true; }
+
 	void prepareToPlay(double sampleRate, int samplesPerBlock) override;
 	void calculateBlock(int startSample, int numSamples) override;
 	void handleHiseEvent(const HiseEvent& m) override;
@@ -158,8 +160,8 @@ private:
 	
 	The calculation is linear and not logarithmic, so it may be sounding cheep
 	*/
-	float calculateNewValue(int voiceIndex);
-	float calculateNewExpValue();
+	float calculateNewValue(SimpleEnvelopeState* s);
+	float calculateNewExpValue(SimpleEnvelopeState* s);
 
 	float inputValue;
 	float attack;
@@ -178,8 +180,6 @@ private:
 
 	ScopedPointer<ModulatorChain> attackChain;
 
-	SimpleEnvelopeState *state;
-
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SimpleEnvelope);
 	JUCE_DECLARE_WEAK_REFERENCEABLE(SimpleEnvelope);
 };
@@ -201,7 +201,7 @@ void TableEnvelope::calculateBlock(int startSample, int numSamples)
 
 	while (--numSamples >= 0)
 	{
-		internalBuffer.setSample(0, startSample, calculateNewValue(voiceIndex));
+		internalBuffer->setSample(0, startSample, calculateNewValue(voiceIndex));
 		++startSample;
 	}
 
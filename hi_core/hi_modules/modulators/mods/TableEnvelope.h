@@ -186,6 +186,8 @@ public:
 	/** @brief returns \c true, if the envelope is not IDLE and not bypassed. */
 	bool isPlaying(int voiceIndex) const override;;
 
+	bool isSafeForVoiceParallelRendering() const override { return true; }
+
 	/** @internal The container for the envelope state. */
     struct TableEnvelopeState: public EnvelopeModulator::ModulatorState
 	{
@@ -384,6 +384,9 @@ public:
 	float getVoiceStartValueFor(const Processor *voiceStartModulator);
 
     int getNumActiveVoices() const override { return 0; };
+
+	/** The other sound generators depend on the modulation values, so this must always be rendered first. */
+	bool isSafeForParallelRendering() const override { return false; }
     
 	GlobalModulatorContainer(MainController *mc, const String &id, int numVoices);;
 
@@ -75,6 +75,9 @@ public:
 	SET_PROCESSOR_NAME("MacroModulationSource", "Macro Modulation Source", "A container that processes Modulator instances that can be used as modulation sources for the macro control system");
 
 	int getNumActiveVoices() const override { return 0; };
+
+	/** This changes the macro values of other processors, so it must not be rendered in parallel. */
+	bool isSafeForParallelRendering() const override { return false; }
     
 	void processorChanged(Chain::Handler::Listener::EventType t, Processor* p) override
 	{
@@ -123,6 +123,8 @@ public:
 
 	SineSynth(MainController *mc, const String &id, int numVoices);;
 
+	bool isSafeForVoiceParallelRendering() const override { return checkVoiceParallelRenderingContract(); }
+
 	void restoreFromValueTree(const ValueTree &v) override
 	{
 		ModulatorSynth::restoreFromValueTree(v);
@@ -597,69 +597,146 @@ String WavetableSound::getMarkdownDescription() const
 void WavetableSound::RenderData::render(WavetableSound* currentSound, double& voiceUptime, const TableIndexFunction& tf)
 {
 	auto numTables = currentSound->getWavetableAmount();
-	auto stereoMode = currentSound->isStereo();
+	auto numChannels = currentSound->isStereo() ? 2 : 1;
 	auto tableSize = currentSound->getTableSize();
 
 	dynamicPhase = currentSound->dynamicPhase;
 
-	while (--numSamples >= 0)
+	ChunkData d;
+
+	while (numSamples > 0)
 	{
-		int index = (int)voiceUptime;
+		d.numSamples = jmin(numSamples, ChunkSize);
+
+		// The phase accumulation has to run sequentially because of the pitch modulation...
+		for (int s = 0; s < d.numSamples; s++)
+		{
+			const int index = (int)voiceUptime;
+
+			d.index[s] = index;
+			d.alpha[s] = float(voiceUptime) - (float)index;
+
+			jassert(voicePitchValues == nullptr || voicePitchValues[startSample + s] > 0.0f);
 
-		span<int, 4> i;
+			voiceUptime += (uptimeDelta * (voicePitchValues == nullptr ? 1.0 : voicePitchValues[startSample + s]));
+		}
 
+		// ...but the index wrapping can be vectorised
 #if USE_MOD2_WAVETABLESIZE
-		i[0] = (index + tableSize - 1) & (tableSize - 1);
-		i[1] = index & (tableSize - 1);
-		i[2] = (index + 1) & (tableSize - 1);
-		i[3] = (index + 2) & (tableSize - 1);
+		const int mask = tableSize - 1;
+
+		for (int s = 0; s < d.numSamples; s++)
+			d.index[s] &= mask;
 #else
-		i[1] = index % (tableSize);
-		i[2] = i[1] + 1;
-		i[0] = i[1] - 1;
-		i[3] = i[1] + 2;
+		for (int s = 0; s < d.numSamples; s++)
+			d.index[s] %= tableSize;
+#endif
 
-		if (i[1] == 0)         i[0] = tableSize - 1;
-		if (i[2] >= tableSize) i[2] = 0;
-		if (i[3] >= tableSize) i[3] = 0;
+		bool constantTable = true;
 
-#endif
+		for (int s = 0; s < d.numSamples; s++)
+		{
+			d.tableValue[s] = tf(startSample + s) * (float)(numTables - 1);
+			constantTable &= (d.tableValue[s] == d.tableValue[0]);
+		}
 
-		const float tableModValue = tf(startSample);
-		const float tableValue = tableModValue * (float)(numTables - 1);
+		for (int c = 0; c < numChannels; c++)
+		{
+			auto dst = b.getWritePointer(c, startSample);
 
-		const int lowerTableIndex = (int)(tableValue);
+			if (constantTable)
+			{
+				renderConstantTable(currentSound, c, d, dst);
+				continue;
+			}
 
-		const float tableDelta = tableValue - (float)lowerTableIndex;
-		jassert(0.0f <= tableDelta && tableDelta <= 1.0f);
+			for (int s = 0; s < d.numSamples; s++)
+			{
+				const int lowerTableIndex = (int)d.tableValue[s];
+				const float tableDelta = d.tableValue[s] - (float)lowerTableIndex;
+				jassert(0.0f <= tableDelta && tableDelta <= 1.0f);
 
-		const int upperTableIndex = jmin(numTables - 1, lowerTableIndex + 1);
+				const int upperTableIndex = jmin(numTables - 1, lowerTableIndex + 1);
 
-		auto lowerTable = currentSound->getWaveTableData(0, lowerTableIndex);
-		auto upperTable = currentSound->getWaveTableData(0, upperTableIndex);
-		const float alpha = float(voiceUptime) - (float)index;
+				auto lowerTable = currentSound->getWaveTableData(c, lowerTableIndex);
+				auto upperTable = currentSound->getWaveTableData(c, upperTableIndex);
 
-		auto l = calculateSample(lowerTable, upperTable, i, alpha, tableDelta);
+				dst[s] = calculateSample(lowerTable, upperTable, getTaps(d.index[s], tableSize), d.alpha[s], tableDelta);
+			}
+		}
 
-		// Stereo mode assumed
-		b.setSample(0, startSample, l);
+		startSample += d.numSamples;
+		numSamples -= d.numSamples;
+	}
+}
 
-		if (stereoMode)
-		{
-			auto lowerTableR = currentSound->getWaveTableData(1, lowerTableIndex);
-			auto upperTableR = currentSound->getWaveTableData(1, upperTableIndex);
+span<int, 4> WavetableSound::RenderData::getTaps(int index, int tableSize)
+{
+	span<int, 4> i;
 
-			auto r = calculateSample(lowerTableR, upperTableR, i, alpha, tableDelta);
-			b.setSample(1, startSample, r);
+#if USE_MOD2_WAVETABLESIZE
+	i[0] = (index + tableSize - 1) & (tableSize - 1);
+	i[1] = index;
+	i[2] = (index + 1) & (tableSize - 1);
+	i[3] = (index + 2) & (tableSize - 1);
+#else
+	i[1] = index;
+	i[2] = i[1] + 1;
+	i[0] = i[1] - 1;
+	i[3] = i[1] + 2;
+
+	if (i[1] == 0)         i[0] = tableSize - 1;
+	if (i[2] >= tableSize) i[2] = 0;
+	if (i[3] >= tableSize) i[3] = 0;
+#endif
+
+	return i;
+}
+
+void WavetableSound::RenderData::renderTable(const float* table, float* dst, const ChunkData& d, int tableSize) const
+{
+	if (hqMode)
+	{
+		for (int s = 0; s < d.numSamples; s++)
+		{
+			auto i = getTaps(d.index[s], tableSize);
+			dst[s] = Interpolator::interpolateCubic(table[i[0]], table[i[1]], table[i[2]], table[i[3]], d.alpha[s]);
+		}
+	}
+	else
+	{
+		for (int s = 0; s < d.numSamples; s++)
+		{
+			auto i = getTaps(d.index[s], tableSize);
+			dst[s] = Interpolator::interpolateLinear(table[i[1]], table[i[2]], d.alpha[s]);
 		}
+	}
+}
 
-		jassert(voicePitchValues == nullptr || voicePitchValues[startSample] > 0.0f);
+void WavetableSound::RenderData::renderConstantTable(WavetableSound* currentSound, int channelIndex, const ChunkData& d, float* dst) const
+{
+	auto numTables = currentSound->getWavetableAmount();
+	auto tableSize = currentSound->getTableSize();
+
+	const int lowerTableIndex = (int)d.tableValue[0];
+	const float tableDelta = d.tableValue[0] - (float)lowerTableIndex;
+	jassert(0.0f <= tableDelta && tableDelta <= 1.0f);
+
+	const int upperTableIndex = jmin(numTables - 1, lowerTableIndex + 1);
 
-		const double delta = (uptimeDelta * (voicePitchValues == nullptr ? 1.0 : voicePitchValues[startSample]));
+	auto lowerTable = currentSound->getWaveTableData(channelIndex, lowerTableIndex);
+	auto upperTable = currentSound->getWaveTableData(channelIndex, upperTableIndex);
 
-		voiceUptime += delta;
+	renderTable(lowerTable, dst, d, tableSize);
+
+	if (lowerTable != upperTable && tableDelta > 0.0f)
+	{
+		float upperData[ChunkSize];
+		renderTable(upperTable, upperData, d, tableSize);
 
-		++startSample;
+		// the crossfade between the tables uses the SIMD vector operations
+		FloatVectorOperations::multiply(dst, 1.0f - tableDelta, d.numSamples);
+		FloatVectorOperations::addWithMultiply(dst, upperData, tableDelta, d.numSamples);
 	}
 }
 
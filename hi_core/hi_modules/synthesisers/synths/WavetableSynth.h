@@ -164,6 +164,28 @@ public:
 		void render(WavetableSound* currentSound, double& voiceUptime, const TableIndexFunction& tf);
 
 		float calculateSample(const float* lowerTable, const float* upperTable, const span<int, 4>& i, float alpha, float tableAlpha) const;
+
+	private:
+
+		/** The render loop processes chunks of this size so that the phase, index and table
+		    values can be precomputed into stack arrays before the interpolation. */
+		static constexpr int ChunkSize = 64;
+
+		struct ChunkData
+		{
+			int numSamples = 0;
+			int index[ChunkSize];
+			float alpha[ChunkSize];
+			float tableValue[ChunkSize];
+		};
+
+		static span<int, 4> getTaps(int index, int tableSize);
+
+		/** Interpolates a single table for the whole chunk. */
+		void renderTable(const float* table, float* dst, const ChunkData& d, int tableSize) const;
+
+		/** The fast path if the table index doesn't change within the chunk. */
+		void renderConstantTable(WavetableSound* currentSound, int channelIndex, const ChunkData& d, float* dst) const;
 	};
 
 private:
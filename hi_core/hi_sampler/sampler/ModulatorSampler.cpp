@@ -178,6 +178,8 @@ syncVoiceHandler(false)
 	for (int i = 0; i < 8; i++)
 		getTable(i)->setYTextConverterRaw(Modulation::getValueAsDecibel);
 
+	soundCollector = new KeyIndexedSoundCollector(this);
+
 	getMatrix().setAllowResizing(true);
 
 	PrepareSpecs ps;
@@ -199,6 +201,33 @@ int ModulatorSampler::getRRGroupsForMessage(int noteNumber, int velocity)
 	return roundRobinMap.getRRGroupsForMessage(noteNumber, velocity);
 }
 
+SynthesiserSound* ModulatorSampler::addSound(const SynthesiserSound::Ptr& newSound)
+{
+	auto s = Synthesiser::addSound(newSound);
+	invalidateSoundLookupIndex();
+	return s;
+}
+
+void ModulatorSampler::removeSound(int index)
+{
+	Synthesiser::removeSound(index);
+	invalidateSoundLookupIndex();
+}
+
+void ModulatorSampler::clearSounds()
+{
+	Synthesiser::clearSounds();
+	invalidateSoundLookupIndex();
+}
+
+void ModulatorSampler::invalidateSoundLookupIndex()
+{
+	soundLookupVersion++;
+
+	if (auto c = dynamic_cast<IndexedSoundCollector*>(soundCollector.get()))
+		c->triggerAsyncUpdate();
+}
+
 void ModulatorSampler::refreshRRMap()
 {
 	roundRobinMap.clear();
@@ -577,7 +606,7 @@ void ModulatorSampler::setInternalAttribute(int parameterIndex, float newValue)
 	case PitchTracking:		pitchTrackingEnabled = newValue > 0.5f; break;
 	case OneShot:			oneShotEnabled = newValue > 0.5f; break;
 	case Reversed:			setReversed(newValue > 0.5f); break;
-	case CrossfadeGroups:	crossfadeGroups = newValue > 0.5f; refreshCrossfadeTables(); break;
+	case CrossfadeGroups:	crossfadeGroups = newValue > 0.5f; refreshCrossfadeTables(); getMainController()->bumpModuleTreeRevision(); break;
 	case Purged:			updatePurgeFromAttribute(roundToInt(newValue)); break;
 	case UseStaticMatrix:   setUseStaticMatrix(newValue > 0.5f); break;
 	case LowPassEnvelopeOrder: 
@@ -837,6 +866,11 @@ void ModulatorSampler::refreshMemoryUsage(bool fastMode)
         }
 	}
 
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+	if (!fastMode)
+		updateLaneVoiceBuffers();
+#endif
+
 	const int64 streamBufferSizePerVoice = 2 *				// two buffers
 		bufferSize *		// buffer size per buffer
 		(sampleMap->isMonolith() ? 2 : 4) *  // bytes per sample
@@ -953,14 +987,16 @@ void ModulatorSampler::setDisplayedGroup(int index, bool shouldBeVisible, Modifi
 
 void ModulatorSampler::setSortByGroup(bool shouldSortByGroup)
 {
-	if (shouldSortByGroup != (soundCollector != nullptr))
+	const bool isSortedByGroup = dynamic_cast<GroupedRoundRobinCollector*>(soundCollector.get()) != nullptr;
+
+	if (shouldSortByGroup != isSortedByGroup)
 	{
 		LockHelpers::SafeLock sl(getMainController(), LockHelpers::Type::AudioLock);
 
 		if (shouldSortByGroup)
 			soundCollector = new GroupedRoundRobinCollector(this);
 		else
-			soundCollector = nullptr;
+			soundCollector = new KeyIndexedSoundCollector(this);
 	}
 }
 
@@ -980,6 +1016,7 @@ bool ModulatorSampler::callAsyncIfJobsPending(const ProcessorFunction& f)
 
 void ModulatorSampler::setEnableEnvelopeFilter()
 {
+	getMainController()->bumpModuleTreeRevision();
 	envelopeFilter = new CascadedEnvelopeLowPass(true);
 
 	if (getSampleRate() > 0)
@@ -1035,6 +1072,7 @@ void ModulatorSampler::setCurrentTimestretchMode(TimestretchOptions::Timestretch
 void ModulatorSampler::setTimestretchOptions(const TimestretchOptions& newOptions)
 {
 	currentTimestretchOptions = newOptions;
+	getMainController()->bumpModuleTreeRevision();
 
 	auto f = [](Processor* p)
 	{
@@ -1121,6 +1159,44 @@ void ModulatorSampler::setCrossfadeTableValue(float newValue)
 	samplerDisplayValues.crossfadeTableValue = newValue;
 }
 
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+void ModulatorSampler::updateLaneVoiceBuffers()
+{
+	const auto shouldBeFloatingPoint = temporaryVoiceBuffer.isFloatingPoint();
+	const auto numSamples = temporaryVoiceBuffer.getNumSamples();
+
+	while (laneVoiceBuffers.size() < RealtimeWorkerPool::NumLanes - 1)
+		laneVoiceBuffers.add(new hlac::HiseSampleBuffer(shouldBeFloatingPoint, 2, 0));
+
+	for (int i = 0; i < laneVoiceBuffers.size(); i++)
+	{
+		if (laneVoiceBuffers[i]->isFloatingPoint() != shouldBeFloatingPoint)
+			laneVoiceBuffers.set(i, new hlac::HiseSampleBuffer(shouldBeFloatingPoint, 2, 0), true);
+
+		StreamingSamplerVoice::initTemporaryVoiceBuffer(laneVoiceBuffers[i], numSamples, 1.0);
+	}
+}
+#endif
+
+bool ModulatorSampler::isSafeForVoiceParallelRendering() const
+{
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+	// The crossfade values, the envelope filter and the stretch buffer are shared between the voices
+	if (isUsingCrossfadeGroups() || envelopeFilter != nullptr)
+		return false;
+
+	if (getTimestretchMode() != TimestretchOptions::TimestretchMode::Disabled)
+		return false;
+
+	if (laneVoiceBuffers.size() != RealtimeWorkerPool::NumLanes - 1)
+		return false;
+
+	return checkVoiceParallelRenderingContract();
+#else
+	return false;
+#endif
+}
+
 void ModulatorSampler::resetNoteDisplay(int noteNumber)
 {
 	lastStartedVoice = nullptr;
@@ -1649,9 +1725,19 @@ void ModulatorSampler::updateRRGroupAmountAfterMapLoad()
 
 void ModulatorSampler::nonRealtimeModeChanged(bool isNonRealtime)
 {
+	auto directBufferSize = getMainController()->getSampleManager().getDirectStreamingBufferSize();
+
 	for (auto v : voices)
 	{
-		dynamic_cast<ModulatorSamplerVoice*>(v)->setNonRealtime(isNonRealtime);
+		auto sv = dynamic_cast<ModulatorSamplerVoice*>(v);
+
+		sv->setNonRealtime(isNonRealtime);
+
+		if (directBufferSize > 0)
+		{
+			sv->resetVoice();
+			sv->setDirectStreamingBufferSize(isNonRealtime ? directBufferSize : 0);
+		}
 	}
 }
 
@@ -1754,6 +1840,8 @@ void ModulatorSampler::setRRGroupAmount(int newGroupLimit)
 	while (auto sound = sIter.getNextSound())
 		sound->setMaxRRGroupIndex(rrGroupAmount);
 
+	invalidateSoundLookupIndex();
+
 	rrGroupGains.ensureStorageAllocated(rrGroupAmount);
 
 	for (int i = rrGroupGains.size(); i < rrGroupAmount; i++)
@@ -1827,54 +1915,61 @@ bool ModulatorSampler::preloadAllSamples()
 
 	const bool isReversed = getAttribute(ModulatorSampler::Reversed) > 0.5f;
 
-	ModulatorSampler::SoundIterator sIter(this);
-	jassert(sIter.canIterate());
-
 	const int numToLoad = jmax<int>(1, sounds.size() * getNumMicPositions());
-	int currentIndex = 0;
-
-	auto& progress = getMainController()->getSampleManager().getPreloadProgress();
+	int numSkipped = 0;
 
 	auto threadPool = getMainController()->getSampleManager().getGlobalSampleThreadPool();
 
-	while (auto sound = sIter.getNextSound())
-	{
-		if (threadPool->threadShouldExit())
-			return false;
+	Array<StreamingSamplerSound*> soundsToPreload;
+	soundsToPreload.ensureStorageAllocated(numToLoad);
 
-		sound->checkFileReference();
+	{
+		ModulatorSampler::SoundIterator sIter(this);
+		jassert(sIter.canIterate());
 
-		if (getNumMicPositions() == 1)
+		while (auto sound = sIter.getNextSound())
 		{
-			auto s = sound->getReferenceToSound().get();
-
-			progress = (double)currentIndex++ / (double)numToLoad;
-
-			if (!preloadSample(s, preloadSizeToUse))
+			if (threadPool->threadShouldExit())
 				return false;
-		}
-		else
-		{
-			for (int j = 0; j < getNumMicPositions(); j++)
-			{
-				const bool isEnabled = getChannelData(j).enabled;
 
-				progress = (double)currentIndex++ / (double)numToLoad;
+			sound->checkFileReference();
 
-				if (auto s = sound->getReferenceToSound(j))
+			if (getNumMicPositions() == 1)
+			{
+				soundsToPreload.add(sound->getReferenceToSound().get());
+			}
+			else
+			{
+				for (int j = 0; j < getNumMicPositions(); j++)
 				{
-					if (isEnabled)
+					const bool isEnabled = getChannelData(j).enabled;
+
+					if (auto s = sound->getReferenceToSound(j))
 					{
-						if (!preloadSample(s.get(), preloadSizeToUse))
-							return false;
+						if (isEnabled)
+						{
+							soundsToPreload.add(s.get());
+							continue;
+						}
+						else
+							s->setPurged(true);
 					}
-					else
-						s->setPurged(true);
+
+					numSkipped++;
 				}
 			}
 		}
+	}
+
+	if (!preloadSamplesInParallel(soundsToPreload, preloadSizeToUse, numSkipped, numToLoad))
+		return false;
 
-		sound->setReversed(isReversed);
+	{
+		ModulatorSampler::SoundIterator sIter(this);
+		jassert(sIter.canIterate());
+
+		while (auto sound = sIter.getNextSound())
+			sound->setReversed(isReversed);
 	}
 
 	refreshReleaseStartFlag();
@@ -1901,18 +1996,118 @@ bool ModulatorSampler::preloadSample(StreamingSamplerSound * s, const int preloa
 	}
 	catch (StreamingSamplerSound::LoadingError l)
 	{
-		String x;
-		x << "Error at preloading sample " << l.fileName << ": " << l.errorDescription;
-		getMainController()->getDebugLogger().logMessage(x);
+		reportPreloadError(l);
+		return false;
+	}
+}
+
+void ModulatorSampler::reportPreloadError(const StreamingSamplerSound::LoadingError& l)
+{
+	String x;
+	x << "Error at preloading sample " << l.fileName << ": " << l.errorDescription;
+	getMainController()->getDebugLogger().logMessage(x);
 
 #if USE_FRONTEND
-		getMainController()->sendOverlayMessage(DeactiveOverlay::State::CustomErrorMessage, x);
+	getMainController()->sendOverlayMessage(DeactiveOverlay::State::CustomErrorMessage, x);
 #else
-		debugError(this, x);
+	debugError(this, x);
 #endif
+}
 
-		return false;
+bool ModulatorSampler::preloadSamplesInParallel(const Array<StreamingSamplerSound*>& soundsToPreload, int preloadSizeToUse, int numSkipped, int numToLoad)
+{
+	auto& progress = getMainController()->getSampleManager().getPreloadProgress();
+	auto threadPool = getMainController()->getSampleManager().getGlobalSampleThreadPool();
+
+	const int numThreads = jmin(HISE_NUM_PRELOAD_THREADS, SystemStats::getNumCpus(), soundsToPreload.size());
+
+	if (numThreads <= 1)
+	{
+		int currentIndex = numSkipped;
+
+		for (auto s : soundsToPreload)
+		{
+			if (threadPool->threadShouldExit())
+				return false;
+
+			progress = (double)currentIndex++ / (double)numToLoad;
+
+			if (!preloadSample(s, preloadSizeToUse))
+				return false;
+		}
+
+		return true;
 	}
+
+	// All samples that are read from the same file (or monolith) share the reader,
+	// so we group them by their streaming affinity and load each group on a single thread.
+	std::map<int64, int> groupIndexes;
+	Array<Array<StreamingSamplerSound*>> groups;
+
+	for (auto s : soundsToPreload)
+	{
+		auto affinity = s->getStreamingWorkerAffinity();
+		auto it = groupIndexes.find(affinity);
+
+		if (it == groupIndexes.end())
+		{
+			it = groupIndexes.emplace(affinity, groups.size()).first;
+			groups.add({});
+		}
+
+		groups.getReference(it->second).add(s);
+	}
+
+	// Start with the biggest groups so that a big monolith doesn't end up as the last job
+	std::stable_sort(groups.begin(), groups.end(), [](const Array<StreamingSamplerSound*>& a, const Array<StreamingSamplerSound*>& b)
+	{
+		return a.size() > b.size();
+	});
+
+	std::atomic<int> nextGroup = { 0 };
+	std::atomic<int> numLoaded = { 0 };
+	std::atomic<bool> failed = { false };
+	std::atomic<int> numPendingJobs = { numThreads };
+	WaitableEvent allDone;
+
+	auto preloadGroups = [&]()
+	{
+		while (!failed && !threadPool->threadShouldExit())
+		{
+			const int groupIndex = nextGroup++;
+
+			if (groupIndex >= groups.size())
+				break;
+
+			for (auto s : groups.getReference(groupIndex))
+			{
+				if (failed || threadPool->threadShouldExit())
+					break;
+
+				if (!preloadSample(s, preloadSizeToUse))
+				{
+					failed = true;
+					break;
+				}
+
+				numLoaded++;
+			}
+		}
+
+		if (--numPendingJobs == 0)
+			allDone.signal();
+	};
+
+	auto& pool = getMainController()->getSampleManager().getPreloadThreadPool();
+
+	for (int i = 0; i < numThreads; i++)
+		pool.addJob(preloadGroups);
+
+	// The progress is only written by this thread, so we wake up periodically to update it
+	while (!allDone.wait(30))
+		progress = (double)(numSkipped + numLoaded.load()) / (double)numToLoad;
+
+	return !failed && !threadPool->threadShouldExit();
 }
 
 ModulatorSampler::ScopedUpdateDelayer::ScopedUpdateDelayer(ModulatorSampler* s) :
@@ -1934,77 +2129,169 @@ ModulatorSampler::ScopedUpdateDelayer::~ScopedUpdateDelayer()
 	}
 }
 
-ModulatorSampler::GroupedRoundRobinCollector::GroupedRoundRobinCollector(ModulatorSampler* s):
+ModulatorSampler::IndexedSoundCollector::IndexedSoundCollector(ModulatorSampler* s, bool groupByRRGroup_):
 	sampler(s),
-	ready(false)
+	groupByRRGroup(groupByRRGroup_),
+	indexVersion(0)
 {
 	sampler->getSampleMap()->addListener(this);
 	triggerAsyncUpdate();
 }
 
-ModulatorSampler::GroupedRoundRobinCollector::~GroupedRoundRobinCollector()
+ModulatorSampler::IndexedSoundCollector::~IndexedSoundCollector()
 {
 	if (sampler != nullptr)
 		sampler->getSampleMap()->removeListener(this);
 }
 
-void ModulatorSampler::GroupedRoundRobinCollector::collectSounds(const HiseEvent& m, UnorderedStack<ModulatorSynthSound *>& soundsAboutToBeStarted)
+bool ModulatorSampler::IndexedSoundCollector::isUpToDate() const noexcept
 {
-	SimpleReadWriteLock::ScopedReadLock sl(rebuildLock);
+	return sampler != nullptr && indexVersion.load() == sampler->getSoundLookupVersion();
+}
 
-	if (!ready)
-		jassertfalse;
+const ReferenceCountedArray<ModulatorSynthSound>* ModulatorSampler::IndexedSoundCollector::getSoundsForNote(int groupIndex, int noteNumber) const
+{
+	if (!isPositiveAndBelow(groupIndex, numGroups) || !isPositiveAndBelow(noteNumber, 128))
+		return nullptr;
 
-	auto currentGroup = sampler->getCurrentRRGroup() - 1;
+	return &noteLists.getReference(groupIndex * 128 + noteNumber);
+}
+
+void ModulatorSampler::IndexedSoundCollector::handleAsyncUpdate()
+{
+	if (sampler == nullptr)
+		return;
+
+	// Fetch the version before the iteration so that any change
+	// during the rebuild will keep the index outdated
+	const auto thisVersion = sampler->getSoundLookupVersion();
+
+	ReferenceCountedArray<ModulatorSynthSound> allSounds;
+	int newNumGroups = 1;
 
-	if (isPositiveAndBelow(currentGroup, groups.size()))
 	{
-		auto& refArray = groups.getReference(currentGroup);
+		ModulatorSampler::SoundIterator it(sampler);
+		
+		// The sounds are being changed right now, so try again later
+		if (!it.canIterate())
+		{
+			startTimer(50);
+			return;
+		}
 
-		for (auto s : refArray)
+		allSounds.ensureStorageAllocated(it.size());
+
+		while (auto s = it.getNextSound())
 		{
-			if (sampler->soundCanBePlayed(s, m.getChannel(), m.getNoteNumber(), m.getFloatVelocity()))
-				soundsAboutToBeStarted.insertWithoutSearch(s);
+			if (groupByRRGroup)
+				newNumGroups = jmax(newNumGroups, s->getRRGroup());
+
+			allSounds.add(static_cast<ModulatorSynthSound*>(s.get()));
 		}
 	}
+
+	Array<ReferenceCountedArray<ModulatorSynthSound>> newLists;
+	newLists.insertMultiple(0, {}, newNumGroups * 128);
+
+	for (auto s : allSounds)
+	{
+		auto sound = static_cast<ModulatorSamplerSound*>(s);
+
+		const int groupIndex = groupByRRGroup ? sound->getRRGroup() - 1 : 0;
+
+		if (!isPositiveAndBelow(groupIndex, newNumGroups))
+			continue;
+
+		auto lowKey = jlimit(0, 127, (int)sound->getSampleProperty(SampleIds::LoKey));
+		auto highKey = jlimit(0, 127, (int)sound->getSampleProperty(SampleIds::HiKey));
+
+		for (int i = lowKey; i <= highKey; i++)
+			newLists.getReference(groupIndex * 128 + i).add(s);
+	}
+
+	SimpleReadWriteLock::ScopedWriteLock sl(rebuildLock);
+	std::swap(noteLists, newLists);
+	numGroups = newNumGroups;
+	indexVersion.store(thisVersion);
 }
 
-void ModulatorSampler::GroupedRoundRobinCollector::handleAsyncUpdate()
+void ModulatorSampler::IndexedSoundCollector::timerCallback()
 {
-	Array<ReferenceCountedArray<ModulatorSynthSound>> newList;
+	stopTimer();
+	handleAsyncUpdate();
+}
 
-	auto numRRGroups = (int)sampler->getAttribute(ModulatorSampler::RRGroupAmount);
+ModulatorSampler::GroupedRoundRobinCollector::GroupedRoundRobinCollector(ModulatorSampler* s):
+	IndexedSoundCollector(s, true)
+{
+}
 
-	if (numRRGroups > 0)
-	{
-		int numToStore = sampler->getNumSounds() / numRRGroups;
+void ModulatorSampler::GroupedRoundRobinCollector::collectSounds(const HiseEvent& m, UnorderedStack<ModulatorSynthSound *>& soundsAboutToBeStarted)
+{
+	SimpleReadWriteLock::ScopedReadLock sl(rebuildLock);
 
-		newList.ensureStorageAllocated(numRRGroups);
+	auto currentGroup = sampler->getCurrentRRGroup() - 1;
 
-		for (int i = 0; i < numRRGroups; i++)
+	if (isUpToDate())
+	{
+		if (auto list = getSoundsForNote(currentGroup, m.getNoteNumber()))
 		{
-			ReferenceCountedArray<ModulatorSynthSound> newArray;
-			newArray.ensureStorageAllocated(numToStore);
-			newList.add(newArray);
+			for (auto s : *list)
+			{
+				if (sampler->soundCanBePlayed(s, m.getChannel(), m.getNoteNumber(), m.getFloatVelocity()))
+					soundsAboutToBeStarted.insertWithoutSearch(s);
+			}
 		}
 
-		ModulatorSampler::SoundIterator it(sampler);
-		jassert(it.canIterate());
+		return;
+	}
 
-		while (auto s = it.getNextSound())
-		{
-			auto rrIndex = (int)s->getSampleProperty(SampleIds::RRGroup) - 1;
+	for (auto s : sampler->sounds)
+	{
+		auto sound = static_cast<ModulatorSamplerSound*>(s);
+
+		if (sound->getRRGroup() - 1 != currentGroup)
+			continue;
+
+		if (sampler->soundCanBePlayed(sound, m.getChannel(), m.getNoteNumber(), m.getFloatVelocity()))
+			soundsAboutToBeStarted.insertWithoutSearch(sound);
+	}
+}
+
+ModulatorSampler::KeyIndexedSoundCollector::KeyIndexedSoundCollector(ModulatorSampler* s):
+	IndexedSoundCollector(s, false)
+{
+}
 
-			if (isPositiveAndBelow(rrIndex, newList.size()))
+void ModulatorSampler::KeyIndexedSoundCollector::collectSounds(const HiseEvent& m, UnorderedStack<ModulatorSynthSound *>& soundsAboutToBeStarted)
+{
+	SimpleReadWriteLock::ScopedReadLock sl(rebuildLock);
+
+	const int midiChannel = m.getChannel();
+	const int transposedMidiNoteNumber = m.getNoteNumber() + m.getTransposeAmount();
+	const float velocity = m.getFloatVelocity();
+
+	if (isUpToDate())
+	{
+		if (auto list = getSoundsForNote(0, transposedMidiNoteNumber))
+		{
+			for (auto s : *list)
 			{
-				newList.getReference(rrIndex).add(static_cast<ModulatorSynthSound*>(s));
+				if (sampler->soundCanBePlayed(s, midiChannel, transposedMidiNoteNumber, velocity))
+					soundsAboutToBeStarted.insertWithoutSearch(s);
 			}
 		}
+
+		return;
 	}
 
-	SimpleReadWriteLock::ScopedWriteLock sl(rebuildLock);
-	std::swap(groups, newList);
-	ready.store(true);
+	for (auto s : sampler->sounds)
+	{
+		auto sound = static_cast<ModulatorSynthSound*>(s);
+
+		if (sampler->soundCanBePlayed(sound, midiChannel, transposedMidiNoteNumber, velocity))
+			soundsAboutToBeStarted.insertWithoutSearch(sound);
+	}
 }
 
 } // namespace hise
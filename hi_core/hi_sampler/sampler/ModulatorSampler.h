@@ -83,17 +83,23 @@ public:
 		bool prevValue;
 	};
 
-	class GroupedRoundRobinCollector : public ModulatorSynth::SoundCollectorBase,
-									   public SampleMap::Listener,
-									   public AsyncUpdater
+	/** A sound collector that looks up the sounds for a note-on message in a precomputed index.
+	
+		The index contains a list of sounds for every note number (and RR group if desired) and is
+		rebuilt on the message thread whenever the sample map changes, so the note-on lookup only has
+		to check the sounds that are mapped to the note. As long as the index is outdated, it will fall
+		back to checking every sound of the sampler.
+	*/
+	class IndexedSoundCollector : public ModulatorSynth::SoundCollectorBase,
+								  public SampleMap::Listener,
+								  public AsyncUpdater,
+								  private Timer
 	{
 	public:
 
-		GroupedRoundRobinCollector(ModulatorSampler* s);
+		IndexedSoundCollector(ModulatorSampler* s, bool groupByRRGroup);
 
-		~GroupedRoundRobinCollector();
-
-		void collectSounds(const HiseEvent& m, UnorderedStack<ModulatorSynthSound *>& soundsToBeStarted) override;
+		virtual ~IndexedSoundCollector();
 
 		void sampleMapWasChanged(PoolReference newSampleMap)
 		{
@@ -102,7 +108,7 @@ public:
 
 		void samplePropertyWasChanged(ModulatorSamplerSound* , const Identifier& sampleId, const var& )
 		{
-			if(sampleId == SampleIds::RRGroup)
+			if(sampleId == SampleIds::RRGroup || sampleId == SampleIds::LoKey || sampleId == SampleIds::HiKey)
 				triggerAsyncUpdate();
 		};
 
@@ -116,17 +122,52 @@ public:
 			triggerAsyncUpdate();
 		};
 
-	private:
+		/** Checks whether the index reflects the current mapping of the sampler. */
+		bool isUpToDate() const noexcept;
+
+	protected:
+
+		/** Returns the sounds for the note number (in the given RR group). Only call this with the read lock. */
+		const ReferenceCountedArray<ModulatorSynthSound>* getSoundsForNote(int groupIndex, int noteNumber) const;
 
 		SimpleReadWriteLock rebuildLock;
 
 		WeakReference<ModulatorSampler> sampler;
 
+	private:
+
 		void handleAsyncUpdate() override;
 
-		std::atomic<bool> ready;
+		/** Retries the rebuild if the sounds couldn't be iterated. */
+		void timerCallback() override;
+
+		const bool groupByRRGroup;
+
+		std::atomic<uint32> indexVersion;
+
+		int numGroups = 0;
+
+		Array<ReferenceCountedArray<ModulatorSynthSound>> noteLists;
+	};
+
+	/** Collects only the sounds of the current RR group. */
+	class GroupedRoundRobinCollector : public IndexedSoundCollector
+	{
+	public:
+
+		GroupedRoundRobinCollector(ModulatorSampler* s);
+
+		void collectSounds(const HiseEvent& m, UnorderedStack<ModulatorSynthSound *>& soundsToBeStarted) override;
+	};
+
+	/** The default sound collector of the sampler. */
+	class KeyIndexedSoundCollector : public IndexedSoundCollector
+	{
+	public:
+
+		KeyIndexedSoundCollector(ModulatorSampler* s);
 
-		Array<ReferenceCountedArray<ModulatorSynthSound>> groups;
+		void collectSounds(const HiseEvent& m, UnorderedStack<ModulatorSynthSound *>& soundsToBeStarted) override;
 	};
 
 	/** A small helper tool that iterates over the sound array in a thread-safe way.
@@ -379,6 +420,18 @@ public:
 	/** Deletes all sounds. Call this instead of clearSounds(). */
 	void deleteAllSounds();
 
+	/** Adds the sound and invalidates the sound lookup index. 
+	
+		This hides the Synthesiser methods, so that every change of the sound list updates the index.
+	*/
+	SynthesiserSound* addSound(const SynthesiserSound::Ptr& newSound);
+
+	/** Removes the sound and invalidates the sound lookup index. */
+	void removeSound(int index);
+
+	/** Removes all sounds and invalidates the sound lookup index. */
+	void clearSounds();
+
 	/** Refreshes the preload sizes for all samples.
 	*
 	*	This is the actual loading process, so it is put into a seperate thread with a progress window. */
@@ -486,6 +539,13 @@ public:
 
 	bool preloadSample(StreamingSamplerSound * s, const int preloadSizeToUse);
 
+	/** Preloads the given sounds using multiple threads (see HISE_NUM_PRELOAD_THREADS).
+	
+		The progress will be reported to the SampleManager and it returns false if the sample loading
+		thread was cancelled or a sample could not be loaded.
+	*/
+	bool preloadSamplesInParallel(const Array<StreamingSamplerSound*>& soundsToPreload, int preloadSizeToUse, int numSkipped, int numToLoad);
+
 	bool saveSampleMap() const;
 
 	bool saveSampleMapAsReference() const;
@@ -567,6 +627,14 @@ public:
 	int getRRGroupsForMessage(int noteNumber, int velocity);
 	void refreshRRMap();
 
+	/** Call this whenever a sound was added or removed or its key range / RR group changed.
+	
+		This will cause the sound collection to scan all sounds until the lookup index was rebuilt.
+	*/
+	void invalidateSoundLookupIndex();
+
+	uint32 getSoundLookupVersion() const noexcept { return soundLookupVersion.load(); }
+
     void setReversed(bool shouldBeReversed);
 
 	void updatePurgeFromAttribute(int roundedValue);
@@ -700,7 +768,22 @@ public:
 
 	AudioSampleBuffer* getTemporaryStretchBuffer() { return &stretchBuffer; }
 
-	hlac::HiseSampleBuffer* getTemporaryVoiceBuffer() { return &temporaryVoiceBuffer; }
+	/** Returns the buffer that the voices use for the sample interpolation.
+	
+		Voices that are rendered on a realtime worker need their own buffer, so pass in the
+		lane index from RealtimeWorkerPool::getCurrentLane().
+	*/
+	hlac::HiseSampleBuffer* getTemporaryVoiceBuffer(int laneIndex=0)
+	{
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+		if (isPositiveAndBelow(laneIndex - 1, laneVoiceBuffers.size()))
+			return laneVoiceBuffers[laneIndex - 1];
+#endif
+
+		return &temporaryVoiceBuffer;
+	}
+
+	bool isSafeForVoiceParallelRendering() const override;
 
 	bool checkAndLogIsSoftBypassed(DebugLogger::Location location) const;
 
@@ -934,6 +1017,16 @@ private:
 	hlac::HiseSampleBuffer temporaryVoiceBuffer;
 	AudioSampleBuffer stretchBuffer;
 
+	std::atomic<uint32> soundLookupVersion = { 1 };
+
+	void reportPreloadError(const StreamingSamplerSound::LoadingError& l);
+
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+	void updateLaneVoiceBuffers();
+
+	OwnedArray<hlac::HiseSampleBuffer> laneVoiceBuffers;
+#endif
+
 	bool delayUpdate = false;
 	int lowPassOrder = 0;
 
@@ -1283,12 +1283,37 @@ juce::AudioFormatWriter* MonolithExporter::createWriter(hlac::HiseLosslessAudioF
 	auto hWriter = dynamic_cast<hlac::HiseLosslessAudioFormatWriter*>(writer.get());
 
 	hWriter->setOptions(options);
+	hWriter->setNumEncoderThreads(SystemStats::getNumCpus());
 
 	
 
 	return writer.release();
 }
 
+bool MonolithExporter::writeSample(AudioFormatWriter& writer, AudioFormatReader& reader)
+{
+	// This must be a multiple of the HLAC block size or the encoder will pad the chunks with zeros. It is also
+	// a multiple of the 16384 samples that the static normalisation is calculated on, so the output is
+	// identical to writeFromAudioReader().
+	constexpr int ChunkSize = COMPRESSION_BLOCK_SIZE * 64;
+
+	const int numSamplesInChunk = (int)jmin<int64>(ChunkSize, reader.lengthInSamples);
+
+	AudioSampleBuffer chunk((int)writer.getNumChannels(), jmax(1, numSamplesInChunk));
+
+	for (int64 pos = 0; pos < reader.lengthInSamples; pos += ChunkSize)
+	{
+		const int numToDo = (int)jmin<int64>(ChunkSize, reader.lengthInSamples - pos);
+
+		reader.read(&chunk, 0, numToDo, pos, true, true);
+
+		if (!writer.writeFromAudioSampleBuffer(chunk, 0, numToDo))
+			return false;
+	}
+
+	return true;
+}
+
 int64 MonolithExporter::getNumBytesForSplitSize() const
 {
 	auto mb = getComboBoxComponent("splitsize")->getText().getIntValue();
@@ -1439,7 +1464,7 @@ void MonolithExporter::writeFiles(int channelIndex, bool overwriteExistingData)
 
 			if (reader != nullptr)
 			{
-				writer->writeFromAudioReader(*reader, 0, -1);
+				writeSample(*writer, *reader);
 				
 				if (auto hWriter = dynamic_cast<hlac::HiseLosslessAudioFormatWriter*>(writer.get()))
 				{
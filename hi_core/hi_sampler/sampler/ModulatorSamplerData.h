@@ -559,6 +559,9 @@ private:
 
 	AudioFormatWriter* createWriter(hlac::HiseLosslessAudioFormat& hlaf, const File& f, bool isMono);
 
+	/** Writes the sample in chunks of multiple HLAC blocks so that the encoder can spread them across its threads. */
+	static bool writeSample(AudioFormatWriter& writer, AudioFormatReader& reader);
+
 	/** The max monolith size is 2GB - 60MB (to guarantee to stay below 2GB for FAT32. */
 	//constexpr static int maxMonolithSize = 2084569088;
 
@@ -684,6 +684,15 @@ void ModulatorSamplerSound::selectSoundsBasedOnRegex(const String &regexWildcard
 #endif
 }
 
+void ModulatorSamplerSound::invalidateSamplerLookupIndex()
+{
+	if (parentMap != nullptr)
+	{
+		if (auto s = parentMap->getSampler())
+			s->invalidateSoundLookupIndex();
+	}
+}
+
 void ModulatorSamplerSound::updateInternalData(const Identifier& id, const var& newValueVar)
 {
 	int newValue = (int)newValueVar;
@@ -711,12 +720,14 @@ void ModulatorSamplerSound::updateInternalData(const Identifier& id, const var&
 			int low = jmin(midiNotes.findNextSetBit(0), newValue, 127);
 			midiNotes.clear();
 			midiNotes.setRange(low, newValue - low + 1, true);
+			invalidateSamplerLookupIndex();
 		}
 		else if (id == SampleIds::LoKey)
 		{
 			int high = jmax(midiNotes.getHighestBit(), newValue, 0);
 			midiNotes.clear();
 			midiNotes.setRange(newValue, high - newValue + 1, true);
+			invalidateSamplerLookupIndex();
 		}
         else if (id == SampleIds::NumQuarters)
         {
@@ -747,6 +758,7 @@ void ModulatorSamplerSound::updateInternalData(const Identifier& id, const var&
 		else if (id == SampleIds::RRGroup)
 		{
 			rrGroup = jmin<int>(maxRRGroup, newValue);
+			invalidateSamplerLookupIndex();
 		}
 		else if (id == SampleIds::Volume)
 		{
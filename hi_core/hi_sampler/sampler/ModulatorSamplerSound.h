@@ -519,6 +519,9 @@ public:
 
 	void updateInternalData(const Identifier& id, const var& newValue);
 
+	/** Tells the sampler that the key range or RR group of this sound has changed. */
+	void invalidateSamplerLookupIndex();
+
 	void updateAsyncInternalData(const Identifier& id, int newValue);
 
 	var getDefaultValue(const Identifier& id) const;
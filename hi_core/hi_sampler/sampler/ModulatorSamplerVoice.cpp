@@ -144,6 +144,10 @@ void ModulatorSamplerVoice::calculateBlock(int startSample, int numSamples)
 
 	auto owner = static_cast<ModulatorSampler*>(getOwnerSynth());
 
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+	wrappedVoice.setTemporaryVoiceBuffer(owner->getTemporaryVoiceBuffer(RealtimeWorkerPool::getCurrentLane()), owner->getTemporaryStretchBuffer());
+#endif
+
 	if(owner->getTimestretchOptions().mode == ModulatorSampler::TimestretchOptions::TimestretchMode::TempoSynced)
 	{
 		PolyHandler::ScopedVoiceSetter svs(owner->getSyncVoiceHandler(), getVoiceIndex());
@@ -392,11 +396,28 @@ const float * ModulatorSamplerVoice::getCrossfadeModulationValues(int startSampl
 
 
 
+void ModulatorSamplerVoice::resetNoteDisplayOrDefer(int noteNumber)
+{
+	if (sampler->isRenderingVoicesInParallel())
+		pendingNoteDisplayReset = noteNumber;
+	else
+		sampler->resetNoteDisplay(noteNumber);
+}
+
+void ModulatorSamplerVoice::handleDeferredParallelUpdates()
+{
+	if (pendingNoteDisplayReset != -1)
+	{
+		sampler->resetNoteDisplay(pendingNoteDisplayReset);
+		pendingNoteDisplayReset = -1;
+	}
+}
+
 void ModulatorSamplerVoice::resetVoice()
 {
 	if(sampler->isLastStartedVoice(this))
 	{
-		sampler->resetNoteDisplay(this->getCurrentlyPlayingNote() + getTransposeAmount());
+		resetNoteDisplayOrDefer(this->getCurrentlyPlayingNote() + getTransposeAmount());
 	}
 	
 	wrappedVoice.resetVoice();
@@ -516,6 +537,13 @@ void MultiMicModulatorSamplerVoice::calculateBlock(int startSample, int numSampl
 	const int startIndex = startSample;
 	const int samplesInBlock = numSamples;
 
+#if HISE_NUM_AUDIO_WORKER_LANES > 1
+	auto laneBuffer = sampler->getTemporaryVoiceBuffer(RealtimeWorkerPool::getCurrentLane());
+
+	for (auto v : wrappedVoices)
+		v->setTemporaryVoiceBuffer(laneBuffer, sampler->getTemporaryStretchBuffer());
+#endif
+
 	auto voicePitchValues = getOwnerSynth()->getPitchValuesForVoice();
 
 	double propertyPitch = (float)currentlyPlayingSamplerSound->getPropertyPitch();
@@ -691,7 +719,7 @@ void MultiMicModulatorSamplerVoice::setStreamingBufferDataType(bool shouldBeFloa
 
 void MultiMicModulatorSamplerVoice::resetVoice()
 {
-	sampler->resetNoteDisplay(this->getCurrentlyPlayingNote());
+	resetNoteDisplayOrDefer(this->getCurrentlyPlayingNote());
 
 	for (int i = 0; i < wrappedVoices.size(); i++)
 	{
@@ -63,6 +63,8 @@ public:
 	void calculateBlock(int startSample, int numSamples) override;
 	void resetVoice() override;
 
+	void handleDeferredParallelUpdates() override;
+
 	virtual void jumpToRelease()
 	{
 		wrappedVoice.jumpToRelease();
@@ -74,6 +76,12 @@ public:
 		wrappedVoice.loader.setIsNonRealtime(isNonRealtime);
 	}
 
+	/** Changes the streaming buffer size for the non-realtime rendering (0 restores the default size). */
+	virtual void setDirectStreamingBufferSize(int numSamples)
+	{
+		wrappedVoice.loader.setDirectStreamingBufferSize(numSamples);
+	}
+
 	void handlePlaybackPosition(const StreamingSamplerSound * sound);
 
 	static double limitPitchDataToMaxSamplerPitch(float * pitchData, double uptimeDelta, int startSample, int numSamples);
@@ -161,6 +169,11 @@ protected:
 	ScopedPointer<PlayFromPurger> playFromPurger;
 	std::atomic<bool> waitForPlayFromPurge = { false };
 
+	/** The note display is updated after the voices were rendered in parallel. */
+	void resetNoteDisplayOrDefer(int noteNumber);
+
+	int pendingNoteDisplayReset = -1;
+
 private:
 
 	friend class ModulatorSampler;
@@ -214,6 +227,12 @@ public:
 			v->loader.setIsNonRealtime(isNonRealtime);
 	}
 
+	void setDirectStreamingBufferSize(int numSamples) override
+	{
+		for (auto v : wrappedVoices)
+			v->loader.setDirectStreamingBufferSize(numSamples);
+	}
+
 	void jumpToRelease() override
 	{
 		for(auto v: wrappedVoices)
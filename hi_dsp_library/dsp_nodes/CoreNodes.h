@@ -621,7 +621,11 @@ template <class ShaperType> struct snex_shaper
     /** @see snex_node::process*/
 	template <typename ProcessDataType> void process(ProcessDataType& data)
 	{
-		shaper.process(data);
+		// dynamic shapers only implement the process method for ProcessDataDyn
+		if constexpr (prototypes::check::processDataType<ShaperType, ProcessDataType>::value)
+			shaper.process(data);
+		else
+			shaper.process(data.template as<ProcessDataDyn>());
 	}
 
     /** @see snex_node::processFrame */
@@ -53,6 +53,15 @@ void OpaqueNode::prepare(PrepareSpecs ps)
 {
 	if (prepareFunc)
 	{
+		switch (ps.numChannels)
+		{
+		case 1:  processFunc = monoProcessFunc; break;
+		case 2:  processFunc = stereoProcessFunc; break;
+		default: processFunc = dynProcessFunc; break;
+		}
+
+		preparedNumChannels = ps.numChannels;
+
 		prepareFunc(getObjectPtr(), &ps);
 		resetFunc(getObjectPtr());
 	}
@@ -60,7 +69,12 @@ void OpaqueNode::prepare(PrepareSpecs ps)
 
 void OpaqueNode::process(ProcessDataDyn& data)
 {
-	processFunc(getObjectPtr(), &data);
+	// the fixed channel functions would skip or overrun channels, so
+	// anything that doesn't match the prepared channel amount uses the dynamic one
+	if (data.getNumChannels() == preparedNumChannels)
+		processFunc(getObjectPtr(), &data);
+	else
+		dynProcessFunc(getObjectPtr(), &data);
 }
 
 void OpaqueNode::processFrame(MonoFrame& d)
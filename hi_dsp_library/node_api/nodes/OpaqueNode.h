@@ -133,7 +133,19 @@ struct OpaqueNode
 		prepareFunc = prototypes::static_wrappers<T>::prepare;
 		resetFunc = prototypes::static_wrappers<T>::reset;
 
-		processFunc = prototypes::static_wrappers<T>::template process<ProcessDataDyn>;
+		dynProcessFunc = prototypes::static_wrappers<T>::template process<ProcessDataDyn>;
+		processFunc = dynProcessFunc;
+
+		if constexpr (prototypes::check::processDataType<T, ProcessData<1>>::value)
+			monoProcessFunc = prototypes::static_wrappers<T>::template processFixed<1>;
+		else
+			monoProcessFunc = dynProcessFunc;
+
+		if constexpr (prototypes::check::processDataType<T, ProcessData<2>>::value)
+			stereoProcessFunc = prototypes::static_wrappers<T>::template processFixed<2>;
+		else
+			stereoProcessFunc = dynProcessFunc;
+
 		monoFrame = prototypes::static_wrappers<T>::template processFrame<MonoFrame>;
 		stereoFrame = prototypes::static_wrappers<T>::template processFrame<StereoFrame>;
 		initFunc = prototypes::static_wrappers<T>::initialise;
@@ -299,7 +311,17 @@ private:
 	prototypes::destruct destructFunc = nullptr;
 	prototypes::prepare prepareFunc = nullptr;
 	prototypes::reset resetFunc = nullptr;
+	/** The process function that was selected in prepare() based on the channel amount. 
+	
+		For mono and stereo processing this points to a function that calls the process method 
+		of the node with a ProcessData<1> / ProcessData<2> object so that the node can use the code
+		that was specialised for the channel count.
+	*/
 	prototypes::process<ProcessDataDyn> processFunc = nullptr;
+	prototypes::process<ProcessDataDyn> dynProcessFunc = nullptr;
+	prototypes::process<ProcessDataDyn> monoProcessFunc = nullptr;
+	prototypes::process<ProcessDataDyn> stereoProcessFunc = nullptr;
+	int preparedNumChannels = -1;
 	prototypes::processFrame<MonoFrame> monoFrame = nullptr;
 	prototypes::processFrame<StereoFrame> stereoFrame = nullptr;
 	prototypes::initialise initFunc = nullptr;
@@ -208,6 +208,16 @@ namespace prototypes
 			enum { value = sizeof(test<T>(0)) == sizeof(char) };
 		};
 
+		/** Checks whether the process method can be called with the given process data type (eg. ProcessData<2>). */
+		template <typename T, typename ProcessDataType> class processDataType
+		{
+			typedef char one; struct two { char x[2]; };
+			template <typename C> static one test(decltype(std::declval<C&>().process(std::declval<ProcessDataType&>()))*);
+			template <typename C> static two test(...);
+		public:
+			enum { value = sizeof(test<T>(0)) == sizeof(char) };
+		};
+
 		template <typename T> class isProcessingHiseEvent
 		{
 			typedef char one; struct two { char x[2]; };
@@ -240,6 +250,7 @@ namespace prototypes
 		};
 
 		template <typename ProcessDataType> static void process(void* obj, ProcessDataType* data) { static_cast<T*>(obj)->process(*data); }
+		template <int NumChannels> static void processFixed(void* obj, ProcessDataDyn* data) { static_cast<T*>(obj)->process(data->template as<ProcessData<NumChannels>>()); }
 		template <typename FrameDataType> static void processFrame(void* obj, FrameDataType* data) { static_cast<T*>(obj)->processFrame(*data); };
 		static void reset(void* obj) { static_cast<T*>(obj)->reset(); }
 		static void handleHiseEvent(void* obj, HiseEvent* e) { static_cast<T*>(obj)->handleHiseEvent(*e); };
@@ -127,6 +127,30 @@ return b1; \
             return input;
         }
         
+        static forcedinline block& vmins(block& b1, float s)
+        {
+            FloatVectorOperations::min(b1.data, b1.data, s, b1.size());
+            return b1;
+        }
+        
+        static forcedinline block& vmaxs(block& b1, float s)
+        {
+            FloatVectorOperations::max(b1.data, b1.data, s, b1.size());
+            return b1;
+        }
+        
+        /** Calculates b1 = b1 * mul + add in a single pass. */
+        static forcedinline block& vmadds(block& b1, float mul, float add)
+        {
+            auto d = b1.data;
+            const int numSamples = b1.size();
+            
+            for (int i = 0; i < numSamples; i++)
+                d[i] = d[i] * mul + add;
+            
+            return b1;
+        }
+        
         
         
 #undef vOpBinary
@@ -93,6 +93,8 @@ struct node_test
 		obj.process(dynData);
 	}
 
+	const AudioSampleBuffer& getBuffer() const { return b; }
+
 private:
 
 	void setup(int numChannels, int numSamples)
@@ -238,6 +240,76 @@ struct WrapperTests : public UnitTest
 
 		testOpaqueNode<core::mono2stereo>(n, "mono2stereo");
 		testOpaqueNode<core::oscillator<1>>(n, "oscillator");
+
+		testOpaqueNodeChannelSpecialisation<core::oscillator<1>>("oscillator");
+	}
+
+	/** Checks that the mono / stereo entry points selected in prepare() match the direct processing. */
+	template <typename T> void testOpaqueNodeChannelSpecialisation(const String& id)
+	{
+		for (int numChannels = 1; numChannels <= 3; numChannels++)
+		{
+			node_test direct, opaque;
+
+			T obj;
+			direct.callObjectWithDyn(obj, numChannels, 512);
+
+			OpaqueNode on;
+			on.create<T>();
+			opaque.callObjectWithDyn(on, numChannels, 512);
+
+			for (int c = 0; c < numChannels; c++)
+			{
+				for (int i = 0; i < 512; i += 37)
+				{
+					expectEquals(opaque.getBuffer().getSample(c, i), direct.getBuffer().getSample(c, i), 
+						id + " with " + String(numChannels) + " channels at data[" + String(c) + "][" + String(i) + "]");
+				}
+			}
+		}
+
+		// A stereo prepared node that gets a mono buffer must not use the stereo function
+		{
+			PrepareSpecs ps;
+			ps.numChannels = 2;
+			ps.blockSize = 512;
+			ps.sampleRate = 44100.0;
+
+			T obj;
+			obj.prepare(ps);
+			obj.reset();
+
+			OpaqueNode on;
+			on.create<T>();
+			on.prepare(ps);
+			on.reset();
+
+			AudioSampleBuffer directBuffer(1, 512), opaqueBuffer(1, 512);
+
+			for (int i = 0; i < 512; i++)
+			{
+				auto v = (float)(i % 64) / 64.0f - 0.5f;
+				directBuffer.setSample(0, i, v);
+				opaqueBuffer.setSample(0, i, v);
+			}
+
+			HiseEventBuffer eb;
+
+			ProcessDataDyn directData(directBuffer.getArrayOfWritePointers(), 512, 1);
+			ProcessDataDyn opaqueData(opaqueBuffer.getArrayOfWritePointers(), 512, 1);
+
+			expectEquals(opaqueData.getNumChannels(), 1, id + ": mono data expected");
+			expectEquals(opaqueData.getNumSamples(), 512, id + ": sample amount mismatch");
+
+			directData.setEventBuffer(eb);
+			opaqueData.setEventBuffer(eb);
+
+			obj.process(directData);
+			on.process(opaqueData);
+
+			for (int i = 0; i < 512; i += 37)
+				expectEquals(opaqueBuffer.getSample(0, i), directBuffer.getSample(0, i), id + " with channel mismatch at data[0][" + String(i) + "]");
+		}
 	}
 
 	template <typename T> void testOpaqueNode(node_test& t, const String& v)
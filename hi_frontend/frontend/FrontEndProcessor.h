@@ -380,6 +380,7 @@ struct ScopedAnalyser
 	ScopedAnalyser(MainController*, Processor*, const AudioSampleBuffer&, int)
 	{}
 
+	static bool isAnalysed(MainController*, Processor*) { return false; }
 };
 
 } // namespace hise
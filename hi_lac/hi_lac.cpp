@@ -32,6 +32,16 @@
 
 #include "hi_lac.h"
 
+#if JUCE_LINUX || JUCE_MAC
+#include <sys/mman.h>
+#endif
+
+#if HLAC_SIMD_X86
+#include <immintrin.h>
+#elif HLAC_SIMD_NEON
+#include "../hi_tools/hi_tools/sse2neon.h"
+#endif
+
 #include "hlac/BitCompressors.cpp"
 #include "hlac/CompressionHelpers.cpp"
 #include "hlac/SampleBuffer.cpp"
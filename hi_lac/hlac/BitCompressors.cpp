@@ -148,6 +148,459 @@ void unpackArrayOfInt16(int16* d, int /*numValues*/, uint8 bitDepth)
 }
 
 
+#if HLAC_SIMD_X86 && (JUCE_GCC || JUCE_CLANG)
+#define HLAC_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define HLAC_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define HLAC_TARGET_SSSE3
+#define HLAC_TARGET_AVX2
+#endif
+
+static std::atomic<int> currentInstructionSet { -1 };
+
+SIMDKernels::InstructionSet SIMDKernels::getBestInstructionSet()
+{
+#if HLAC_SIMD_X86
+	if (SystemStats::hasAVX2())
+		return InstructionSet::AVX2;
+
+	if (SystemStats::hasSSSE3())
+		return InstructionSet::SSSE3;
+#elif HLAC_SIMD_NEON
+	return InstructionSet::NEON;
+#endif
+
+	return InstructionSet::Scalar;
+}
+
+bool SIMDKernels::isAvailable(InstructionSet s)
+{
+	switch (s)
+	{
+	case InstructionSet::Scalar: return true;
+#if HLAC_SIMD_X86
+	case InstructionSet::SSSE3:	 return SystemStats::hasSSSE3();
+	case InstructionSet::AVX2:	 return SystemStats::hasAVX2();
+#elif HLAC_SIMD_NEON
+	case InstructionSet::NEON:	 return true;
+#endif
+	default:					 return false;
+	}
+}
+
+void SIMDKernels::setInstructionSet(InstructionSet s)
+{
+	jassert(isAvailable(s));
+
+	if (isAvailable(s))
+		currentInstructionSet.store((int)s);
+}
+
+SIMDKernels::InstructionSet SIMDKernels::getInstructionSet()
+{
+	auto s = currentInstructionSet.load();
+
+	if (s == -1)
+	{
+		s = (int)getBestInstructionSet();
+		currentInstructionSet.store(s);
+	}
+
+	return (InstructionSet)s;
+}
+
+String SIMDKernels::getName(InstructionSet s)
+{
+	switch (s)
+	{
+	case InstructionSet::Scalar: return "Scalar";
+	case InstructionSet::SSSE3:	 return "SSSE3";
+	case InstructionSet::AVX2:	 return "AVX2";
+	case InstructionSet::NEON:	 return "NEON";
+	default:					 return {};
+	}
+}
+
+#if HLAC_SIMD_X86 || HLAC_SIMD_NEON
+
+/** The shuffle masks and multipliers for unpacking eight values from a bit stream of 16 bit words (MSB first).
+
+	Every value is combined from the word it starts in (shifted left by its bit offset) and the next word
+	(shifted right by 16 - offset), then the result is shifted down to the bit depth. SSE has no variable
+	16 bit shifts, so the shifts are done with a multiplication by 2^offset (mullo for the left shift and
+	mulhi for the right shift).
+*/
+struct GroupLayout
+{
+	GroupLayout(int bitDepth_) :
+		bitDepth(bitDepth_),
+		bias((int16)((1 << (bitDepth_ - 1)) - 1))
+	{
+		for (int i = 0; i < 8; i++)
+		{
+			const int bitPosition = i * bitDepth;
+			const int wordIndex = bitPosition / 16;
+			const int offset = bitPosition % 16;
+
+			// The last value never needs the word after the group for even bit depths
+			const int nextWordIndex = jmin(wordIndex + 1, 7);
+
+			currentWord[2 * i] = (int8)(2 * wordIndex);
+			currentWord[2 * i + 1] = (int8)(2 * wordIndex + 1);
+			nextWord[2 * i] = (int8)(2 * nextWordIndex);
+			nextWord[2 * i + 1] = (int8)(2 * nextWordIndex + 1);
+			multiplier[i] = (uint16)(1 << offset);
+		}
+	}
+
+	/** Returns the layout for the bit depth or nullptr if there is no SIMD kernel for it. */
+	static const GroupLayout* get(int bitDepth)
+	{
+		static const GroupLayout l6(6), l10(10), l12(12), l14(14);
+
+		switch (bitDepth)
+		{
+		case 6:  return &l6;
+		case 10: return &l10;
+		case 12: return &l12;
+		case 14: return &l14;
+		default: return nullptr;
+		}
+	}
+
+	alignas(16) int8 currentWord[16];
+	alignas(16) int8 nextWord[16];
+	alignas(16) uint16 multiplier[8];
+
+	const int bitDepth;
+	const int16 bias;
+};
+
+HLAC_TARGET_SSSE3 static int unpackGroupsSSE(int16* destination, const uint8* data, int numValues, int numBytesAvailable, const GroupLayout& l)
+{
+	const auto currentWord = _mm_load_si128((const __m128i*)l.currentWord);
+	const auto nextWord = _mm_load_si128((const __m128i*)l.nextWord);
+	const auto multiplier = _mm_load_si128((const __m128i*)l.multiplier);
+	const auto bias = _mm_set1_epi16(l.bias);
+	const int rightShift = 16 - l.bitDepth;
+	const int numBytesPerGroup = l.bitDepth;
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 8 && numBytesAvailable >= 16)
+	{
+		auto d = _mm_loadu_si128((const __m128i*)data);
+
+		auto hi = _mm_mullo_epi16(_mm_shuffle_epi8(d, currentWord), multiplier);
+		auto lo = _mm_mulhi_epu16(_mm_shuffle_epi8(d, nextWord), multiplier);
+		auto v = _mm_srli_epi16(_mm_or_si128(hi, lo), rightShift);
+
+		_mm_storeu_si128((__m128i*)(destination + numDone), _mm_sub_epi16(v, bias));
+
+		data += numBytesPerGroup;
+		numBytesAvailable -= numBytesPerGroup;
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+HLAC_TARGET_SSSE3 static int unpackFourBitSSE(int16* destination, const uint8* data, int numValues)
+{
+	const auto nibbleMask = _mm_set1_epi8(0x0F);
+	const auto valueMask = _mm_set1_epi16(0x07);
+	const auto signMask = _mm_set1_epi16(0x08);
+	const auto zero = _mm_setzero_si128();
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 16)
+	{
+		auto bytes = _mm_loadl_epi64((const __m128i*)data);
+
+		// the low nibble is the first value
+		auto lowNibbles = _mm_and_si128(bytes, nibbleMask);
+		auto highNibbles = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask);
+		auto nibbles = _mm_unpacklo_epi8(lowNibbles, highNibbles);
+
+		auto n1 = _mm_unpacklo_epi8(nibbles, zero);
+		auto n2 = _mm_unpackhi_epi8(nibbles, zero);
+
+		auto neg1 = _mm_cmpeq_epi16(_mm_and_si128(n1, signMask), signMask);
+		auto neg2 = _mm_cmpeq_epi16(_mm_and_si128(n2, signMask), signMask);
+
+		auto v1 = _mm_sub_epi16(_mm_xor_si128(_mm_and_si128(n1, valueMask), neg1), neg1);
+		auto v2 = _mm_sub_epi16(_mm_xor_si128(_mm_and_si128(n2, valueMask), neg2), neg2);
+
+		_mm_storeu_si128((__m128i*)(destination + numDone), v1);
+		_mm_storeu_si128((__m128i*)(destination + numDone + 8), v2);
+
+		data += 8;
+		numDone += 16;
+	}
+
+	return numDone;
+}
+
+HLAC_TARGET_SSSE3 static int unpackEightBitSSE(int16* destination, const uint8* data, int numValues)
+{
+	int numDone = 0;
+
+	while (numValues - numDone >= 8)
+	{
+		auto bytes = _mm_loadl_epi64((const __m128i*)data);
+		auto v = _mm_srai_epi16(_mm_unpacklo_epi8(bytes, bytes), 8);
+
+		_mm_storeu_si128((__m128i*)(destination + numDone), v);
+
+		data += 8;
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+HLAC_TARGET_SSSE3 static int addSSE(int16* destination, const int16* source, int numValues)
+{
+	int numDone = 0;
+
+	while (numValues - numDone >= 8)
+	{
+		auto d = _mm_loadu_si128((const __m128i*)(destination + numDone));
+		auto s = _mm_loadu_si128((const __m128i*)(source + numDone));
+
+		_mm_storeu_si128((__m128i*)(destination + numDone), _mm_add_epi16(d, s));
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+HLAC_TARGET_SSSE3 static int int16ToFloatSSE(float* destination, const int16* source, int numValues, float gainFactor)
+{
+	const auto g = _mm_set1_ps(gainFactor);
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 8)
+	{
+		auto v = _mm_loadu_si128((const __m128i*)(source + numDone));
+
+		// sign extend by moving the value to the upper half
+		auto v1 = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+		auto v2 = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+
+		_mm_storeu_ps(destination + numDone, _mm_mul_ps(_mm_cvtepi32_ps(v1), g));
+		_mm_storeu_ps(destination + numDone + 4, _mm_mul_ps(_mm_cvtepi32_ps(v2), g));
+
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+HLAC_TARGET_SSSE3 static int int16ToFloatDividedSSE(float* destination, const int16* source, int numValues, float divisor)
+{
+	const auto d = _mm_set1_ps(divisor);
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 8)
+	{
+		auto v = _mm_loadu_si128((const __m128i*)(source + numDone));
+
+		auto v1 = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+		auto v2 = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+
+		_mm_storeu_ps(destination + numDone, _mm_div_ps(_mm_cvtepi32_ps(v1), d));
+		_mm_storeu_ps(destination + numDone + 4, _mm_div_ps(_mm_cvtepi32_ps(v2), d));
+
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+#endif
+
+#if HLAC_SIMD_X86
+
+HLAC_TARGET_AVX2 static int unpackGroupsAVX(int16* destination, const uint8* data, int numValues, int numBytesAvailable, const GroupLayout& l)
+{
+	const auto currentWord = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)l.currentWord));
+	const auto nextWord = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)l.nextWord));
+	const auto multiplier = _mm256_broadcastsi128_si256(_mm_load_si128((const __m128i*)l.multiplier));
+	const auto bias = _mm256_set1_epi16(l.bias);
+	const int rightShift = 16 - l.bitDepth;
+	const int numBytesPerGroup = l.bitDepth;
+
+	int numDone = 0;
+
+	// two groups per iteration (one in each 128 bit lane)
+	while (numValues - numDone >= 16 && numBytesAvailable >= numBytesPerGroup + 16)
+	{
+		auto g1 = _mm_loadu_si128((const __m128i*)data);
+		auto g2 = _mm_loadu_si128((const __m128i*)(data + numBytesPerGroup));
+		auto d = _mm256_inserti128_si256(_mm256_castsi128_si256(g1), g2, 1);
+
+		auto hi = _mm256_mullo_epi16(_mm256_shuffle_epi8(d, currentWord), multiplier);
+		auto lo = _mm256_mulhi_epu16(_mm256_shuffle_epi8(d, nextWord), multiplier);
+		auto v = _mm256_srli_epi16(_mm256_or_si256(hi, lo), rightShift);
+
+		_mm256_storeu_si256((__m256i*)(destination + numDone), _mm256_sub_epi16(v, bias));
+
+		data += 2 * numBytesPerGroup;
+		numBytesAvailable -= 2 * numBytesPerGroup;
+		numDone += 16;
+	}
+
+	return numDone + unpackGroupsSSE(destination + numDone, data, numValues - numDone, numBytesAvailable, l);
+}
+
+HLAC_TARGET_AVX2 static int addAVX(int16* destination, const int16* source, int numValues)
+{
+	int numDone = 0;
+
+	while (numValues - numDone >= 16)
+	{
+		auto d = _mm256_loadu_si256((const __m256i*)(destination + numDone));
+		auto s = _mm256_loadu_si256((const __m256i*)(source + numDone));
+
+		_mm256_storeu_si256((__m256i*)(destination + numDone), _mm256_add_epi16(d, s));
+		numDone += 16;
+	}
+
+	return numDone + addSSE(destination + numDone, source + numDone, numValues - numDone);
+}
+
+HLAC_TARGET_AVX2 static int int16ToFloatAVX(float* destination, const int16* source, int numValues, float gainFactor)
+{
+	const auto g = _mm256_set1_ps(gainFactor);
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 8)
+	{
+		auto v = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(source + numDone)));
+		_mm256_storeu_ps(destination + numDone, _mm256_mul_ps(_mm256_cvtepi32_ps(v), g));
+
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+HLAC_TARGET_AVX2 static int int16ToFloatDividedAVX(float* destination, const int16* source, int numValues, float divisor)
+{
+	const auto d = _mm256_set1_ps(divisor);
+
+	int numDone = 0;
+
+	while (numValues - numDone >= 8)
+	{
+		auto v = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i*)(source + numDone)));
+		_mm256_storeu_ps(destination + numDone, _mm256_div_ps(_mm256_cvtepi32_ps(v), d));
+
+		numDone += 8;
+	}
+
+	return numDone;
+}
+
+#endif
+
+int SIMDKernels::unpackGroups(int16* destination, const uint8* data, int numValues, int numBytesAvailable, int bitDepth)
+{
+	auto l = GroupLayout::get(bitDepth);
+
+	// Let the scalar code decode an unsupported bit depth
+	if (l == nullptr)
+		return 0;
+
+	switch (getInstructionSet())
+	{
+#if HLAC_SIMD_X86
+	case InstructionSet::AVX2:  return unpackGroupsAVX(destination, data, numValues, numBytesAvailable, *l);
+	case InstructionSet::SSSE3: return unpackGroupsSSE(destination, data, numValues, numBytesAvailable, *l);
+#elif HLAC_SIMD_NEON
+	case InstructionSet::NEON:  return unpackGroupsSSE(destination, data, numValues, numBytesAvailable, *l);
+#endif
+	default:					ignoreUnused(destination, data, numValues, numBytesAvailable); return 0;
+	}
+}
+
+int SIMDKernels::unpackFourBit(int16* destination, const uint8* data, int numValues)
+{
+	if (getInstructionSet() == InstructionSet::Scalar)
+		return 0;
+
+#if HLAC_SIMD_X86 || HLAC_SIMD_NEON
+	return unpackFourBitSSE(destination, data, numValues);
+#else
+	ignoreUnused(destination, data, numValues);
+	return 0;
+#endif
+}
+
+int SIMDKernels::unpackEightBit(int16* destination, const uint8* data, int numValues)
+{
+	if (getInstructionSet() == InstructionSet::Scalar)
+		return 0;
+
+#if HLAC_SIMD_X86 || HLAC_SIMD_NEON
+	return unpackEightBitSSE(destination, data, numValues);
+#else
+	ignoreUnused(destination, data, numValues);
+	return 0;
+#endif
+}
+
+int SIMDKernels::add(int16* destination, const int16* source, int numValues)
+{
+	switch (getInstructionSet())
+	{
+#if HLAC_SIMD_X86
+	case InstructionSet::AVX2:  return addAVX(destination, source, numValues);
+	case InstructionSet::SSSE3: return addSSE(destination, source, numValues);
+#elif HLAC_SIMD_NEON
+	case InstructionSet::NEON:  return addSSE(destination, source, numValues);
+#endif
+	default:					ignoreUnused(destination, source, numValues); return 0;
+	}
+}
+
+int SIMDKernels::int16ToFloat(float* destination, const int16* source, int numValues, float gainFactor)
+{
+	switch (getInstructionSet())
+	{
+#if HLAC_SIMD_X86
+	case InstructionSet::AVX2:  return int16ToFloatAVX(destination, source, numValues, gainFactor);
+	case InstructionSet::SSSE3: return int16ToFloatSSE(destination, source, numValues, gainFactor);
+#elif HLAC_SIMD_NEON
+	case InstructionSet::NEON:  return int16ToFloatSSE(destination, source, numValues, gainFactor);
+#endif
+	default:					ignoreUnused(destination, source, numValues, gainFactor); return 0;
+	}
+}
+
+int SIMDKernels::int16ToFloatDivided(float* destination, const int16* source, int numValues, float divisor)
+{
+	switch (getInstructionSet())
+	{
+#if HLAC_SIMD_X86
+	case InstructionSet::AVX2:  return int16ToFloatDividedAVX(destination, source, numValues, divisor);
+	case InstructionSet::SSSE3: return int16ToFloatDividedSSE(destination, source, numValues, divisor);
+#elif HLAC_SIMD_NEON && defined(__aarch64__) // sse2neon only uses a real division on AArch64
+	case InstructionSet::NEON:  return int16ToFloatDividedSSE(destination, source, numValues, divisor);
+#endif
+	default:					ignoreUnused(destination, source, numValues, divisor); return 0;
+	}
+}
+
+#undef HLAC_TARGET_SSSE3
+#undef HLAC_TARGET_AVX2
+
+
 int BitCompressors::ZeroBit::getAllowedBitRange() const
 {
 	return 0;
@@ -431,7 +884,11 @@ bool BitCompressors::FourBit::compress(uint8* destination, const int16* data, in
 
 bool BitCompressors::FourBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
-	
+	const int numSIMD = SIMDKernels::unpackFourBit(destination, data, numValuesToDecompress);
+
+	destination += numSIMD;
+	data += numSIMD / 2;
+	numValuesToDecompress -= numSIMD;
 
 	const uint8 signMasks[2] =  { 0b00001000, 0b10000000 };
 	const uint8 valueMasks[2] = { 0b00000111, 0b01110000 };
@@ -543,6 +1000,12 @@ bool BitCompressors::SixBit::compress(uint8* destination, const int16* data, int
 
 bool BitCompressors::SixBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	const int numSIMD = SIMDKernels::unpackGroups(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 6);
+
+	destination += numSIMD;
+	data += (numSIMD / 8) * 6;
+	numValuesToDecompress -= numSIMD;
+
 #if JUCE_IOS
 	while (numValuesToDecompress >= 8)
 	{
@@ -703,6 +1166,12 @@ bool BitCompressors::EightBit::compress(uint8* destination, const int16* data, i
 
 bool BitCompressors::EightBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	const int numSIMD = SIMDKernels::unpackEightBit(destination, data, numValuesToDecompress);
+
+	destination += numSIMD;
+	data += numSIMD;
+	numValuesToDecompress -= numSIMD;
+
     while (--numValuesToDecompress >= 0)
 	{
 		const int8 value = *reinterpret_cast<const int8*>(data++);
@@ -790,6 +1259,12 @@ bool BitCompressors::TenBit::compress(uint8* destination, const int16* data, int
 
 bool BitCompressors::TenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	const int numSIMD = SIMDKernels::unpackGroups(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 10);
+
+	destination += numSIMD;
+	data += (numSIMD / 8) * 10;
+	numValuesToDecompress -= numSIMD;
+
 	while (numValuesToDecompress >= 8)
 	{
 		decompress10Bit(reinterpret_cast<uint16*>(destination), (void*)data);
@@ -884,6 +1359,12 @@ bool BitCompressors::TwelveBit::decompress(int16* destination, const uint8* data
 
 #else
 
+	const int numSIMD = SIMDKernels::unpackGroups(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 12);
+
+	destination += numSIMD;
+	data += (numSIMD / 8) * 12;
+	numValuesToDecompress -= numSIMD;
+
 	int16* dst = destination;
 
 	while (numValuesToDecompress >= 4)
@@ -1002,6 +1483,12 @@ bool BitCompressors::FourteenBit::compress(uint8* destination, const int16* data
 
 bool BitCompressors::FourteenBit::decompress(int16* destination, const uint8* data, int numValuesToDecompress)
 {
+	const int numSIMD = SIMDKernels::unpackGroups(destination, data, numValuesToDecompress, getByteAmount(numValuesToDecompress), 14);
+
+	destination += numSIMD;
+	data += (numSIMD / 8) * 14;
+	numValuesToDecompress -= numSIMD;
+
 	while (numValuesToDecompress >= 8)
 	{
 		decompress14Bit(destination, data);
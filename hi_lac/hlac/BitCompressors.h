@@ -45,6 +45,79 @@ namespace hlac { using namespace juce;
 #include <ipp.h>
 #endif
 
+#if JUCE_INTEL && !HI_ENABLE_LEGACY_CPU_SUPPORT
+#define HLAC_SIMD_X86 1
+#else
+#define HLAC_SIMD_X86 0
+#endif
+
+#if JUCE_ARM && !HI_ENABLE_LEGACY_CPU_SUPPORT
+#define HLAC_SIMD_NEON 1
+#else
+#define HLAC_SIMD_NEON 0
+#endif
+
+/** The vectorised kernels that are used by the HLAC decoder.
+
+	The best instruction set is detected at runtime, but you can override it to compare the
+	performance (or results) against the scalar reference implementation. The NEON path uses
+	the SSE code through the sse2neon translation layer.
+
+	All kernels return the number of values they have processed, so the caller needs to
+	process the remainder with the scalar implementation.
+*/
+struct SIMDKernels
+{
+	enum class InstructionSet
+	{
+		Scalar = 0,
+		SSSE3,
+		AVX2,
+		NEON,
+		numInstructionSets
+	};
+
+	/** Returns the best instruction set that is supported by the CPU. */
+	static InstructionSet getBestInstructionSet();
+
+	/** Checks whether the CPU supports the given instruction set. */
+	static bool isAvailable(InstructionSet s);
+
+	/** Overrides the instruction set that is used by the decoder. */
+	static void setInstructionSet(InstructionSet s);
+
+	static InstructionSet getInstructionSet();
+
+	static String getName(InstructionSet s);
+
+	/** Unpacks groups of eight values with the given bit depth (6, 10, 12 or 14 bit).
+
+		The kernels might read up to 16 bytes per group, so you need to pass the number of bytes
+		that can be safely accessed. Returns the number of unpacked values, which is zero for any
+		other bit depth, so the scalar code decodes the rest.
+	*/
+	static int unpackGroups(int16* destination, const uint8* data, int numValues, int numBytesAvailable, int bitDepth);
+
+	/** Unpacks two sign-magnitude values per byte. */
+	static int unpackFourBit(int16* destination, const uint8* data, int numValues);
+
+	/** Sign-extends bytes to int16 values. */
+	static int unpackEightBit(int16* destination, const uint8* data, int numValues);
+
+	/** Adds the source to the destination (wraps around on overflow like the scalar version). */
+	static int add(int16* destination, const int16* source, int numValues);
+
+	/** Converts int16 values to float and multiplies them with the given factor. */
+	static int int16ToFloat(float* destination, const int16* source, int numValues, float gainFactor);
+
+	/** Converts int16 values to float and divides them by the given divisor.
+
+		Multiplying with the reciprocal rounds differently for some values, so use this if the
+		result must match a scalar division.
+	*/
+	static int int16ToFloatDivided(float* destination, const int16* source, int numValues, float divisor);
+};
+
 struct BitCompressors
 {
 	struct Base
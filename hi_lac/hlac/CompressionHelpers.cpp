@@ -534,7 +534,10 @@ void CompressionHelpers::fastInt16ToFloat(const void* source, float* dest, int n
 {
 #if HI_ENABLE_LEGACY_CPU_SUPPORT || !JUCE_WINDOWS
 
-	AudioDataConverters::convertInt16LEToFloat(source, dest, numSamples);
+	const int numSIMD = SIMDKernels::int16ToFloat(dest, static_cast<const int16*>(source), numSamples, 1.0f / 0x7fff);
+
+	if (numSIMD < numSamples)
+		AudioDataConverters::convertInt16LEToFloat(static_cast<const int16*>(source) + numSIMD, dest + numSIMD, numSamples - numSIMD);
 
 #else
 
@@ -732,7 +735,9 @@ void CompressionHelpers::IntVectorOperations::sub(int16* dst, const int16* src,
 
 void CompressionHelpers::IntVectorOperations::add(int16* dst, const int16* src, int numSamples)
 {
-	for (int i = 0; i < numSamples; i++)
+	const int numSIMD = SIMDKernels::add(dst, src, numSamples);
+
+	for (int i = numSIMD; i < numSamples; i++)
 	{
 		dst[i] += src[i];
 	}
@@ -1835,7 +1840,10 @@ void CompressionHelpers::NormaliseMap::normalisedInt16ToFloat(float* destination
 		{
 			float gainFactor = (float)(1 << thisAmount);
 
-			for (int i = 0; i < numThisTime; i++)
+			// the SIMD kernel divides too, so the output is bit-identical to the scalar path
+			const int numSIMD = SIMDKernels::int16ToFloatDivided(w, r, numThisTime, (float)INT16_MAX * gainFactor);
+
+			for (int i = numSIMD; i < numThisTime; i++)
 			{
 				w[i] = (float)r[i] / ((float)INT16_MAX * gainFactor);
 			}
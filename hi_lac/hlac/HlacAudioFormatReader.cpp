@@ -464,6 +464,57 @@ bool HlacMemoryMappedAudioFormatReader::mapSectionOfFile(Range<int64> samplesToM
 	}
 }
 
+void HlacMemoryMappedAudioFormatReader::prefetch(int64 startSample, int numSamples)
+{
+	if (map == nullptr || numSamples <= 0)
+		return;
+
+	const auto mapRange = map->getRange();
+
+	int64 byteStart, byteEnd;
+
+	if (isMonolith)
+	{
+		byteStart = sampleToFilePos(startSample);
+		byteEnd = sampleToFilePos(startSample + numSamples);
+	}
+	else
+	{
+		if (!isPositiveAndBelow(startSample, lengthInSamples))
+			return;
+
+		const int64 endSample = startSample + numSamples;
+		const int64 numBlocks = (lengthInSamples + COMPRESSION_BLOCK_SIZE - 1) / COMPRESSION_BLOCK_SIZE;
+
+		byteStart = (int64)internalReader.header.getOffsetForReadPosition(startSample, true);
+
+		if (endSample / COMPRESSION_BLOCK_SIZE + 1 >= numBlocks)
+			byteEnd = mapRange.getEnd();
+		else
+			byteEnd = (int64)internalReader.header.getOffsetForNextBlock(endSample, true);
+	}
+
+	auto r = mapRange.getIntersectionWith({ byteStart, byteEnd });
+
+	if (!r.isEmpty())
+		adviseWillNeed(addBytesToPointer(map->getData(), r.getStart() - mapRange.getStart()), r.getLength());
+}
+
+void HlacMemoryMappedAudioFormatReader::adviseWillNeed(const void* data, int64 numBytes)
+{
+#if JUCE_LINUX || JUCE_MAC
+	static const auto pageSize = (pointer_sized_int)sysconf(_SC_PAGESIZE);
+
+	// madvise needs a page aligned address
+	auto address = reinterpret_cast<pointer_sized_int>(data);
+	auto alignedAddress = address - (address % pageSize);
+
+	posix_madvise(reinterpret_cast<void*>(alignedAddress), (size_t)(numBytes + (address - alignedAddress)), POSIX_MADV_WILLNEED);
+#else
+	ignoreUnused(data, numBytes);
+#endif
+}
+
 void HlacMemoryMappedAudioFormatReader::setTargetAudioDataType(AudioDataConverters::DataFormat dataType)
 {
 	usesFloatingPointData = (dataType == AudioDataConverters::DataFormat::float32BE) ||
@@ -566,6 +617,12 @@ void HlacSubSectionReader::readMaxLevels(int64 startSampleInFile, int64 numSampl
 		normalReader->readMaxLevels(startSampleInFile + start, numSamples, results, numChannelsToRead);
 }
 
+void HlacSubSectionReader::prefetch(int64 readerStartSample, int numSamples)
+{
+	if (memoryReader != nullptr)
+		memoryReader->prefetch(start + readerStartSample, numSamples);
+}
+
 void HlacSubSectionReader::readIntoFixedBuffer(HiseSampleBuffer& buffer, int startSample, int numSamples, int64 readerStartSample)
 {
 	if (isMonolith)
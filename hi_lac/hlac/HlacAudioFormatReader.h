@@ -188,6 +188,15 @@ public:
 
 	void setTargetAudioDataType(AudioDataConverters::DataFormat dataType);
 
+	/** Tells the OS that the given sample range will be read soon, so that it can fetch the pages asynchronously.
+	*
+	*	This does not block and is a no-op if the range is not mapped or the platform doesn't support it.
+	*/
+	void prefetch(int64 startSample, int numSamples);
+
+	/** Hints the OS to load the pages of the given memory region in the background. */
+	static void adviseWillNeed(const void* data, int64 numBytes);
+
 private:
 	
 	friend class HlacSubSectionReader;
@@ -215,6 +224,9 @@ public:
 
 	void readIntoFixedBuffer(HiseSampleBuffer& buffer, int startSample, int numSamples, int64 readerStartSample);
 
+	/** Prefetches the data for the given range if the source is memory mapped. */
+	void prefetch(int64 readerStartSample, int numSamples);
+
 private:
 
 	bool isMonolith = false;
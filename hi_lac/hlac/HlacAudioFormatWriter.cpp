@@ -85,6 +85,11 @@ void HiseLosslessAudioFormatWriter::setEnableFullDynamics(bool shouldEnableFullD
 	encoder.setOptions(options);
 }
 
+void HiseLosslessAudioFormatWriter::setNumEncoderThreads(int numThreads)
+{
+	encoder.setNumThreads(numThreads);
+}
+
 bool HiseLosslessAudioFormatWriter::write(const int** samplesToWrite, int numSamples)
 {
 	tempWasFlushed = false;
@@ -58,6 +58,12 @@ public:
 
 	void setEnableFullDynamics(bool shouldEnableFullDynamics);
 
+	/** Encodes the blocks of every write call with multiple threads (see HlacEncoder::setNumThreads()). 
+	
+		Make sure you write big chunks (a multiple of COMPRESSION_BLOCK_SIZE) to get the most out of it.
+	*/
+	void setNumEncoderThreads(int numThreads);
+
 	bool write(const int** samplesToWrite, int numSamples) override;
 
 	double getCompressionRatioForLastFile() { return encoder.getCompressionRatio(); }
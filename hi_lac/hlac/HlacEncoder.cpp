@@ -36,62 +36,41 @@ void HlacEncoder::compress(AudioSampleBuffer& source, OutputStream& output, uint
 {
 	bool compressStereo = source.getNumChannels() == 2;
 
-	if (options.normalisationMode == CompressionHelpers::NormaliseMap::Mode::StaticNormalisation)
-	{
-		auto maxLevel = source.getMagnitude(0, source.getNumSamples());
-		auto db = -1.0f * Decibels::gainToDecibels(maxLevel);
-		currentNormaliseBitShiftAmount = jmin<int>(8, (int)(db / 6.0f));
-	}
-	else
-		currentNormaliseBitShiftAmount = 0;
-
 	if (source.getNumSamples() == COMPRESSION_BLOCK_SIZE)
 	{
 		blockOffsetData[blockIndex] = numBytesWritten;
 		++blockIndex;
 
-		if (compressStereo)
-		{
-			auto l = CompressionHelpers::getPart(source, 0, 0, COMPRESSION_BLOCK_SIZE);
-			auto r = CompressionHelpers::getPart(source, 1, 0, COMPRESSION_BLOCK_SIZE);
+		currentNormaliseBitShiftAmount = getStaticNormalisationAmount(source, 0);
 
-			encodeBlock(l, output);
-			encodeBlock(r, output);
-		}
-		else
-			encodeBlock(source, output);
+		encodeFullBlock(source, 0, output);
 
 		return;
 	}
 
 	blockOffset = 0;
-	int32 numSamplesRemaining = source.getNumSamples();
-
-	while (numSamplesRemaining >= COMPRESSION_BLOCK_SIZE)
-	{
-		blockOffsetData[blockIndex] = numBytesWritten;
-		++blockIndex;
 
-		uint32 numTodo = jmin<int>(COMPRESSION_BLOCK_SIZE, source.getNumSamples());
+	const int numFullBlocks = source.getNumSamples() / COMPRESSION_BLOCK_SIZE;
 
-		if (compressStereo)
+	if (pool != nullptr && numFullBlocks > 1)
+	{
+		compressParallel(source, numFullBlocks, output, blockOffsetData);
+		blockOffset = (uint32)(numFullBlocks * COMPRESSION_BLOCK_SIZE);
+	}
+	else
+	{
+		for (int i = 0; i < numFullBlocks; i++)
 		{
-			auto l = CompressionHelpers::getPart(source, 0, blockOffset, numTodo);
-			auto r = CompressionHelpers::getPart(source, 1, blockOffset, numTodo);
+			blockOffsetData[blockIndex] = numBytesWritten;
+			++blockIndex;
 
-			encodeBlock(l, output);
-			encodeBlock(r, output);
-		}
-		else
-		{
-			auto b = CompressionHelpers::getPart(source, blockOffset, numTodo);
-			
-			encodeBlock(b, output);
-		}
+			if (blockOffset % StaticNormalisationSegmentSize == 0)
+				currentNormaliseBitShiftAmount = getStaticNormalisationAmount(source, (int)blockOffset);
 
-		blockOffset += numTodo;
+			encodeFullBlock(source, (int)blockOffset, output);
 
-		numSamplesRemaining -= numTodo;
+			blockOffset += COMPRESSION_BLOCK_SIZE;
+		}
 	}
 
 	if (source.getNumSamples() - blockOffset > 0)
@@ -99,6 +78,8 @@ void HlacEncoder::compress(AudioSampleBuffer& source, OutputStream& output, uint
 		blockOffsetData[blockIndex] = numBytesWritten;
 		++blockIndex;
 
+		currentNormaliseBitShiftAmount = getStaticNormalisationAmount(source, (int)blockOffset);
+
 		const int remaining = source.getNumSamples() - blockOffset;
 
 		if (compressStereo)
@@ -119,6 +100,146 @@ void HlacEncoder::compress(AudioSampleBuffer& source, OutputStream& output, uint
 	
 }
 
+int HlacEncoder::getStaticNormalisationAmount(AudioSampleBuffer& source, int offset) const
+{
+	if (options.normalisationMode != CompressionHelpers::NormaliseMap::Mode::StaticNormalisation)
+		return 0;
+
+	const int segmentStart = (offset / StaticNormalisationSegmentSize) * StaticNormalisationSegmentSize;
+	const int numSamples = jmin(StaticNormalisationSegmentSize, source.getNumSamples() - segmentStart);
+
+	auto maxLevel = source.getMagnitude(segmentStart, numSamples);
+	auto db = -1.0f * Decibels::gainToDecibels(maxLevel);
+	return jmin<int>(8, (int)(db / 6.0f));
+}
+
+/** Encodes the blocks that are picked from a shared counter.
+
+	Every job has its own encoder (with the same options as the parent), so the jobs don't share any state
+	except for the block counter. A thread that is done with its block just grabs the next one, so the workload
+	is balanced even if some blocks take longer (eg. if the cycle length detection kicks in).
+*/
+struct HlacEncoder::ParallelEncodeJob : public ThreadPoolJob
+{
+	ParallelEncodeJob(HlacEncoder& parent, AudioSampleBuffer& source_, const Array<int>& normaliseAmounts_, OwnedArray<MemoryOutputStream>& encodedBlocks_, std::atomic<int>& nextBlockIndex_) :
+		ThreadPoolJob("HLAC Encoder"),
+		source(source_),
+		normaliseAmounts(normaliseAmounts_),
+		encodedBlocks(encodedBlocks_),
+		nextBlockIndex(nextBlockIndex_)
+	{
+		encoder.setOptions(parent.options);
+	}
+
+	JobStatus runJob() override
+	{
+		const int numBlocks = encodedBlocks.size();
+
+		for (int i = nextBlockIndex++; i < numBlocks; i = nextBlockIndex++)
+		{
+			const int offset = i * COMPRESSION_BLOCK_SIZE;
+
+			encoder.currentNormaliseBitShiftAmount = normaliseAmounts[offset / StaticNormalisationSegmentSize];
+			encoder.encodeFullBlock(source, offset, *encodedBlocks[i]);
+		}
+
+		return jobHasFinished;
+	}
+
+	HlacEncoder encoder;
+
+	AudioSampleBuffer& source;
+	const Array<int>& normaliseAmounts;
+	OwnedArray<MemoryOutputStream>& encodedBlocks;
+	std::atomic<int>& nextBlockIndex;
+};
+
+void HlacEncoder::setNumThreads(int newNumThreads)
+{
+	newNumThreads = jmax(1, newNumThreads);
+
+	if (numThreads != newNumThreads)
+	{
+		numThreads = newNumThreads;
+		pool = nullptr;
+
+		if (numThreads > 1)
+			pool = new SharedResourcePointer<SharedEncoderPool>();
+	}
+}
+
+void HlacEncoder::compressParallel(AudioSampleBuffer& source, int numBlocksToEncode, OutputStream& output, uint32* blockOffsetData)
+{
+	OwnedArray<MemoryOutputStream> encodedBlocks;
+
+	for (int i = 0; i < numBlocksToEncode; i++)
+	{
+		auto mos = new MemoryOutputStream();
+		mos->preallocate(COMPRESSION_BLOCK_SIZE * 2 * source.getNumChannels());
+		encodedBlocks.add(mos);
+	}
+
+	// Calculate the normalisation of every segment once so that the jobs don't have to do it per block
+	Array<int> normaliseAmounts;
+
+	for (int offset = 0; offset < numBlocksToEncode * COMPRESSION_BLOCK_SIZE; offset += StaticNormalisationSegmentSize)
+		normaliseAmounts.add(getStaticNormalisationAmount(source, offset));
+
+	std::atomic<int> nextBlockIndex(0);
+
+	auto& sharedPool = (*pool)->pool;
+
+	OwnedArray<ParallelEncodeJob> jobs;
+
+	const int numJobs = jmin(numThreads, sharedPool.getNumThreads() + 1);
+
+	for (int i = 0; i < numJobs; i++)
+		jobs.add(new ParallelEncodeJob(*this, source, normaliseAmounts, encodedBlocks, nextBlockIndex));
+
+	for (int i = 1; i < jobs.size(); i++)
+		sharedPool.addJob(jobs[i], false);
+
+	// The calling thread does its share of the work too...
+	jobs[0]->runJob();
+
+	for (int i = 1; i < jobs.size(); i++)
+		sharedPool.waitForJobToFinish(jobs[i], -1);
+
+	for (auto mos : encodedBlocks)
+	{
+		blockOffsetData[blockIndex] = numBytesWritten;
+		++blockIndex;
+
+		output.write(mos->getData(), mos->getDataSize());
+		numBytesWritten += (uint32)mos->getDataSize();
+	}
+
+	for (auto j : jobs)
+	{
+		numBytesUncompressed += j->encoder.numBytesUncompressed;
+		numTemplates += j->encoder.numTemplates;
+		numDeltas += j->encoder.numDeltas;
+	}
+}
+
+void HlacEncoder::encodeFullBlock(AudioSampleBuffer& source, int offset, OutputStream& output)
+{
+	if (source.getNumChannels() == 2)
+	{
+		auto l = CompressionHelpers::getPart(source, 0, offset, COMPRESSION_BLOCK_SIZE);
+		auto r = CompressionHelpers::getPart(source, 1, offset, COMPRESSION_BLOCK_SIZE);
+
+		encodeBlock(l, output);
+		encodeBlock(r, output);
+	}
+	else
+	{
+		auto b = CompressionHelpers::getPart(source, offset, COMPRESSION_BLOCK_SIZE);
+
+		encodeBlock(b, output);
+	}
+}
+
 void HlacEncoder::reset()
 {
 	indexInBlock = 0;
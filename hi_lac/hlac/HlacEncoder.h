@@ -137,12 +137,38 @@ public:
 		options = newOptions;
 	}
 
+	/** Sets the number of threads that are used to encode the full blocks of a buffer.
+
+		Every block of COMPRESSION_BLOCK_SIZE samples is encoded independently, so they can be
+		compressed in parallel. The encoded blocks are written in their original order, so the
+		output does not depend on the number of threads. The calling thread takes part in the
+		encoding, so a value of 1 (the default) doesn't use any additional threads. 
+		
+		All encoders share a single thread pool with one thread less than the number of CPU cores.
+	*/
+	void setNumThreads(int newNumThreads);
+
 	float getCompressionRatio() const;
 
 	uint32 getNumBlocksWritten() const { return blockIndex; }
 
 private:
 
+	struct ParallelEncodeJob;
+
+	/** The static normalisation is calculated over segments of this size (the chunk size of AudioFormatWriter::writeFromAudioReader()).
+
+		This makes the normalisation amount of a block independent from the size of the buffers that are passed into compress(),
+		as long as they are a multiple of this size.
+	*/
+	static constexpr int StaticNormalisationSegmentSize = COMPRESSION_BLOCK_SIZE * 4;
+
+	int getStaticNormalisationAmount(AudioSampleBuffer& source, int offset) const;
+
+	void compressParallel(AudioSampleBuffer& source, int numBlocksToEncode, OutputStream& output, uint32* blockOffsetData);
+
+	void encodeFullBlock(AudioSampleBuffer& source, int offset, OutputStream& output);
+
 	bool encodeBlock(AudioSampleBuffer& block, OutputStream& output);
 
 	bool encodeBlock(CompressionHelpers::AudioBufferInt16& block, OutputStream& output);
@@ -207,6 +233,18 @@ private:
 	uint64 readIndex = 0;
 
 	double decompressionSpeed = 0.0;
+
+	struct SharedEncoderPool
+	{
+		SharedEncoderPool() :
+			pool(jmax(1, SystemStats::getNumCpus() - 1))
+		{}
+
+		ThreadPool pool;
+	};
+
+	int numThreads = 1;
+	ScopedPointer<SharedResourcePointer<SharedEncoderPool>> pool;
 };
 
 } // namespace hlac
@@ -60,6 +60,63 @@ compile / debug cycle and don't need all nodes in scriptnode you might want to t
 #define INCLUDE_BIG_SCRIPTNODE_OBJECT_COMPILATION 1
 #endif
 
+/** Config: HISE_JAVASCRIPT_BYTECODE
+
+If this is true, the callbacks and inline functions of HiseScript processors will be compiled to a register
+bytecode after the onInit callback was executed. Everything that can't be compiled (API calls, object access etc.)
+will still be evaluated by the interpreter.
+*/
+#ifndef HISE_JAVASCRIPT_BYTECODE
+#define HISE_JAVASCRIPT_BYTECODE 0
+#endif
+
+/** Config: HISE_FLAT_SCRIPTNODE_SCHEDULE
+
+If this is true, a DspNetwork will flatten its chain, split and multichannel containers into a list of process
+calls whenever its topology changes and use this list instead of the recursive container calls. It will still 
+use the recursive calls if the signal display or the CPU profiling is enabled.
+*/
+#ifndef HISE_FLAT_SCRIPTNODE_SCHEDULE
+#define HISE_FLAT_SCRIPTNODE_SCHEDULE 1
+#endif
+
+/** Config: HISE_RUN_UNIT_TEST_BENCHMARKS
+
+If this is true, the unit tests for the bytecode compiler and the scriptnode containers will also render a few thousand
+blocks with both implementations and log the timings. Leave this off for the normal test runs.
+*/
+#ifndef HISE_RUN_UNIT_TEST_BENCHMARKS
+#define HISE_RUN_UNIT_TEST_BENCHMARKS 0
+#endif
+
+/** Config: HISE_NUM_SNEX_COMPILE_THREADS
+
+The maximum number of threads that are used to compile the SNEX classes of a DspNetwork when it is created on the
+scripting or sample loading thread (it will never use more threads than there are CPU cores). Every SNEX class has
+its own GlobalScope, so they can be compiled independently. Set this to 1 to compile them one after another.
+*/
+#ifndef HISE_NUM_SNEX_COMPILE_THREADS
+#define HISE_NUM_SNEX_COMPILE_THREADS 8
+#endif
+
+/** Config: HISE_LOG_COMPILE_TIMINGS
+
+If this is true, the compilation time of every script processor and SNEX class will be printed to the console. 
+*/
+#ifndef HISE_LOG_COMPILE_TIMINGS
+#define HISE_LOG_COMPILE_TIMINGS 0
+#endif
+
+/** Config: HISE_SCRIPTNODE_PARALLEL_MIN_SAMPLES
+
+The minimum block size for a container.parallel_split node to distribute its branches across the realtime workers 
+(see HISE_NUM_AUDIO_WORKER_THREADS). Smaller blocks are processed serially because the hand-off to the workers would
+take longer than the processing itself.
+*/
+#ifndef HISE_SCRIPTNODE_PARALLEL_MIN_SAMPLES
+#define HISE_SCRIPTNODE_PARALLEL_MIN_SAMPLES 64
+#endif
+
 // Periodically dumps the value tree of a dsp network
 #define DUMP_SCRIPTNODE_VALUETREE 1
 
@@ -84,6 +84,8 @@
 #include "scripting/scriptnode/nodes/CodeGenerator.h"
 #include "scripting/scriptnode/nodes/NodeContainer.h"
 #include "scripting/scriptnode/nodes/NodeContainerTypes.h"
+#include "scripting/scriptnode/nodes/FlatProcessSchedule.h"
+#include "scripting/scriptnode/api/NetworkProfiler.h"
 #include "scripting/scriptnode/nodes/NodeWrapper.h"
 
 #include "scripting/scriptnode/nodes/ProcessNodes.h"
@@ -129,6 +131,7 @@
 
 #include "scripting/scriptnode/api/ModulationSourceNode.cpp"
 #include "scripting/scriptnode/api/DspNetwork.cpp"
+#include "scripting/scriptnode/api/NetworkProfiler.cpp"
 
 
 
@@ -163,6 +166,7 @@
 #include "scripting/scriptnode/nodes/CodeGenerator.cpp"
 #include "scripting/scriptnode/nodes/NodeContainer.cpp"
 #include "scripting/scriptnode/nodes/NodeContainerTypes.cpp"
+#include "scripting/scriptnode/nodes/FlatProcessSchedule.cpp"
 #include "scripting/scriptnode/nodes/NodeWrapper.cpp"
 #include "scripting/scriptnode/nodes/ProcessNodes.cpp"
 #include "scripting/scriptnode/nodes/JitNode.cpp"
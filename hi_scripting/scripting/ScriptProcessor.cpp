@@ -1486,8 +1486,14 @@ void JavascriptProcessor::compileScript(const ResultFunction& rf /*= ResultFunct
 	{
 		auto jp = dynamic_cast<JavascriptProcessor*>(p);
 
+		auto start = Time::getMillisecondCounterHiRes();
+
 		auto result = jp->compileInternal();
 
+		// This includes the SNEX classes that are compiled in the onInit callback
+		auto& timings = jp->mainController->getJavascriptThreadPool().getCompileTimings();
+		timings.add(p, "HiseScript", p->getId(), Time::getMillisecondCounterHiRes() - start);
+
 		auto postCompile = [result, rf](Dispatchable* obj)
 		{
 			
@@ -2278,6 +2284,60 @@ float ScriptBaseMidiProcessor::getDefaultValue(int index) const
 	return 0.0f;
 }
 
+void CompileTimings::add(Processor* p, const String& type, const String& id, double milliseconds)
+{
+	{
+		ScopedLock sl(lock);
+		items.add({ type, id, milliseconds });
+	}
+
+#if HISE_LOG_COMPILE_TIMINGS
+	if (p != nullptr)
+		debugToConsole(p, type + " " + id + " compiled in " + String(milliseconds, 1) + "ms");
+#else
+	ignoreUnused(p);
+#endif
+}
+
+Array<CompileTimings::Item> CompileTimings::getItems() const
+{
+	Array<Item> copy;
+
+	{
+		ScopedLock sl(lock);
+		copy.addArray(items);
+	}
+
+	struct Sorter
+	{
+		static int compareElements(const Item& a, const Item& b)
+		{
+			if (a.milliseconds > b.milliseconds) return -1;
+			if (a.milliseconds < b.milliseconds) return 1;
+			return 0;
+		}
+	} sorter;
+
+	copy.sort(sorter, true);
+	return copy;
+}
+
+void CompileTimings::clear()
+{
+	ScopedLock sl(lock);
+	items.clearQuick();
+}
+
+String CompileTimings::toString() const
+{
+	String s;
+
+	for (const auto& i : getItems())
+		s << i.type << " " << i.id << ": " << String(i.milliseconds, 1) << "ms\n";
+
+	return s;
+}
+
 JavascriptThreadPool::JavascriptThreadPool(MainController* mc) :
 	Thread("Javascript Thread", HISE_DEFAULT_STACK_SIZE),
 	ControlledObject(mc),
@@ -688,6 +688,38 @@ struct JavascriptSleepListener
 	JUCE_DECLARE_WEAK_REFERENCEABLE(JavascriptSleepListener);
 };
 
+/** Collects the compilation time of every script processor and SNEX class so that you can find the slow ones. 
+
+	If HISE_LOG_COMPILE_TIMINGS is enabled, every item will also be printed to the console.
+*/
+class CompileTimings
+{
+public:
+
+	struct Item
+	{
+		String type;
+		String id;
+		double milliseconds = 0.0;
+	};
+
+	/** Adds the compile time of an item. This can be called from any thread. */
+	void add(Processor* p, const String& type, const String& id, double milliseconds);
+
+	/** Returns all items sorted by their compile time (slowest first). */
+	Array<Item> getItems() const;
+
+	void clear();
+
+	/** Creates a table with all items. */
+	String toString() const;
+
+private:
+
+	CriticalSection lock;
+	Array<Item> items;
+};
+
 class JavascriptThreadPool : public Thread,
 							 public ControlledObject
 {
@@ -762,6 +794,8 @@ public:
 
 	GlobalServer* getGlobalServer();
 
+	CompileTimings& getCompileTimings() { return compileTimings; }
+
 	void resume();
 
 	void deactivateSleepUntilCompilation();
@@ -810,6 +844,8 @@ private:
 
 	ScopedPointer<GlobalServer> globalServer;
 
+	CompileTimings compileTimings;
+
 	using PendingCompilationList = Array<WeakReference<JavascriptProcessor>>;
 
 	void pushToQueue(const Task::Type& t, JavascriptProcessor* p, const Task::Function& f);
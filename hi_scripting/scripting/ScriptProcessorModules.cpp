@@ -1293,8 +1293,8 @@ void JavascriptTimeVariantModulator::prepareToPlay(double sampleRate, int sample
         n->setNumChannels(1);
     }
 
-	if(internalBuffer.getNumChannels() > 0)
-		buffer->referToData(internalBuffer.getWritePointer(0), samplesPerBlock);
+	if(internalBuffer->getNumChannels() > 0)
+		buffer->referToData(internalBuffer->getWritePointer(0), samplesPerBlock);
 
 	bufferVar = var(buffer.get());
 
@@ -1312,7 +1312,7 @@ void JavascriptTimeVariantModulator::calculateBlock(int startSample, int numSamp
 {
 	if (auto n = getActiveNetwork())
 	{
-		auto ptr = internalBuffer.getWritePointer(0, startSample);
+		auto ptr = internalBuffer->getWritePointer(0, startSample);
 		FloatVectorOperations::clear(ptr, numSamples);
 
 		snex::Types::ProcessDataDyn d(&ptr, numSamples, 1);
@@ -1327,7 +1327,7 @@ void JavascriptTimeVariantModulator::calculateBlock(int startSample, int numSamp
 	}
 	else if (!processBlockCallback->isSnippetEmpty() && lastResult.wasOk())
 	{
-		buffer->referToData(internalBuffer.getWritePointer(0, startSample), numSamples);
+		buffer->referToData(internalBuffer->getWritePointer(0, startSample), numSamples);
 
 		scriptEngine->setCallbackParameter(Callback::processBlock, 0, bufferVar);
 		scriptEngine->executeCallback(Callback::processBlock, &lastResult);
@@ -1336,7 +1336,7 @@ void JavascriptTimeVariantModulator::calculateBlock(int startSample, int numSamp
 	}
 
 #if ENABLE_ALL_PEAK_METERS
-	setOutputValue(internalBuffer.getSample(0, startSample));
+	setOutputValue(internalBuffer->getSample(0, startSample));
 #endif
 
 }
@@ -1585,7 +1585,7 @@ void JavascriptEnvelopeModulator::calculateBlock(int startSample, int numSamples
 	{
 		scriptnode::DspNetwork::VoiceSetter vs(*n, polyManager.getCurrentVoice());
 
-		float* ptr = internalBuffer.getWritePointer(0, startSample);
+		float* ptr = internalBuffer->getWritePointer(0, startSample);
 
 		memset(ptr, 0, sizeof(float)*numSamples);
 
@@ -1599,7 +1599,7 @@ void JavascriptEnvelopeModulator::calculateBlock(int startSample, int numSamples
 	}
 
 #if ENABLE_ALL_PEAK_METERS
-	setOutputValue(internalBuffer.getSample(0, startSample));
+	setOutputValue(internalBuffer->getSample(0, startSample));
 #endif
 
 }
@@ -2084,7 +2084,7 @@ bool ScriptnodeVoiceKiller::isPlaying(int voiceIndex) const
 { return getState(voiceIndex)->active; }
 
 void ScriptnodeVoiceKiller::calculateBlock(int startSample, int numSamples)
-{ FloatVectorOperations::fill(internalBuffer.getWritePointer(0, startSample), 1.0f, numSamples); }
+{ FloatVectorOperations::fill(internalBuffer->getWritePointer(0, startSample), 1.0f, numSamples); }
 
 void ScriptnodeVoiceKiller::handleHiseEvent(const HiseEvent& m)
 {}
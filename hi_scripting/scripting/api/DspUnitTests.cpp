@@ -1940,6 +1940,1070 @@ private:
 
 static CustomContainerTest unorderedStackTest;
 
+class BytecodeCompilerTest : public UnitTest
+{
+public:
+
+	BytecodeCompilerTest() :
+		UnitTest("Testing HiseScript bytecode compiler")
+	{}
+
+	void runTest() override
+	{
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+		ScopedPointer<JavascriptMidiProcessor> jp = new JavascriptMidiProcessor(bp, "scripter");
+
+		const String code = R"(
+			reg counter = 0;
+			var data = [1, 2, 3, 4];
+
+			inline function sum(n)
+			{
+				local s = 0.0;
+
+				for (i = 0; i < n; i++)
+				{
+					if (i % 3 == 0)
+						continue;
+
+					s += i * 0.5 + (i & 7);
+					counter++;
+
+					if (s > 100000)
+						break;
+				}
+
+				return s + data[2];
+			};
+
+			inline function shift(a, b)
+			{
+				local x = a << 2;
+				x = (x >>> 1) ^ b;
+				return x > 10 ? x / 4 : x - b;
+			};
+
+			inline function compare(a, b)
+			{
+				return (a == b) || (a === "string" && b != 2);
+			};
+		)";
+
+		beginTest("Compare bytecode results with the interpreter");
+
+		ScopedPointer<HiseJavascriptEngine> interpreted = createEngine(jp, bp, code, false);
+		ScopedPointer<HiseJavascriptEngine> compiled = createEngine(jp, bp, code, true);
+
+		const StringArray expressions = { "sum(0)", "sum(10)", "sum(1000)", "shift(3, 5)", "shift(1, 17)", "shift(-7, 2)",
+										  "compare(1, 1)", "compare(\"string\", 3)", "compare(2, 3)", "counter" };
+
+		for (const auto& e : expressions)
+		{
+			Result r1 = Result::ok(), r2 = Result::ok();
+			auto expected = interpreted->evaluate(e, &r1);
+			auto actual = compiled->evaluate(e, &r2);
+
+			expectResult(r1, e);
+			expectResult(r2, e);
+			expect(expected == actual && expected.hasSameTypeAs(actual), e + ": " + expected.toString() + " != " + actual.toString());
+		}
+
+		testCallbacks(jp, bp);
+
+#if HISE_RUN_UNIT_TEST_BENCHMARKS
+		beginTest("Benchmark bytecode compiler");
+
+		auto interpretedTime = measure(*interpreted);
+		auto compiledTime = measure(*compiled);
+
+		logMessage("Interpreter: " + String(interpretedTime, 1) + "ms, Bytecode: " + String(compiledTime, 1) + "ms, Speedup: " + String(interpretedTime / jmax(0.001, compiledTime), 2) + "x");
+#endif
+	}
+
+private:
+
+	enum CallbackIndex
+	{
+		OnNoteOn,
+		OnController,
+		OnControl,
+		numCallbacks
+	};
+
+	void testCallbacks(JavascriptMidiProcessor* jp, BackendProcessor* bp)
+	{
+		beginTest("Compare compiled callbacks with the interpreter");
+
+		// The bodies of the callbacks are block statements, so this checks that the
+		// replaced statements are kept alive by the bytecode.
+		const String code = R"(
+			reg noteSum = 0;
+			reg ccSum = 0;
+			reg numLoops = 0;
+			reg lastResult = 0;
+			reg i = 0;
+			var table = [0, 2, 4, 8];
+
+			inline function scale(x)
+			{
+				return x * 0.5 + 1;
+			};
+
+			function onNoteOn()
+			{
+				local n = numLoops % 12;
+
+				for (i = 0; i < 8; i++)
+				{
+					if (i == 5)
+						break;
+
+					noteSum += scale(i) + n;
+					numLoops++;
+				}
+
+				lastResult = n > 6 ? noteSum / 3 : noteSum - table[1];
+			}
+
+			function onController()
+			{
+				local v = numLoops & 7;
+				ccSum += (v << 1) ^ 3;
+
+				if (ccSum > 50)
+					ccSum -= 50;
+				else
+					ccSum += table.length;
+			}
+
+			function onControl(number, value)
+			{
+				lastResult = number * 2 + value;
+			}
+		)";
+
+		ScopedPointer<HiseJavascriptEngine> interpreted = createEngineWithCallbacks(jp, bp, code, false);
+		ScopedPointer<HiseJavascriptEngine> compiled = createEngineWithCallbacks(jp, bp, code, true);
+
+		const StringArray variables = { "noteSum", "ccSum", "numLoops", "lastResult" };
+
+		for (int i = 0; i < 32; i++)
+		{
+			const int callbackIndex = i % numCallbacks;
+			Result r1 = Result::ok(), r2 = Result::ok();
+
+			if (callbackIndex == OnControl)
+			{
+				for (auto e : { interpreted.get(), compiled.get() })
+				{
+					e->setCallbackParameter(OnControl, 0, i);
+					e->setCallbackParameter(OnControl, 1, (double)i * 0.25);
+				}
+			}
+
+			interpreted->executeCallback(callbackIndex, &r1);
+			compiled->executeCallback(callbackIndex, &r2);
+
+			expectResult(r1, "callback " + String(callbackIndex));
+			expectResult(r2, "callback " + String(callbackIndex));
+
+			for (const auto& v : variables)
+			{
+				auto expected = interpreted->evaluate(v);
+				auto actual = compiled->evaluate(v);
+
+				expect(expected == actual && expected.hasSameTypeAs(actual), v + ": " + expected.toString() + " != " + actual.toString());
+			}
+		}
+	}
+
+	void expectResult(const Result& r, const String& e)
+	{
+		expect(r.wasOk(), e + ": " + r.getErrorMessage());
+	}
+
+	static HiseJavascriptEngine* createEngineWithCallbacks(JavascriptMidiProcessor* jp, BackendProcessor* bp, const String& code, bool useBytecode)
+	{
+		ScopedValueSetter<bool> svs(HiseJavascriptEngine::compileToBytecode, useBytecode);
+
+		auto e = new HiseJavascriptEngine(jp, bp);
+
+		// Register them in the order of the CallbackIndex enum
+		e->registerCallbackName("onNoteOn", 0, 0.0);
+		e->registerCallbackName("onController", 0, 0.0);
+		e->registerCallbackName("onControl", 2, 0.0);
+
+		e->execute(code);
+		return e;
+	}
+
+	static HiseJavascriptEngine* createEngine(JavascriptMidiProcessor* jp, BackendProcessor* bp, const String& code, bool useBytecode)
+	{
+		ScopedValueSetter<bool> svs(HiseJavascriptEngine::compileToBytecode, useBytecode);
+
+		auto e = new HiseJavascriptEngine(jp, bp);
+		e->execute(code);
+		return e;
+	}
+
+#if HISE_RUN_UNIT_TEST_BENCHMARKS
+	static double measure(HiseJavascriptEngine& e)
+	{
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < 100; i++)
+			e.evaluate("sum(1000) + shift(" + String(i) + ", 3)");
+
+		return Time::getMillisecondCounterHiRes() - start;
+	}
+#endif
+};
+
+static BytecodeCompilerTest bytecodeCompilerTest;
+
+/** Shared helpers for the tests that build a scriptnode network from code. */
+struct NetworkTestHelpers
+{
+	/** Creates a node in the given parent and sets its first parameter if the value is not negative. */
+	static void addNode(DspNetwork* n, const String& path, const String& id, var parent, double value=-1.0)
+	{
+		auto node = dynamic_cast<NodeBase*>(n->createAndAdd(path, id, parent).getObject());
+
+		if (node != nullptr && value >= 0.0)
+		{
+			if (auto p = node->getParameterFromIndex(0))
+				p->setValueSync(value);
+		}
+	}
+
+	/** Adds a mul node and a split with two chains (add / mul) to the network. */
+	static void createSplitNetwork(DspNetwork* n)
+	{
+		addNode(n, "math.mul", "mul", var(n), 0.5);
+		addNode(n, "container.split", "split", var(n));
+		addNode(n, "container.chain", "chain1", "split");
+		addNode(n, "math.add", "add1", "chain1", 0.25);
+		addNode(n, "container.chain", "chain2", "split");
+		addNode(n, "math.mul", "mul2", "chain2", 0.8);
+	}
+
+	/** Resizes the buffer to two channels and fills it with noise from a fixed seed. */
+	static void fillWithNoise(AudioSampleBuffer& b, int numSamples, int seed=1)
+	{
+		b.setSize(2, numSamples);
+
+		Random r(seed);
+
+		for (int c = 0; c < b.getNumChannels(); c++)
+			for (int i = 0; i < numSamples; i++)
+				b.setSample(c, i, r.nextFloat() * 2.0f - 1.0f);
+	}
+
+	/** Returns the biggest absolute difference between the samples of the two buffers. */
+	static float getMaxDelta(const AudioSampleBuffer& a, const AudioSampleBuffer& b)
+	{
+		jassert(a.getNumChannels() == b.getNumChannels() && a.getNumSamples() == b.getNumSamples());
+
+		auto maxDelta = 0.0f;
+
+		for (int c = 0; c < a.getNumChannels(); c++)
+			for (int i = 0; i < a.getNumSamples(); i++)
+				maxDelta = jmax(maxDelta, std::abs(a.getSample(c, i) - b.getSample(c, i)));
+
+		return maxDelta;
+	}
+
+#if HISE_RUN_UNIT_TEST_BENCHMARKS
+	/** Processes a copy of the input for the given amount of blocks and returns the time in milliseconds. */
+	static double measure(DspNetwork* n, const AudioSampleBuffer& input, int numBlocks)
+	{
+		AudioSampleBuffer b;
+		HiseEventBuffer events;
+
+		auto start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < numBlocks; i++)
+		{
+			b.makeCopyOf(input);
+			n->process(b, &events);
+		}
+
+		return Time::getMillisecondCounterHiRes() - start;
+	}
+#endif
+};
+
+class NetworkProfilerTest : public UnitTest
+{
+public:
+
+	NetworkProfilerTest() :
+		UnitTest("Testing the scriptnode profiler")
+	{}
+
+	void runTest() override
+	{
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+		ScopedPointer<JavascriptMasterEffect> fx = new JavascriptMasterEffect(bp, "fx");
+
+		beginTest("Testing profiling data");
+
+		constexpr int NumBlocks = 20;
+		constexpr int BlockSize = 256;
+
+		auto n = fx->getOrCreate("profiled");
+
+		NetworkTestHelpers::createSplitNetwork(n);
+
+		n->setNumChannels(2);
+		n->prepareToPlay(44100.0, (double)BlockSize);
+
+		expect(n->getProfilingData().isUndefined(), "profiling data without a profiler");
+
+		n->setProfilingEnabled(true);
+
+		AudioSampleBuffer b(2, BlockSize);
+		HiseEventBuffer events;
+
+		for (int i = 0; i < NumBlocks; i++)
+		{
+			b.clear();
+			n->process(b, &events);
+		}
+
+		n->setProfilingEnabled(false);
+
+		auto data = n->getProfilingData();
+
+		expect(data.isObject(), "no profiling data");
+		expectEquals(data["id"].toString(), n->getRootNode()->getId(), "root id mismatch");
+		expectEquals((int)data["droppedSamples"], 0, "dropped samples");
+
+		int numNodes = 0;
+		checkNode(data, NumBlocks, numNodes);
+
+		// the root node and the six added nodes
+		expectEquals(numNodes, 7, "node count mismatch");
+
+		auto children = data["children"];
+		expectEquals(children.size(), 2, "root child amount mismatch");
+		expectEquals(children[0]["id"].toString(), String("mul"));
+		expectEquals(children[1]["id"].toString(), String("split"));
+		expectEquals(children[1]["children"].size(), 2, "split child amount mismatch");
+		expectEquals(children[1]["children"][1]["children"][0]["path"].toString(), n->getRootNode()->getId() + ".split.chain2.mul2");
+	}
+
+private:
+
+	void checkNode(const var& node, int numBlocks, int& numNodes)
+	{
+		numNodes++;
+
+		auto path = node["path"].toString();
+
+		expect(path.endsWith(node["id"].toString()), path + ": path doesn't end with the ID");
+		expectEquals((int)node["calls"], numBlocks, path + ": call count mismatch");
+		expect((double)node["selfMs"] <= (double)node["totalMs"], path + ": self time exceeds the total time");
+		expect((double)node["maxMs"] <= (double)node["totalMs"], path + ": max time exceeds the total time");
+
+		if (auto c = node["children"].getArray())
+		{
+			for (const auto& child : *c)
+			{
+				expect(child["path"].toString().startsWith(path + "."), path + ": child path mismatch");
+				checkNode(child, numBlocks, numNodes);
+			}
+		}
+	}
+};
+
+static NetworkProfilerTest networkProfilerTest;
+
+#if HISE_FLAT_SCRIPTNODE_SCHEDULE
+class FlatScheduleTest : public UnitTest
+{
+public:
+
+	FlatScheduleTest() :
+		UnitTest("Testing flattened scriptnode schedule")
+	{}
+
+	using GraphBuilder = std::function<void(DspNetwork*)>;
+
+	void runTest() override
+	{
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+		ScopedPointer<JavascriptMasterEffect> fx = new JavascriptMasterEffect(bp, "fx");
+
+		testGraph(*fx, "serial", [](DspNetwork* n)
+		{
+			for (int i = 0; i < 32; i++)
+				NetworkTestHelpers::addNode(n, "math.mul", "mul" + String(i), var(n), 0.99);
+		});
+
+		testGraph(*fx, "split", [](DspNetwork* n)
+		{
+			NetworkTestHelpers::addNode(n, "container.split", "split", var(n));
+
+			for (int i = 0; i < 8; i++)
+			{
+				auto cId = "chain" + String(i);
+				NetworkTestHelpers::addNode(n, "container.chain", cId, "split");
+
+				for (int j = 0; j < 4; j++)
+					NetworkTestHelpers::addNode(n, "math.add", cId + "_add" + String(j), cId, 0.01 * (i + j));
+			}
+		});
+
+		testGraph(*fx, "multi", [](DspNetwork* n)
+		{
+			NetworkTestHelpers::addNode(n, "container.multi", "multi", var(n));
+
+			for (int i = 0; i < 2; i++)
+			{
+				auto cId = "chain" + String(i);
+				NetworkTestHelpers::addNode(n, "container.chain", cId, "multi");
+
+				for (int j = 0; j < 8; j++)
+					NetworkTestHelpers::addNode(n, "math.mul", cId + "_mul" + String(j), cId, 0.9 + 0.01 * j);
+			}
+		});
+
+		testGraph(*fx, "nested", [](DspNetwork* n)
+		{
+			var parent(n);
+
+			for (int depth = 0; depth < 4; depth++)
+			{
+				auto sId = "split" + String(depth);
+				NetworkTestHelpers::addNode(n, "container.split", sId, parent);
+
+				NetworkTestHelpers::addNode(n, "math.add", sId + "_add", sId, 0.1 * depth);
+
+				auto cId = "chain" + String(depth);
+				NetworkTestHelpers::addNode(n, "container.chain", cId, sId);
+				NetworkTestHelpers::addNode(n, "math.mul", cId + "_mul", cId, 0.5);
+
+				parent = cId;
+			}
+		});
+	}
+
+private:
+
+	void testGraph(JavascriptMasterEffect& fx, const String& id, const GraphBuilder& f)
+	{
+		constexpr int NumSamples = 512;
+
+		beginTest("Testing " + id + " graph");
+
+		auto n = fx.getOrCreate(id);
+		f(n);
+
+		n->setNumChannels(2);
+		n->prepareToPlay(44100.0, (double)NumSamples);
+
+		AudioSampleBuffer input;
+		NetworkTestHelpers::fillWithNoise(input, NumSamples);
+
+		HiseEventBuffer events;
+
+		auto render = [&](bool useFlatSchedule, AudioSampleBuffer& b)
+		{
+			n->setUseFlatSchedule(useFlatSchedule);
+			b.makeCopyOf(input);
+			n->process(b, &events);
+		};
+
+		AudioSampleBuffer recursiveOutput, flatOutput;
+		render(false, recursiveOutput);
+		render(true, flatOutput);
+
+		expect(n->isUsingFlatSchedule(), "flat schedule wasn't built");
+
+		auto maxDelta = NetworkTestHelpers::getMaxDelta(recursiveOutput, flatOutput);
+		expect(maxDelta < 1e-6f, id + ": output mismatch: " + String(maxDelta));
+
+#if HISE_RUN_UNIT_TEST_BENCHMARKS
+		constexpr int NumBlocks = 2000;
+
+		n->setUseFlatSchedule(false);
+		auto recursiveTime = NetworkTestHelpers::measure(n, input, NumBlocks);
+
+		n->setUseFlatSchedule(true);
+		auto flatTime = NetworkTestHelpers::measure(n, input, NumBlocks);
+
+		logMessage(id + ": recursive: " + String(recursiveTime, 1) + "ms, flat: " + String(flatTime, 1) + "ms, Speedup: " + String(recursiveTime / jmax(0.001, flatTime), 2) + "x");
+#endif
+	}
+};
+
+static FlatScheduleTest flatScheduleTest;
+
+class ParallelSplitTest : public UnitTest
+{
+public:
+
+	ParallelSplitTest() :
+		UnitTest("Testing parallel split container")
+	{}
+
+	void runTest() override
+	{
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+
+		// The nodes fetch the pool when they are created, so this must happen before anything is added
+		bp->createRealtimeWorkerPoolForUnitTests(3);
+
+		ScopedPointer<JavascriptMasterEffect> fx = new JavascriptMasterEffect(bp, "fx");
+
+		beginTest("Testing realtime worker pool");
+
+		expect(bp->getRealtimeWorkerPool() != nullptr && bp->getRealtimeWorkerPool()->getNumWorkers() > 0, "No realtime workers, the parallel split would be processed serially");
+
+		for (auto blockSize : { 16, 512 })
+		{
+			beginTest("Testing parallel split with block size " + String(blockSize));
+
+			AudioSampleBuffer input;
+			NetworkTestHelpers::fillWithNoise(input, blockSize);
+
+			auto split = createNetwork(*fx, "container.split", blockSize);
+			auto parallelSplit = createNetwork(*fx, "container.parallel_split", blockSize);
+
+			AudioSampleBuffer splitOutput, parallelOutput;
+			render(split, input, splitOutput);
+			render(parallelSplit, input, parallelOutput);
+
+			// The branches are added in the same order, so this must be bit-identical
+			expectEquals(NetworkTestHelpers::getMaxDelta(splitOutput, parallelOutput), 0.0f, "output mismatch");
+
+#if HISE_RUN_UNIT_TEST_BENCHMARKS
+			constexpr int NumBlocks = 500;
+
+			auto splitTime = NetworkTestHelpers::measure(split, input, NumBlocks);
+			auto parallelTime = NetworkTestHelpers::measure(parallelSplit, input, NumBlocks);
+
+			logMessage("split: " + String(splitTime, 1) + "ms, parallel_split: " + String(parallelTime, 1) + "ms");
+#endif
+		}
+	}
+
+private:
+
+	static DspNetwork* createNetwork(JavascriptMasterEffect& fx, const String& containerPath, int blockSize)
+	{
+		auto id = containerPath.fromFirstOccurrenceOf(".", false, false) + String(blockSize);
+		auto n = fx.getOrCreate(id);
+
+		n->createAndAdd(containerPath, "container", var(n));
+
+		for (int i = 0; i < 4; i++)
+		{
+			auto cId = "chain" + String(i);
+			n->createAndAdd("container.chain", cId, "container");
+
+			for (int j = 0; j < 16; j++)
+				NetworkTestHelpers::addNode(n, "math.mul", cId + "_mul" + String(j), cId, 0.99 - 0.01 * i);
+		}
+
+		// Compare the container implementations, not the flat schedule
+		n->setUseFlatSchedule(false);
+		n->setNumChannels(2);
+		n->prepareToPlay(44100.0, (double)blockSize);
+
+		return n;
+	}
+
+	static void render(DspNetwork* n, const AudioSampleBuffer& input, AudioSampleBuffer& output)
+	{
+		HiseEventBuffer events;
+
+		output.makeCopyOf(input);
+		n->process(output, &events);
+	}
+};
+
+static ParallelSplitTest parallelSplitTest;
+#endif
+
+#if HISE_INCLUDE_SNEX
+class JitNetworkTest : public UnitTest
+{
+public:
+
+	JitNetworkTest() :
+		UnitTest("Testing JIT compiled networks")
+	{}
+
+	void runTest() override
+	{
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+		ScopedPointer<JavascriptMasterEffect> fx = new JavascriptMasterEffect(bp, "fx");
+
+		beginTest("Testing JIT compiled network output");
+
+		constexpr int NumSamples = 512;
+
+		auto n = fx->getOrCreate("jit");
+
+		NetworkTestHelpers::createSplitNetwork(n);
+
+		n->setNumChannels(2);
+		n->prepareToPlay(44100.0, (double)NumSamples);
+
+		AudioSampleBuffer input;
+		NetworkTestHelpers::fillWithNoise(input, NumSamples);
+
+		HiseEventBuffer events;
+
+		auto render = [&](AudioSampleBuffer& b)
+		{
+			b.makeCopyOf(input);
+			n->process(b, &events);
+		};
+
+		AudioSampleBuffer interpretedOutput, jitOutput;
+
+		render(interpretedOutput);
+
+		auto ok = n->setUseJitCompiledNode(true);
+
+		expect(ok.wasOk(), ok.getErrorMessage());
+		expect(n->isJitCompiled(), "network isn't JIT compiled");
+
+		render(jitOutput);
+
+		auto maxDelta = NetworkTestHelpers::getMaxDelta(interpretedOutput, jitOutput);
+		expect(maxDelta < 1e-5f, "output mismatch: " + String(maxDelta));
+
+		beginTest("Testing switching back to the interpreter");
+
+		ok = n->setUseJitCompiledNode(false);
+
+		expect(ok.wasOk(), ok.getErrorMessage());
+		expect(!n->isJitCompiled(), "network is still JIT compiled");
+
+		AudioSampleBuffer restoredOutput;
+		render(restoredOutput);
+
+		expectEquals(NetworkTestHelpers::getMaxDelta(restoredOutput, interpretedOutput), 0.0f, "interpreter output mismatch");
+	}
+};
+
+static JitNetworkTest jitNetworkTest;
+#endif
+
+class RealtimeWorkerPoolTest : public UnitTest
+{
+public:
+
+	RealtimeWorkerPoolTest() :
+		UnitTest("Testing realtime worker pool")
+	{}
+
+	void runTest() override
+	{
+		RealtimeWorkerPool pool(NumWorkers);
+
+		expectEquals(pool.getNumWorkers(), NumWorkers);
+
+		testForkJoin(pool);
+		testWorkersTakePart(pool);
+		testNestedBatch(pool);
+	}
+
+private:
+
+	static constexpr int NumWorkers = 3;
+
+	void testForkJoin(RealtimeWorkerPool& pool)
+	{
+		beginTest("Testing that every task is executed once before run() returns");
+
+		constexpr int NumTasks = 64;
+
+		for (int batch = 0; batch < 500; batch++)
+		{
+			std::atomic<int> numExecuted[NumTasks];
+			int results[NumTasks];
+
+			for (int i = 0; i < NumTasks; i++)
+			{
+				numExecuted[i].store(0);
+				results[i] = -1;
+			}
+
+			auto f = [&](int taskIndex)
+			{
+				results[taskIndex] = taskIndex * batch;
+				numExecuted[taskIndex].fetch_add(1);
+			};
+
+			pool.parallelFor(NumTasks, f);
+
+			for (int i = 0; i < NumTasks; i++)
+			{
+				if (numExecuted[i].load() != 1 || results[i] != i * batch)
+				{
+					expect(false, "task " + String(i) + " of batch " + String(batch) + " was executed " + String(numExecuted[i].load()) + " times");
+					return;
+				}
+			}
+		}
+	}
+
+	void testWorkersTakePart(RealtimeWorkerPool& pool)
+	{
+		beginTest("Testing that the workers take part and use their own lanes");
+
+		constexpr int NumTasks = NumWorkers + 1;
+
+		bool workerTookPart = false;
+		bool laneMismatch = false;
+
+		// The workers might be asleep for the first batches, so we'll try a few times
+		for (int batch = 0; batch < 2000 && !workerTookPart; batch++)
+		{
+			Thread::ThreadID threadIds[NumTasks];
+			int lanes[NumTasks];
+
+			auto f = [&](int taskIndex)
+			{
+				threadIds[taskIndex] = Thread::getCurrentThreadId();
+				lanes[taskIndex] = RealtimeWorkerPool::getCurrentLane();
+
+				// Give the workers some time to pick up a task
+				auto start = Time::getHighResolutionTicks();
+				while (Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start) < 0.00005)
+					;
+			};
+
+			pool.parallelFor(NumTasks, f);
+
+			auto callingThread = Thread::getCurrentThreadId();
+
+			for (int i = 0; i < NumTasks; i++)
+			{
+				const bool isWorker = threadIds[i] != callingThread;
+
+				workerTookPart |= isWorker;
+				laneMismatch |= isWorker != (lanes[i] != 0);
+				laneMismatch |= !isPositiveAndBelow(lanes[i], RealtimeWorkerPool::NumLanes);
+			}
+		}
+
+		expect(workerTookPart, "no task was executed by a worker");
+		expect(!laneMismatch, "a task was executed with the wrong lane");
+	}
+
+	void testNestedBatch(RealtimeWorkerPool& pool)
+	{
+		beginTest("Testing that nested batches are executed serially");
+
+		constexpr int NumTasks = 8;
+
+		std::atomic<int> numInnerTasks = { 0 };
+
+		auto inner = [&](int) { numInnerTasks.fetch_add(1); };
+
+		auto outer = [&](int)
+		{
+			pool.parallelFor(NumTasks, inner);
+		};
+
+		pool.parallelFor(NumTasks, outer);
+
+		expectEquals(numInnerTasks.load(), NumTasks * NumTasks);
+	}
+};
+
+static RealtimeWorkerPoolTest realtimeWorkerPoolTest;
+
+class ParallelRenderingTest : public UnitTest
+{
+public:
+
+	ParallelRenderingTest() :
+		UnitTest("Testing parallel rendering of sound generators")
+	{}
+
+	void runTest() override
+	{
+		ScopedValueSetter<bool> svs(MainController::unitTestMode, true);
+
+		beginTest("Testing parallel sound generators against serial output");
+
+		AudioSampleBuffer serialOutput, parallelOutput;
+
+		renderSiblings(false, serialOutput);
+		renderSiblings(true, parallelOutput);
+
+		expectEqualOutput(serialOutput, parallelOutput);
+
+		beginTest("Testing serial fallback for sound generators with MIDI processors");
+
+		renderSiblings(false, serialOutput, true);
+		renderSiblings(true, parallelOutput, true);
+
+		expectEqualOutput(serialOutput, parallelOutput);
+
+		beginTest("Testing parallel voices against serial output");
+
+		renderVoices(false, serialOutput);
+		renderVoices(true, parallelOutput);
+
+		expectEqualOutput(serialOutput, parallelOutput);
+	}
+
+private:
+
+	static constexpr int BlockSize = 512;
+	static constexpr int NumBlocks = 64;
+
+	void expectEqualOutput(const AudioSampleBuffer& serialOutput, const AudioSampleBuffer& parallelOutput)
+	{
+		for (int c = 0; c < 2; c++)
+		{
+			auto maxDelta = 0.0f;
+
+			for (int i = 0; i < serialOutput.getNumSamples(); i++)
+				maxDelta = jmax(maxDelta, std::abs(serialOutput.getSample(c, i) - parallelOutput.getSample(c, i)));
+
+			expect(maxDelta < 1e-6f, "output mismatch at channel " + String(c) + ": " + String(maxDelta));
+		}
+	}
+
+	BackendProcessor* createProcessor()
+	{
+		auto bp = new BackendProcessor(nullptr, nullptr);
+
+		// Both renderings use a pool, so the only difference is whether they use it
+		bp->createRealtimeWorkerPoolForUnitTests(3);
+
+		expect(bp->getRealtimeWorkerPool() != nullptr && bp->getRealtimeWorkerPool()->getNumWorkers() > 0, "No realtime workers");
+
+		return bp;
+	}
+
+	/** Renders four sine generators. If addMidiProcessors is true, the second one gets a MIDI player
+	    and the third one a choke group processor, which both change the shared event state.
+	*/
+	void renderSiblings(bool renderInParallel, AudioSampleBuffer& output, bool addMidiProcessors=false)
+	{
+		ScopedPointer<BackendProcessor> bp = createProcessor();
+		auto chain = bp->getMainSynthChain();
+
+		for (int i = 0; i < 4; i++)
+		{
+			auto s = new SineSynth(bp, "Sine" + String(i), NUM_POLYPHONIC_VOICES);
+			s->addProcessorsWhenEmpty();
+			s->setAttribute(ModulatorSynth::Parameters::Gain, 0.25f, dontSendNotification);
+			s->setAttribute(SineSynth::SemiTones, (float)(i * 3), dontSendNotification);
+			chain->getHandler()->add(s, nullptr);
+
+			if (addMidiProcessors && (i == 1 || i == 2))
+			{
+				auto midiChain = dynamic_cast<MidiProcessorChain*>(s->getChildProcessor(ModulatorSynth::MidiProcessor));
+
+				if (i == 1)
+					midiChain->getHandler()->add(new MidiPlayer(bp, "Player", s), nullptr);
+				else
+					midiChain->getHandler()->add(new ChokeGroupProcessor(bp, "Choke"), nullptr);
+			}
+		}
+
+		bp->prepareToPlay(44100.0, BlockSize);
+
+		// This is what the AudioRendererBase does with renderInParallel enabled
+		chain->setUseParallelRendering(renderInParallel);
+		chain->updateParallelRenderingFlags();
+
+		if (renderInParallel)
+		{
+			for (int i = 0; i < chain->getHandler()->getNumProcessors(); i++)
+			{
+				auto s = dynamic_cast<ModulatorSynth*>(chain->getHandler()->getProcessor(i));
+				const bool expectParallel = !addMidiProcessors || (i != 1 && i != 2);
+
+				if (expectParallel)
+					expect(s->canBeRenderedInParallel(), s->getId() + " can't be rendered in parallel");
+				else
+					expect(!s->canBeRenderedInParallel(), s->getId() + " with a MIDI processor must be rendered serially");
+			}
+		}
+
+		render(*bp, { 60, 64 }, output);
+	}
+
+	void renderVoices(bool renderInParallel, AudioSampleBuffer& output)
+	{
+		ScopedPointer<BackendProcessor> bp = createProcessor();
+		auto chain = bp->getMainSynthChain();
+
+		auto s = new SineSynth(bp, "Sine", NUM_POLYPHONIC_VOICES);
+		s->addProcessorsWhenEmpty();
+		s->setAttribute(ModulatorSynth::Parameters::Gain, 0.1f, dontSendNotification);
+		chain->getHandler()->add(s, nullptr);
+
+		bp->prepareToPlay(44100.0, BlockSize);
+
+		s->setUseVoiceParallelRendering(renderInParallel);
+		s->updateParallelRenderingFlags();
+
+		expect(s->canRenderVoicesInParallel() == renderInParallel, "voice parallel rendering flag mismatch");
+
+		// Start more voices than the minimum that is rendered in parallel
+		Array<int> notes;
+
+		for (int i = 0; i < ModulatorSynth::MinNumVoicesForParallelRendering + 4; i++)
+			notes.add(48 + i * 2);
+
+		render(*bp, notes, output);
+	}
+
+	void render(BackendProcessor& bp, const Array<int>& notes, AudioSampleBuffer& output)
+	{
+		output.setSize(2, BlockSize * NumBlocks);
+		output.clear();
+
+		for (int i = 0; i < NumBlocks; i++)
+		{
+			MidiBuffer mb;
+
+			for (int n = 0; n < notes.size(); n++)
+			{
+				if (i == 0)
+					mb.addEvent(MidiMessage::noteOn(1, notes[n], 1.0f - 0.02f * (float)n), n * 10);
+
+				if (i == NumBlocks / 2)
+					mb.addEvent(MidiMessage::noteOff(1, notes[n]), n * 10);
+			}
+
+			float* d[2] = { output.getWritePointer(0, i * BlockSize), output.getWritePointer(1, i * BlockSize) };
+			AudioSampleBuffer b(d, 2, BlockSize);
+
+			bp.processBlock(b, mb);
+		}
+	}
+};
+
+static ParallelRenderingTest parallelRenderingTest;
+
+class PoolDataProviderTest : public UnitTest
+{
+public:
+
+	PoolDataProviderTest() :
+		UnitTest("Testing the embedded pool data")
+	{}
+
+	void runTest() override
+	{
+		ScopedPointer<BackendProcessor> bp = new BackendProcessor(nullptr, nullptr);
+
+		auto& pool = bp->getCurrentFileHandler().pool->getAdditionalDataPool();
+		auto dp = pool.getDataProvider();
+
+		beginTest("Testing hash collisions");
+
+		// "Xa" and "W" + 0xC6 end up with the same 64 bit hash code (88 * 101 + 97 == 87 * 101 + 198)
+		String first = "{PROJECT_FOLDER}Xa.txt";
+		String second = "{PROJECT_FOLDER}W" + String::charToString((juce_wchar)0xC6) + ".txt";
+
+		expectEquals(first.hashCode64(), second.hashCode64(), "no collision");
+
+		StringArray ids = { first, second };
+
+		for (int i = 0; i < 32; i++)
+			ids.add("{PROJECT_FOLDER}item" + String(i) + ".txt");
+
+		Random r(1);
+
+		for (const auto& id : ids)
+		{
+			String content;
+			auto numCharacters = r.nextInt({ 1, 500 });
+
+			for (int i = 0; i < numCharacters; i++)
+				content << String::charToString((juce_wchar)r.nextInt({ 'a', 'z' }));
+
+			contents.add(content);
+
+			AdditionalDataReference d;
+			d.getFile() = content;
+			pool.createAsEmbeddedReference(PoolReference(&pool, id, pool.getFileType()), d);
+		}
+
+		beginTest("Testing the memory input");
+
+		MemoryBlock mb;
+		expect(dp->writePool(new MemoryOutputStream(mb, false)).wasOk(), "write failed");
+		expect(dp->createInputStream(ids[0]) == nullptr, "written data isn't restored yet");
+
+		dp->restorePool(new MemoryInputStream(mb, true));
+		expectContents(dp, ids);
+
+		beginTest("Testing the memory mapped file");
+
+		auto f = File::createTempFile("hisepool");
+
+		ScopedPointer<FileOutputStream> fos = new FileOutputStream(f);
+		expect(dp->writePool(fos.release()).wasOk(), "write failed");
+
+		dp->restorePool(new FileInputStream(f));
+		expectContents(dp, ids);
+
+		beginTest("Testing the lifetime of the embedded data");
+
+		ScopedPointer<MemoryInputStream> view = dp->createInputStream(ids[2]);
+
+		dp->restorePool(new MemoryInputStream(mb, true));
+
+		expect(view != nullptr, "not found");
+
+		if (view != nullptr)
+		{
+			AdditionalDataReference d;
+			dp->getCompressor()->create(view.release(), &d);
+			expectEquals(d.getFile(), contents[2], "data mismatch after restoring");
+		}
+
+		f.deleteFile();
+	}
+
+private:
+
+	void expectContents(PoolBase::DataProvider* dp, const StringArray& ids)
+	{
+		expectEquals(dp->getListOfAllEmbeddedReferences().size(), ids.size(), "wrong number of references");
+
+		for (int i = 0; i < ids.size(); i++)
+		{
+			ScopedPointer<MemoryInputStream> a = dp->createInputStream(ids[i]);
+			ScopedPointer<MemoryInputStream> b = dp->createInputStream(ids[i]);
+
+			expect(a != nullptr && b != nullptr, ids[i] + " not found");
+
+			if (a == nullptr || b == nullptr)
+				continue;
+
+			expect(a->getData() == b->getData(), "not a view into the embedded data");
+
+			AdditionalDataReference d;
+			dp->getCompressor()->create(a.release(), &d);
+			expectEquals(d.getFile(), contents[i], ids[i] + " data mismatch");
+		}
+
+		expect(dp->createInputStream("{PROJECT_FOLDER}missing.txt") == nullptr, "found a missing file");
+	}
+
+	StringArray contents;
+};
+
+static PoolDataProviderTest poolDataProviderTest;
+
+
 
 
 #endif
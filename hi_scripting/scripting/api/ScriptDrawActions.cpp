@@ -44,6 +44,8 @@ struct ScriptedPostDrawActions
 			r.gaussianBlur(blurAmount);
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder("guassianBlur") << blurAmount).get(); }
+
 		int blurAmount;
 	};
 
@@ -57,6 +59,8 @@ struct ScriptedPostDrawActions
 			r.boxBlur(blurAmount);
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder("boxBlur") << blurAmount).get(); }
+
 		int blurAmount;
 	};
 
@@ -70,6 +74,8 @@ struct ScriptedPostDrawActions
 			r.desaturate();
 		}
 
+		int64 getHashCode() const override { return DrawActions::HashBuilder("desaturate").get(); }
+
 		int blurAmount;
 	};
 
@@ -90,6 +96,8 @@ struct ScriptedPostDrawActions
 			m->drawNoiseMap(g, area, noise, monochrom, scale);
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << noise << scale << area << monochrom).get(); }
+
 		bool wantsCachedImage() const override { return false; };
 		bool wantsToDrawOnParent() const override { return false; }
 
@@ -119,6 +127,8 @@ struct ScriptedPostDrawActions
 
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder("applyHSL") << h << s << l).get(); }
+
 		float h, s, l;
 	};
 
@@ -136,6 +146,8 @@ struct ScriptedPostDrawActions
 			r.applyGradientMap(ColourGradient(c1, {}, c2, {}, false));
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder("applyGradientMap") << c1 << c2).get(); }
+
 		Colour c1, c2;
 	};
 
@@ -152,6 +164,8 @@ struct ScriptedPostDrawActions
 			r.applyGamma(gamma);
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder("applyGamma") << gamma).get(); }
+
 		float gamma;
 	};
 
@@ -168,6 +182,8 @@ struct ScriptedPostDrawActions
 			r.applySharpness(delta);
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder("applySharpness") << delta).get(); }
+
 		int delta;
 	};
 
@@ -186,6 +202,8 @@ struct ScriptedPostDrawActions
 			r.applyVignette(amount, radius, falloff);
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder("applyVignette") << amount << radius << falloff).get(); }
+
 		float amount, radius, falloff;
 	};
 
@@ -199,6 +217,8 @@ struct ScriptedPostDrawActions
 		{
 			r.applySepia();
 		}
+
+		int64 getHashCode() const override { return DrawActions::HashBuilder("applySepia").get(); }
 	};
 
 	struct applyMask : public DrawActions::PostActionBase
@@ -213,6 +233,8 @@ struct ScriptedPostDrawActions
 			r.applyMask(path, invert, false);
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder("applyMask") << path << invert).get(); }
+
 		Path path;
 		bool invert;
 	};
@@ -226,6 +248,7 @@ namespace ScriptedDrawActions
 
 		fillAll(Colour c_) : c(c_) {};
 		void perform(Graphics& g) { g.fillAll(c); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << c).get(); }
 		Colour c;
 	};
 
@@ -235,6 +258,7 @@ namespace ScriptedDrawActions
 
 		setColour(Colour c_) : c(c_) {};
 		void perform(Graphics& g) { g.setColour(c); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << c).get(); }
 		Colour c;
 	};
 
@@ -244,6 +268,7 @@ namespace ScriptedDrawActions
 
 		addTransform(AffineTransform a_) : a(a_) {};
 		void perform(Graphics& g) override { g.addTransform(a); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << a).get(); }
 		AffineTransform a;
 	};
 
@@ -253,6 +278,7 @@ namespace ScriptedDrawActions
 
 		fillPath(const Path& p_) : p(p_) {};
 		void perform(Graphics& g) override { g.fillPath(p); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << p).get(); }
 		Path p;
 	};
 
@@ -265,6 +291,7 @@ namespace ScriptedDrawActions
 		{
 			g.strokePath(p, s);
 		}
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << p << s).get(); }
 		Path p;
 		PathStrokeType s;
 	};
@@ -302,6 +329,7 @@ namespace ScriptedDrawActions
 
 		fillRect(Rectangle<float> area_) : area(area_) {};
 		void perform(Graphics& g) { g.fillRect(area); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << area).get(); }
 		Rectangle<float> area;
 	};
 
@@ -311,6 +339,7 @@ namespace ScriptedDrawActions
 
 		fillEllipse(Rectangle<float> area_) : area(area_) {};
 		void perform(Graphics& g) { g.fillEllipse(area); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << area).get(); }
 		Rectangle<float> area;
 	};
 
@@ -320,6 +349,7 @@ namespace ScriptedDrawActions
 
 		drawRect(Rectangle<float> area_, float borderSize_) : area(area_), borderSize(borderSize_) {};
 		void perform(Graphics& g) { g.drawRect(area, borderSize); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << area << borderSize).get(); }
 		Rectangle<float> area;
 		float borderSize;
 	};
@@ -330,6 +360,7 @@ namespace ScriptedDrawActions
 
 		drawEllipse(Rectangle<float> area_, float borderSize_) : area(area_), borderSize(borderSize_) {};
 		void perform(Graphics& g) { g.drawEllipse(area, borderSize); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << area << borderSize).get(); }
 		Rectangle<float> area;
 		float borderSize;
 	};
@@ -356,6 +387,7 @@ namespace ScriptedDrawActions
 				g.fillPath(p);
 			}
 		};
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << area << cornerSize << allRounded << rounded[0] << rounded[1] << rounded[2] << rounded[3]).get(); }
 		Rectangle<float> area;
 		float cornerSize;
 
@@ -385,6 +417,7 @@ namespace ScriptedDrawActions
 				g.strokePath(p, PathStrokeType(borderSize));
 			}
 		};
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << area << cornerSize << borderSize << allRounded << rounded[0] << rounded[1] << rounded[2] << rounded[3]).get(); }
 		Rectangle<float> area;
 		float cornerSize, borderSize;
 
@@ -424,6 +457,7 @@ namespace ScriptedDrawActions
 			//			g.drawImage(img, ri.getX(), ri.getY(), (int)(r.getWidth() / scaleFactor), (int)(r.getHeight() / scaleFactor), 0, yOffset, (int)img.getWidth(), (int)((double)img.getHeight()));
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << img << r << placement.getFlags()).get(); }
 		Image img;
 		Rectangle<float> r;
 		RectanglePlacement placement = RectanglePlacement::centred;
@@ -444,6 +478,7 @@ namespace ScriptedDrawActions
 			//			g.drawImage(img, ri.getX(), ri.getY(), (int)(r.getWidth() / scaleFactor), (int)(r.getHeight() / scaleFactor), 0, yOffset, (int)img.getWidth(), (int)((double)img.getHeight()));
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << img << r << scaleFactor << yOffset).get(); }
 		Image img;
 		Rectangle<float> r;
 		float scaleFactor;
@@ -457,6 +492,7 @@ namespace ScriptedDrawActions
 		drawHorizontalLine(int y_, float x1_, float x2_) :
 			y(y_), x1(x1_), x2(x2_) {};
 		void perform(Graphics& g) { g.drawHorizontalLine(y, x1, x2); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << y << x1 << x2).get(); }
 		int y; float x1; float x2;
 	};
 
@@ -467,6 +503,7 @@ namespace ScriptedDrawActions
 		drawVerticalLine(int x_, float y1_, float y2_) :
 			x(x_), y1(y1_), y2(y2_) {};
 		void perform(Graphics& g) { g.drawVerticalLine(x, y1, y2); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << x << y1 << y2).get(); }
 		int x; float y1; float y2;
 	};
 
@@ -477,6 +514,7 @@ namespace ScriptedDrawActions
 		setOpacity(float alpha_) :
 			alpha(alpha_) {};
 		void perform(Graphics& g) { g.setOpacity(alpha); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << alpha).get(); }
 		float alpha;
 	};
 
@@ -487,6 +525,7 @@ namespace ScriptedDrawActions
 		drawLine(float x1_, float x2_, float y1_, float y2_, float lineThickness_) :
 			x1(x1_), x2(x2_), y1(y1_), y2(y2_), lineThickness(lineThickness_) {};
 		void perform(Graphics& g) { g.drawLine(x1, x2, y1, y2, lineThickness); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << x1 << x2 << y1 << y2 << lineThickness).get(); }
 		float x1, x2, y1, y2, lineThickness;
 	};
 
@@ -496,6 +535,7 @@ namespace ScriptedDrawActions
 
 		setFont(Font f_) : f(f_) {};
 		void perform(Graphics& g) { g.setFont(f); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << f).get(); }
 		Font f;
 	};
 
@@ -505,6 +545,7 @@ namespace ScriptedDrawActions
 
 		setGradientFill(ColourGradient grad_) : grad(grad_) {};
 		void perform(Graphics& g) { g.setGradientFill(grad); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << grad).get(); }
 		ColourGradient grad;
 	};
 
@@ -514,6 +555,7 @@ namespace ScriptedDrawActions
 
 		drawText(const String& text_, Rectangle<float> area_, Justification j_ = Justification::centred) : text(text_), area(area_), j(j_) {};
 		void perform(Graphics& g) override { g.drawText(text, area, j); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << text << area << j).get(); }
 		String text;
 		Rectangle<float> area;
 		Justification j;
@@ -537,6 +579,7 @@ namespace ScriptedDrawActions
 			else
 				ds.render(g, text, area, j);
 		};
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << text << area << j << sp.color << sp.radius << sp.offset.getX() << sp.offset.getY() << sp.spread << sp.inner).get(); }
 
 		String text;
 		Rectangle<float> area;
@@ -553,6 +596,7 @@ namespace ScriptedDrawActions
 
 		drawFittedText(const String& text_, var area_, Justification j_, int maxLines_, float scale_ = Justification::centred) : text(text_), area(area_), j(j_), maxLines(maxLines_), scale(scale_) {};
 		void perform(Graphics& g) override { g.drawFittedText(text, area[0], area[1], area[2], area[3], j, maxLines, scale); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << text << (int)area[0] << (int)area[1] << (int)area[2] << (int)area[3] << j << maxLines << scale).get(); }
 		String text;
 		var area;
 		Justification j;
@@ -566,6 +610,7 @@ namespace ScriptedDrawActions
 
 		drawMultiLineText(const String& text_, int startX_, int baseLineY_, int maxWidth_, Justification j_ = Justification::centred, float leading_ = 0.0f) : text(text_), startX(startX_), baseLineY(baseLineY_), maxWidth(maxWidth_), j(j_), leading(leading_) {};
 		void perform(Graphics& g) override { g.drawMultiLineText(text, startX, baseLineY, maxWidth, j, leading); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << text << startX << baseLineY << maxWidth << j << leading).get(); }
 		String text;
         int startX;
         int baseLineY;
@@ -580,6 +625,7 @@ namespace ScriptedDrawActions
 
 		drawDropShadow(Rectangle<int> r_, DropShadow& shadow_) : r(r_), shadow(shadow_) {};
 		void perform(Graphics& g) override { shadow.drawForRectangle(g, r); };
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << r << shadow.colour << shadow.radius << shadow.offset.getX() << shadow.offset.getY()).get(); }
 		Rectangle<int> r;
 		DropShadow shadow;
 	};
@@ -626,7 +672,8 @@ namespace ScriptedDrawActions
 	{
 		SET_ACTION_ID(drawDropShadowFromPath);
 
-		drawDropShadowFromPath(const Path& p_, Rectangle<float> a, Colour c_, int r_) :
+		drawDropShadowFromPath(DrawActions::Handler* h, const Path& p_, Rectangle<float> a, Colour c_, int r_) :
+			handler(h),
 			p(p_),
 			c(c_),
 			area(a),
@@ -642,26 +689,45 @@ namespace ScriptedDrawActions
 //			shadow.render(g, p);
 
 #if 1
-			auto spb = area.withPosition((float)radius, (float)radius).transformed(AffineTransform::scale(scaleFactor));
+			auto drawTargetArea = area.expanded((float)radius).transformed(AffineTransform::scale(scaleFactor));
 
-			auto copy = p;
+			// the blurred shadow only depends on the parameters so we can reuse it until they change
+			DrawActions::HashBuilder key("shadowRaster");
+			key << getHashCode() << scaleFactor;
 
-			copy.scaleToFit(spb.getX(), spb.getY(), spb.getWidth(), spb.getHeight(), false);
+			Image img;
 
-			auto drawTargetArea = area.expanded((float)radius).transformed(AffineTransform::scale(scaleFactor));
-			Image img(Image::PixelFormat::ARGB, drawTargetArea.getWidth(), drawTargetArea.getHeight(), true);
-			Graphics g2(img);
-			g2.setColour(c);
-			g2.fillPath(copy);
-			gin::applyStackBlur(img, radius);
+			if (handler != nullptr)
+				img = handler->getCachedRaster(key.get());
+
+			if (!img.isValid())
+			{
+				auto spb = area.withPosition((float)radius, (float)radius).transformed(AffineTransform::scale(scaleFactor));
+
+				auto copy = p;
+
+				copy.scaleToFit(spb.getX(), spb.getY(), spb.getWidth(), spb.getHeight(), false);
+
+				img = Image(Image::PixelFormat::ARGB, drawTargetArea.getWidth(), drawTargetArea.getHeight(), true);
+				Graphics g2(img);
+				g2.setColour(c);
+				g2.fillPath(copy);
+				gin::applyStackBlur(img, radius);
+
+				if (handler != nullptr)
+					handler->setCachedRaster(key.get(), img);
+			}
 			
 			g.drawImageAt(img, drawTargetArea.getX(), drawTargetArea.getY());
 #endif
 		}
 
+		int64 getHashCode() const override { return (DrawActions::HashBuilder(getDispatchId()) << p << area << c << radius).get(); }
+
         // Soon...
 		//melatonin::DropShadow shadow;
 
+		WeakReference<DrawActions::Handler> handler;
 		Rectangle<float> area;
 		Path p;
 		Colour c;
@@ -4094,6 +4094,7 @@ struct ScriptingApi::Content::ScriptPanel::Wrapper
 {
 	API_VOID_METHOD_WRAPPER_0(ScriptPanel, repaint);
 	API_VOID_METHOD_WRAPPER_0(ScriptPanel, repaintImmediately);
+	API_METHOD_WRAPPER_0(ScriptPanel, getRepaintStatistics);
 	API_VOID_METHOD_WRAPPER_1(ScriptPanel, setPaintRoutine);
 	API_VOID_METHOD_WRAPPER_3(ScriptPanel, setImage)
 	API_VOID_METHOD_WRAPPER_1(ScriptPanel, setMouseCallback);
@@ -4205,6 +4206,7 @@ void ScriptingApi::Content::ScriptPanel::init()
 
 	ADD_API_METHOD_0(repaint);
 	ADD_API_METHOD_0(repaintImmediately);
+	ADD_API_METHOD_0(getRepaintStatistics);
 	ADD_API_METHOD_1(setPaintRoutine);
 	ADD_API_METHOD_3(setImage);
 	ADD_API_METHOD_1(setMouseCallback);
@@ -4300,6 +4302,14 @@ void ScriptingApi::Content::ScriptPanel::repaintImmediately()
 }
 
 
+var ScriptingApi::Content::ScriptPanel::getRepaintStatistics()
+{
+	if (auto h = getDrawActionHandler())
+		return h->getStatistics().toJSON();
+
+	return var();
+}
+
 void ScriptingApi::Content::ScriptPanel::setPaintRoutine(var paintFunction)
 {
 	paintRoutine = paintFunction;
@@ -1709,6 +1709,9 @@ public:
 		/** Calls the paint routine immediately. */
 		void repaintImmediately();
 
+		/** Returns a JSON object with the number of paint calls, skipped repaints and raster cache hits of this panel. */
+		var getRepaintStatistics();
+
 		/** Sets a Path as mouse cursor for this panel. */
 		void setMouseCursor(var pathIcon, var colour, var hitPoint);
 
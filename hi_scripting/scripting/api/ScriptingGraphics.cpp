@@ -2206,7 +2206,7 @@ void ScriptingObjects::GraphicsObject::drawDropShadowFromPath(var path, var area
 		
 		auto area = r.toFloat().translated(o.getX(), o.getY());
 
-		drawActionHandler.addDrawAction(new ScriptedDrawActions::drawDropShadowFromPath(sp, area, c, radius));
+		drawActionHandler.addDrawAction(new ScriptedDrawActions::drawDropShadowFromPath(&drawActionHandler, sp, area, c, radius));
 	}
 }
 
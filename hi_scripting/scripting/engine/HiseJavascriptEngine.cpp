@@ -625,13 +625,21 @@ struct HiseJavascriptEngine::RootObject::Statement
 		return false;
 	}
 
+	/** Same as swapIf, but for a child in an array. The old child is handed back in newChild
+		(so that an optimisation pass can decide whether it should be deleted or kept alive).
+	*/
 	template <typename T> static bool swapIfArrayElement(Ptr& newChild, Statement* childToReplace, OwnedArray<T>& arrayToSwap)
 	{
 		auto idx = arrayToSwap.indexOf(dynamic_cast<T*>(childToReplace));
 
 		if (idx != -1)
 		{
-			arrayToSwap.set(idx, dynamic_cast<T*>(newChild.release()), true);
+			auto nc = newChild.release();
+			auto oc = arrayToSwap[idx];
+
+			arrayToSwap.set(idx, dynamic_cast<T*>(nc), false);
+			newChild = dynamic_cast<Statement*>(oc);
+
 			return true;
 		}
 
@@ -2004,6 +2012,10 @@ hise::HiseJavascriptEngine::RootObject::OptimizationPass::OptimizationResult His
 				auto ok = st->replaceChildStatement(newExpr, child);
                 ignoreUnused(ok);
 				jassert(ok);
+
+				// the new statement owns the old one now
+				if (ok && keepsReplacedStatements())
+					newExpr.release();
 				r.numOptimizedStatements++;
 			}
 		}
@@ -289,6 +289,10 @@ public:
     
 	static bool isInlineFunction(const var& v);
 
+	/** Set this to true in order to compile the callbacks and inline functions of all engines that are
+	    created afterwards to bytecode (the default value is HISE_JAVASCRIPT_BYTECODE). */
+	static bool compileToBytecode;
+
 	struct ExternalFileData
 	{
 		enum class Type
@@ -492,6 +496,12 @@ public:
 			*/
 			virtual Statement* getOptimizedStatement(Statement* parentStatement, Statement* statementToOptimize) = 0;
 
+			/** Override this and return true if the optimized statement takes over the ownership of the statement it replaces.
+			
+				In this case you must only return a new statement if the parent statement can replace the child.
+			*/
+			virtual bool keepsReplacedStatements() const { return false; }
+
 			static bool callForEach(Statement* root, const std::function<bool(Statement* child)>& f);
 
 			OptimizationResult executePass(Statement* rootStatementToOptimize);
@@ -577,6 +587,7 @@ public:
 		struct GlobalVarStatement;		struct GlobalReference;		struct LocalVarStatement;
 		struct LocalReference;			struct CallbackParameterReference;
 		struct CallbackLocalStatement;  struct CallbackLocalReference;  struct IsDefinedTest;		
+		struct BytecodeStatement;		struct BytecodeCompiler;
 
 		// Snex stuff
 
@@ -610,6 +621,8 @@ public:
 		static var typeof_internal(Args a);
 		static var exec(Args a);
 		static var eval(Args a);
+
+		static OptimizationPass* createBytecodeCompiler();
                             
 		void addToCallStack(const Identifier& id, const CodeLocation* location);
 		void removeFromCallStack(const Identifier& id);
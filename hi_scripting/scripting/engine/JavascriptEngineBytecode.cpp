@@ -0,0 +1,907 @@
+namespace hise { using namespace juce;
+
+bool HiseJavascriptEngine::compileToBytecode = HISE_JAVASCRIPT_BYTECODE;
+
+/** A statement that executes a part of the syntax tree as register bytecode.
+
+	The BytecodeCompiler pass replaces the statements and expressions of callbacks and inline functions
+	with this statement. It takes over the ownership of the original syntax tree and keeps using its nodes
+	for everything that can't be compiled (API calls, object access, etc.), so the bytecode reads and writes
+	the same storage as the interpreter and both can be mixed freely.
+
+	The registers are allocated on the stack for each execution, so the statement is reentrant.
+*/
+struct HiseJavascriptEngine::RootObject::BytecodeStatement : public Expression
+{
+	static constexpr int NumMaxRegisters = 32;
+
+	enum class OpCode : uint8
+	{
+		Move,				// dst = a
+		Add,				// dst = a + b (same for all binary operators)
+		Subtract,
+		Multiply,
+		Divide,
+		Modulo,
+		BitwiseAnd,
+		BitwiseOr,
+		BitwiseXor,
+		LeftShift,
+		RightShift,
+		RightShiftUnsigned,
+		Equals,
+		NotEquals,
+		LessThan,
+		LessThanOrEqual,
+		GreaterThan,
+		GreaterThanOrEqual,
+		TypeEquals,
+		TypeNotEquals,
+		ToBool,				// dst = (bool)a
+		Jump,				// goto target
+		JumpIfFalse,		// if (!a) goto target
+		JumpIfTrue,			// if (a) goto target
+		LoadLocal,			// dst = local variable of inline function
+		StoreLocal,			// local variable of inline function = a
+		LoadCallbackLocal,	// dst = local variable of callback
+		StoreCallbackLocal,	// local variable of callback = a
+		LoadParameter,		// dst = parameter #target of inline function
+		StoreVariable,		// *object = a
+		EvalTree,			// dst = node->getResult()
+		AssignTree,			// node->assign(a)
+		PerformTree,		// node->perform(), break / continue jumps to target / secondTarget
+		CheckTimeout,
+		Return,				// *returnValue = a
+		Exit				// return (ResultCode)target
+	};
+
+	/** A positive operand is the index of a register, a negative operand refers to a value in the syntax tree. */
+	using Operand = int16;
+
+	struct Instruction
+	{
+		OpCode op = OpCode::Move;
+		Operand dst = 0;
+		Operand a = 0;
+		Operand b = 0;
+		int target = -1;
+		int secondTarget = -1;
+		Statement* node = nullptr;
+		void* object = nullptr;
+		Identifier id;
+	};
+
+	BytecodeStatement(Statement* statementToCompile) :
+		Expression(statementToCompile->location)
+	{}
+
+	ResultCode perform(const Scope& s, var* returnValue) const override
+	{
+		return run(s, returnValue, nullptr);
+	}
+
+	var getResult(const Scope& s) const override
+	{
+		var result;
+		run(s, nullptr, &result);
+		return result;
+	}
+
+	void assign(const Scope& s, const var& newValue) const override
+	{
+		if (auto e = dynamic_cast<Expression*>(original.get()))
+			e->assign(s, newValue);
+		else
+			Expression::assign(s, newValue);
+	}
+
+	Identifier getVariableName() const override
+	{
+		if (auto e = dynamic_cast<Expression*>(original.get()))
+			return e->getVariableName();
+
+		return {};
+	}
+
+	/** The compiled parts of the syntax tree must not be touched by other optimisations. */
+	Statement* getChildStatement(int) override { return nullptr; }
+
+	int getNumInstructions() const { return instructions.size(); }
+
+	ScopedPointer<Statement> original;
+
+	Array<Instruction> instructions;
+	Array<const var*> values;
+
+	int numRegisters = 0;
+	Operand resultRegister = -1;
+
+private:
+
+	struct RegisterFile
+	{
+		RegisterFile(int numToUse) :
+			numRegisters(numToUse),
+			data(reinterpret_cast<var*>(storage))
+		{
+			for (int i = 0; i < numRegisters; i++)
+				new (data + i) var();
+		}
+
+		~RegisterFile()
+		{
+			for (int i = 0; i < numRegisters; i++)
+				data[i].~var();
+		}
+
+		const int numRegisters;
+		var* data;
+		alignas(var) char storage[sizeof(var) * NumMaxRegisters];
+	};
+
+	static forcedinline bool isNumber(const var& v) noexcept
+	{
+		return v.isInt() || v.isInt64() || v.isDouble() || v.isBool();
+	}
+
+	/** The fast path for numbers must yield the exact same types as the BinaryOperator methods. */
+	template <typename DoubleOp, typename IntOp> static forcedinline void compute(var& dst, const var& a, const var& b, const Instruction& i, const DoubleOp& fd, const IntOp& fi)
+	{
+		if (isNumber(a) && isNumber(b))
+		{
+			if (a.isDouble() || b.isDouble())
+				dst = fd((double)a, (double)b);
+			else
+				dst = fi((int64)a, (int64)b);
+		}
+		else
+			dst = static_cast<const BinaryOperator*>(i.node)->getResultForValues(a, b);
+	}
+
+	/** Bitwise operators throw an error for doubles, so they always take the slow path. */
+	template <typename IntOp> static forcedinline void computeInt(var& dst, const var& a, const var& b, const Instruction& i, const IntOp& fi)
+	{
+		if (isNumber(a) && isNumber(b) && !a.isDouble() && !b.isDouble())
+			dst = fi((int64)a, (int64)b);
+		else
+			dst = static_cast<const BinaryOperator*>(i.node)->getResultForValues(a, b);
+	}
+
+	ResultCode run(const Scope& s, var* returnValue, var* result) const
+	{
+		RegisterFile registers(numRegisters);
+
+		auto r = registers.data;
+		auto v = values.begin();
+
+		auto get = [r, v](Operand o) -> const var&
+		{
+			return o >= 0 ? r[o] : *v[-1 - o];
+		};
+
+		auto code = instructions.begin();
+		const int numInstructions = instructions.size();
+		int pc = 0;
+
+		while (pc < numInstructions)
+		{
+			const auto& i = code[pc++];
+
+			switch (i.op)
+			{
+			case OpCode::Move:		r[i.dst] = get(i.a); break;
+			case OpCode::Add:		compute(r[i.dst], get(i.a), get(i.b), i, [](double x, double y) { return var(x + y); }, [](int64 x, int64 y) { return var(x + y); }); break;
+			case OpCode::Subtract:	compute(r[i.dst], get(i.a), get(i.b), i, [](double x, double y) { return var(x - y); }, [](int64 x, int64 y) { return var(x - y); }); break;
+			case OpCode::Multiply:	compute(r[i.dst], get(i.a), get(i.b), i, [](double x, double y) { return var(x * y); }, [](int64 x, int64 y) { return var(x * y); }); break;
+			case OpCode::Divide:
+				compute(r[i.dst], get(i.a), get(i.b), i,
+					[](double x, double y) { return var(y != 0 ? x / y : std::numeric_limits<double>::infinity()); },
+					[](int64 x, int64 y) { return y != 0 ? var(x / (double)y) : var(std::numeric_limits<double>::infinity()); });
+				break;
+			case OpCode::Modulo:
+				compute(r[i.dst], get(i.a), get(i.b), i,
+					[](double x, double y) { return roundToInt(y) != 0 ? var(roundToInt(x) % roundToInt(y)) : var(std::numeric_limits<double>::infinity()); },
+					[](int64 x, int64 y) { return y != 0 ? var(x % y) : var(std::numeric_limits<double>::infinity()); });
+				break;
+			case OpCode::BitwiseAnd:			computeInt(r[i.dst], get(i.a), get(i.b), i, [](int64 x, int64 y) { return var(x & y); }); break;
+			case OpCode::BitwiseOr:				computeInt(r[i.dst], get(i.a), get(i.b), i, [](int64 x, int64 y) { return var(x | y); }); break;
+			case OpCode::BitwiseXor:			computeInt(r[i.dst], get(i.a), get(i.b), i, [](int64 x, int64 y) { return var(x ^ y); }); break;
+			case OpCode::LeftShift:				computeInt(r[i.dst], get(i.a), get(i.b), i, [](int64 x, int64 y) { return var(((int)x) << (int)y); }); break;
+			case OpCode::RightShift:			computeInt(r[i.dst], get(i.a), get(i.b), i, [](int64 x, int64 y) { return var(((int)x) >> (int)y); }); break;
+			case OpCode::RightShiftUnsigned:	computeInt(r[i.dst], get(i.a), get(i.b), i, [](int64 x, int64 y) { return var((int)(((uint32)x) >> (int)y)); }); break;
+			case OpCode::Equals:				compute(r[i.dst], get(i.a), get(i.b), i, [](double x, double y) { return var(x == y); }, [](int64 x, int64 y) { return var(x == y); }); break;
+			case OpCode::NotEquals:				compute(r[i.dst], get(i.a), get(i.b), i, [](double x, double y) { return var(x != y); }, [](int64 x, int64 y) { return var(x != y); }); break;
+			case OpCode::LessThan:				compute(r[i.dst], get(i.a), get(i.b), i, [](double x, double y) { return var(x < y); }, [](int64 x, int64 y) { return var(x < y); }); break;
+			case OpCode::LessThanOrEqual:		compute(r[i.dst], get(i.a), get(i.b), i, [](double x, double y) { return var(x <= y); }, [](int64 x, int64 y) { return var(x <= y); }); break;
+			case OpCode::GreaterThan:			compute(r[i.dst], get(i.a), get(i.b), i, [](double x, double y) { return var(x > y); }, [](int64 x, int64 y) { return var(x > y); }); break;
+			case OpCode::GreaterThanOrEqual:	compute(r[i.dst], get(i.a), get(i.b), i, [](double x, double y) { return var(x >= y); }, [](int64 x, int64 y) { return var(x >= y); }); break;
+			case OpCode::TypeEquals:			r[i.dst] = areTypeEqual(get(i.a), get(i.b)); break;
+			case OpCode::TypeNotEquals:			r[i.dst] = !areTypeEqual(get(i.a), get(i.b)); break;
+			case OpCode::ToBool:				r[i.dst] = (bool)get(i.a); break;
+			case OpCode::Jump:					pc = i.target; break;
+			case OpCode::JumpIfFalse:			if (!(bool)get(i.a)) pc = i.target; break;
+			case OpCode::JumpIfTrue:			if ((bool)get(i.a)) pc = i.target; break;
+			case OpCode::LoadLocal:
+				r[i.dst] = (static_cast<InlineFunction::Object*>(i.object)->localProperties.get())[i.id];
+				break;
+			case OpCode::StoreLocal:
+				static_cast<InlineFunction::Object*>(i.object)->localProperties->set(i.id, get(i.a));
+				break;
+			case OpCode::LoadCallbackLocal:
+				r[i.dst] = static_cast<Callback*>(i.object)->localProperties[i.id];
+				break;
+			case OpCode::StoreCallbackLocal:
+				static_cast<Callback*>(i.object)->localProperties.set(i.id, get(i.a));
+				break;
+			case OpCode::LoadParameter:
+			{
+				if (auto fc = static_cast<InlineFunction::Object*>(i.object)->e.get())
+					r[i.dst] = fc->parameterResults[i.target];
+				else
+					i.node->location.throwError("Accessing parameter reference outside the function call");
+
+				break;
+			}
+			case OpCode::StoreVariable:			*static_cast<var*>(i.object) = get(i.a); break;
+			case OpCode::EvalTree:				r[i.dst] = static_cast<Expression*>(i.node)->getResult(s); break;
+			case OpCode::AssignTree:			static_cast<Expression*>(i.node)->assign(s, get(i.a)); break;
+			case OpCode::PerformTree:
+			{
+				auto rc = i.node->perform(s, returnValue);
+
+				if (rc == ok)
+					break;
+
+				if (rc == breakWasHit && i.target != -1)
+					pc = i.target;
+				else if (rc == continueWasHit && i.secondTarget != -1)
+					pc = i.secondTarget;
+				else
+					return rc;
+
+				break;
+			}
+			case OpCode::CheckTimeout:			s.checkTimeOut(i.node->location); break;
+			case OpCode::Return:
+				if (returnValue != nullptr)
+					*returnValue = get(i.a);
+
+				return returnWasHit;
+			case OpCode::Exit:					return (ResultCode)i.target;
+			default:							jassertfalse; break;
+			}
+		}
+
+		if (result != nullptr && resultRegister != -1)
+			*result = r[resultRegister];
+
+		return ok;
+	}
+};
+
+/** The optimisation pass that compiles the callbacks and inline functions to bytecode.
+
+	It replaces every statement (or expression) that contains a few operations which can be executed
+	natively with a BytecodeStatement. The parts that are still evaluated by the interpreter are optimised
+	recursively, so eg. the arguments of an API call might end up in their own BytecodeStatement.
+*/
+struct HiseJavascriptEngine::RootObject::BytecodeCompiler : public OptimizationPass
+{
+	using OpCode = BytecodeStatement::OpCode;
+	using Operand = BytecodeStatement::Operand;
+
+	/** The minimum amount of operations that must run natively to be worth the overhead of the bytecode statement. */
+	static constexpr int MinNumNativeOperations = 2;
+
+	String getPassName() const override { return "Bytecode compiler"; }
+
+	bool keepsReplacedStatements() const override { return true; }
+
+	Statement* getOptimizedStatement(Statement* parent, Statement* statementToOptimize) override
+	{
+		if (!canBeReplaced(parent, statementToOptimize))
+			return statementToOptimize;
+
+		auto hasBreakpoint = callForEach(statementToOptimize, [](Statement* st)
+		{
+			return st != nullptr && st->breakpointReference.index != -1;
+		});
+
+		if (hasBreakpoint)
+			return statementToOptimize;
+
+		ScopedPointer<BytecodeStatement> compiled = new BytecodeStatement(statementToOptimize);
+
+		Builder b(*compiled);
+
+		auto e = dynamic_cast<Expression*>(statementToOptimize);
+
+		if (e != nullptr && !Builder::overridesPerform(statementToOptimize))
+		{
+			compiled->resultRegister = b.allocate();
+			b.compileExpression(e, compiled->resultRegister);
+		}
+		else
+		{
+			b.compileStatement(statementToOptimize);
+		}
+
+		if (!b.ok || b.numNativeOperations < MinNumNativeOperations)
+		{
+			// Try to compile the children instead...
+			return statementToOptimize;
+		}
+
+		b.finalise();
+
+		// The interpreted parts might contain expressions that can be compiled too
+		for (auto st : b.interpretedStatements)
+			executePass(st);
+
+		compiled->original = statementToOptimize;
+		return compiled.release();
+	}
+
+private:
+
+	/** Only return a new statement if the parent can swap the child (otherwise the tree would be deleted twice). */
+	static bool canBeReplaced(Statement* parent, Statement* child)
+	{
+		if (parent == nullptr || child == nullptr)
+			return false;
+
+		if (dynamic_cast<BytecodeStatement*>(child) != nullptr)
+			return false;
+
+		if (auto bs = dynamic_cast<BlockStatement*>(parent))
+			return bs->statements.contains(child);
+
+		if (auto as = dynamic_cast<Assignment*>(parent))
+			return as->newValue.get() == child;
+
+		if (auto ls = dynamic_cast<LoopStatement*>(parent))
+			return !ls->isIterator || ls->body.get() == child;
+
+		return dynamic_cast<IfStatement*>(parent) != nullptr ||
+			   dynamic_cast<ReturnStatement*>(parent) != nullptr ||
+			   dynamic_cast<BinaryOperatorBase*>(parent) != nullptr ||
+			   dynamic_cast<ConditionalOp*>(parent) != nullptr ||
+			   dynamic_cast<ApiCall*>(parent) != nullptr ||
+			   dynamic_cast<ConstObjectApiCall*>(parent) != nullptr ||
+			   dynamic_cast<InlineFunction::FunctionCall*>(parent) != nullptr ||
+			   dynamic_cast<FunctionCall*>(parent) != nullptr ||
+			   dynamic_cast<VarStatement*>(parent) != nullptr ||
+			   dynamic_cast<LocalVarStatement*>(parent) != nullptr;
+	}
+
+	struct Builder
+	{
+		Builder(BytecodeStatement& p) :
+			program(p)
+		{}
+
+		struct Value
+		{
+			Operand operand;
+			bool isTemporary;
+		};
+
+		struct LoopLabels
+		{
+			Array<int> breaks;
+			Array<int> continues;
+		};
+
+		static bool overridesPerform(Statement* st)
+		{
+			if (auto bs = dynamic_cast<BytecodeStatement*>(st))
+				return bs->resultRegister == -1;
+
+			return dynamic_cast<VarStatement*>(st) != nullptr ||
+				   dynamic_cast<LocalVarStatement*>(st) != nullptr;
+		}
+
+		static bool isEmpty(Statement* st)
+		{
+			return typeid(*st) == typeid(Statement) || typeid(*st) == typeid(Expression);
+		}
+
+		/** Returns true if evaluating the expression doesn't change any variable. */
+		static bool isPure(Expression* e)
+		{
+			if (dynamic_cast<LiteralValue*>(e) != nullptr ||
+				dynamic_cast<ApiConstant*>(e) != nullptr ||
+				dynamic_cast<RegisterName*>(e) != nullptr ||
+				dynamic_cast<CallbackParameterReference*>(e) != nullptr ||
+				dynamic_cast<LocalReference*>(e) != nullptr ||
+				dynamic_cast<CallbackLocalReference*>(e) != nullptr ||
+				dynamic_cast<InlineFunction::ParameterReference*>(e) != nullptr)
+				return true;
+
+			if (auto bo = dynamic_cast<BinaryOperatorBase*>(e))
+				return isPure(bo->lhs) && isPure(bo->rhs);
+
+			if (auto co = dynamic_cast<ConditionalOp*>(e))
+				return isPure(co->condition) && isPure(co->trueBranch) && isPure(co->falseBranch);
+
+			return false;
+		}
+
+		static OpCode getOpCode(TokenType t)
+		{
+			if (t == TokenTypes::plus)					return OpCode::Add;
+			if (t == TokenTypes::minus)					return OpCode::Subtract;
+			if (t == TokenTypes::times)					return OpCode::Multiply;
+			if (t == TokenTypes::divide)				return OpCode::Divide;
+			if (t == TokenTypes::modulo)				return OpCode::Modulo;
+			if (t == TokenTypes::bitwiseAnd)			return OpCode::BitwiseAnd;
+			if (t == TokenTypes::bitwiseOr)				return OpCode::BitwiseOr;
+			if (t == TokenTypes::bitwiseXor)			return OpCode::BitwiseXor;
+			if (t == TokenTypes::leftShift)				return OpCode::LeftShift;
+			if (t == TokenTypes::rightShift)			return OpCode::RightShift;
+			if (t == TokenTypes::rightShiftUnsigned)	return OpCode::RightShiftUnsigned;
+			if (t == TokenTypes::equals)				return OpCode::Equals;
+			if (t == TokenTypes::notEquals)				return OpCode::NotEquals;
+			if (t == TokenTypes::lessThan)				return OpCode::LessThan;
+			if (t == TokenTypes::lessThanOrEqual)		return OpCode::LessThanOrEqual;
+			if (t == TokenTypes::greaterThan)			return OpCode::GreaterThan;
+			if (t == TokenTypes::greaterThanOrEqual)	return OpCode::GreaterThanOrEqual;
+
+			return OpCode::EvalTree;
+		}
+
+		Operand allocate()
+		{
+			auto r = nextRegister++;
+
+			if (nextRegister > BytecodeStatement::NumMaxRegisters)
+				ok = false;
+
+			program.numRegisters = jmin(jmax(program.numRegisters, nextRegister), BytecodeStatement::NumMaxRegisters);
+			return (Operand)jmin(r, BytecodeStatement::NumMaxRegisters - 1);
+		}
+
+		void release(const Value& v)
+		{
+			if (v.isTemporary)
+			{
+				jassert(v.operand == nextRegister - 1 || !ok);
+				nextRegister--;
+			}
+		}
+
+		Operand addValue(const var* v)
+		{
+			auto idx = pointers.indexOf(v);
+
+			if (idx == -1)
+			{
+				idx = pointers.size();
+				pointers.add(v);
+			}
+
+			return (Operand)(-1 - idx);
+		}
+
+		int emit(OpCode op, Operand dst = 0, Operand a = 0, Operand b = 0, Statement* node = nullptr)
+		{
+			BytecodeStatement::Instruction i;
+			i.op = op;
+			i.dst = dst;
+			i.a = a;
+			i.b = b;
+			i.node = node;
+
+			switch (op)
+			{
+			case OpCode::Move:
+			case OpCode::EvalTree:
+			case OpCode::AssignTree:
+			case OpCode::PerformTree:
+			case OpCode::CheckTimeout:
+				break;
+			default:
+				numNativeOperations++;
+			}
+
+			program.instructions.add(i);
+			return program.instructions.size() - 1;
+		}
+
+		BytecodeStatement::Instruction& getInstruction(int index) { return program.instructions.getReference(index); }
+
+		int getPosition() const { return program.instructions.size(); }
+
+		void interpret(Statement* st)
+		{
+			interpretedStatements.addIfNotAlreadyThere(st);
+		}
+
+		/** Returns the operand that can be used to read the value. Values from the syntax tree are not copied. */
+		Value compileOperand(Expression* e)
+		{
+			if (auto lv = dynamic_cast<LiteralValue*>(e))
+				return { addValue(&lv->value), false };
+
+			if (auto ac = dynamic_cast<ApiConstant*>(e))
+				return { addValue(&ac->value), false };
+
+			if (auto rn = dynamic_cast<RegisterName*>(e))
+				return { addValue(rn->data), false };
+
+			if (auto cp = dynamic_cast<CallbackParameterReference*>(e))
+				return { addValue(cp->data), false };
+
+			auto r = allocate();
+			compileExpression(e, r);
+			return { r, true };
+		}
+
+		/** Copies the value to a register if the next expression might change it before it is used. */
+		Value compileOperandBefore(Expression* e, Expression* nextExpression)
+		{
+			auto v = compileOperand(e);
+
+			if (!v.isTemporary && !isPure(nextExpression))
+			{
+				auto r = allocate();
+				emit(OpCode::Move, r, v.operand);
+				return { r, true };
+			}
+
+			return v;
+		}
+
+		void compileStore(Expression* target, Operand value)
+		{
+			if (auto rn = dynamic_cast<RegisterName*>(target))
+			{
+#if ENABLE_SCRIPTING_SAFE_CHECKS
+				if (rn->type)
+				{
+					emit(OpCode::AssignTree, 0, value, 0, target);
+					interpret(target);
+					return;
+				}
+#endif
+				auto idx = emit(OpCode::StoreVariable, 0, value);
+				getInstruction(idx).object = rn->data;
+			}
+			else if (auto lr = dynamic_cast<LocalReference*>(target))
+			{
+				auto idx = emit(OpCode::StoreLocal, 0, value);
+				getInstruction(idx).object = lr->parentFunction;
+				getInstruction(idx).id = lr->id;
+			}
+			else if (auto cl = dynamic_cast<CallbackLocalReference*>(target))
+			{
+				auto idx = emit(OpCode::StoreCallbackLocal, 0, value);
+				getInstruction(idx).object = cl->parentCallback;
+				getInstruction(idx).id = cl->name;
+			}
+			else
+			{
+				emit(OpCode::AssignTree, 0, value, 0, target);
+				interpret(target);
+			}
+		}
+
+		void compileExpression(Expression* e, Operand dst)
+		{
+			if (dynamic_cast<LiteralValue*>(e) != nullptr ||
+				dynamic_cast<ApiConstant*>(e) != nullptr ||
+				dynamic_cast<RegisterName*>(e) != nullptr ||
+				dynamic_cast<CallbackParameterReference*>(e) != nullptr)
+			{
+				emit(OpCode::Move, dst, compileOperand(e).operand);
+			}
+			else if (auto lr = dynamic_cast<LocalReference*>(e))
+			{
+				auto idx = emit(OpCode::LoadLocal, dst);
+				getInstruction(idx).object = lr->parentFunction;
+				getInstruction(idx).id = lr->id;
+			}
+			else if (auto cl = dynamic_cast<CallbackLocalReference*>(e))
+			{
+				auto idx = emit(OpCode::LoadCallbackLocal, dst);
+				getInstruction(idx).object = cl->parentCallback;
+				getInstruction(idx).id = cl->name;
+			}
+			else if (auto pr = dynamic_cast<InlineFunction::ParameterReference*>(e))
+			{
+				auto idx = emit(OpCode::LoadParameter, dst, 0, 0, e);
+				getInstruction(idx).object = pr->f;
+				getInstruction(idx).target = pr->index;
+			}
+			else if (auto bo = dynamic_cast<BinaryOperator*>(e))
+			{
+				auto op = getOpCode(bo->operation);
+
+				if (op == OpCode::EvalTree)
+				{
+					emit(OpCode::EvalTree, dst, 0, 0, e);
+					interpret(e);
+					return;
+				}
+
+				auto a = compileOperandBefore(bo->lhs, bo->rhs);
+				auto b = compileOperand(bo->rhs);
+				emit(op, dst, a.operand, b.operand, e);
+				release(b);
+				release(a);
+			}
+			else if (auto la = dynamic_cast<LogicalAndOp*>(e))
+			{
+				compileExpression(la->lhs, dst);
+				emit(OpCode::ToBool, dst, dst);
+				auto jumpToEnd = emit(OpCode::JumpIfFalse, 0, dst);
+				compileExpression(la->rhs, dst);
+				emit(OpCode::ToBool, dst, dst);
+				getInstruction(jumpToEnd).target = getPosition();
+			}
+			else if (auto lo = dynamic_cast<LogicalOrOp*>(e))
+			{
+				compileExpression(lo->lhs, dst);
+				emit(OpCode::ToBool, dst, dst);
+				auto jumpToEnd = emit(OpCode::JumpIfTrue, 0, dst);
+				compileExpression(lo->rhs, dst);
+				emit(OpCode::ToBool, dst, dst);
+				getInstruction(jumpToEnd).target = getPosition();
+			}
+			else if (dynamic_cast<TypeEqualsOp*>(e) != nullptr || dynamic_cast<TypeNotEqualsOp*>(e) != nullptr)
+			{
+				auto te = dynamic_cast<BinaryOperatorBase*>(e);
+				auto op = dynamic_cast<TypeEqualsOp*>(e) != nullptr ? OpCode::TypeEquals : OpCode::TypeNotEquals;
+
+				auto a = compileOperandBefore(te->lhs, te->rhs);
+				auto b = compileOperand(te->rhs);
+				emit(op, dst, a.operand, b.operand, e);
+				release(b);
+				release(a);
+			}
+			else if (auto co = dynamic_cast<ConditionalOp*>(e))
+			{
+				auto c = compileOperand(co->condition);
+				auto jumpToFalse = emit(OpCode::JumpIfFalse, 0, c.operand);
+				release(c);
+
+				compileExpression(co->trueBranch, dst);
+				auto jumpToEnd = emit(OpCode::Jump);
+				getInstruction(jumpToFalse).target = getPosition();
+				compileExpression(co->falseBranch, dst);
+				getInstruction(jumpToEnd).target = getPosition();
+			}
+			else if (auto pa = dynamic_cast<PostAssignment*>(e))
+			{
+				compileExpression(pa->target, dst);
+
+				Value newValue = { allocate(), true };
+				compileExpression(pa->newValue, newValue.operand);
+				compileStore(pa->target, newValue.operand);
+				release(newValue);
+			}
+			else if (auto sa = dynamic_cast<SelfAssignment*>(e))
+			{
+				compileExpression(sa->newValue, dst);
+				compileStore(sa->target, dst);
+			}
+			else if (auto as = dynamic_cast<Assignment*>(e))
+			{
+				compileExpression(as->newValue, dst);
+				compileStore(as->target, dst);
+			}
+			else if (isEmpty(e))
+			{
+				static const var undefinedValue = var::undefined();
+				emit(OpCode::Move, dst, addValue(&undefinedValue));
+			}
+			else
+			{
+				emit(OpCode::EvalTree, dst, 0, 0, e);
+				interpret(e);
+			}
+		}
+
+		void compileJumpOrExit(bool isBreak)
+		{
+			if (auto l = loops.getLast())
+			{
+				auto idx = emit(OpCode::Jump);
+				(isBreak ? l->breaks : l->continues).add(idx);
+			}
+			else
+			{
+				auto idx = emit(OpCode::Exit);
+				getInstruction(idx).target = isBreak ? Statement::breakWasHit : Statement::continueWasHit;
+			}
+		}
+
+		void compileLoop(LoopStatement* ls)
+		{
+			compileStatement(ls->initialiser);
+
+			loops.add(new LoopLabels());
+
+			auto start = getPosition();
+
+			if (!ls->isDoLoop)
+			{
+				auto c = compileOperand(ls->condition);
+				loops.getLast()->breaks.add(emit(OpCode::JumpIfFalse, 0, c.operand));
+				release(c);
+			}
+
+#if USE_BACKEND
+			emit(OpCode::CheckTimeout, 0, 0, 0, ls);
+#endif
+
+			compileStatement(ls->body);
+
+			auto continuePosition = getPosition();
+
+			compileStatement(ls->iterator);
+
+			if (ls->isDoLoop)
+			{
+				auto c = compileOperand(ls->condition);
+				loops.getLast()->breaks.add(emit(OpCode::JumpIfFalse, 0, c.operand));
+				release(c);
+			}
+
+			getInstruction(emit(OpCode::Jump)).target = start;
+
+			// A continue statement skips the condition check of a do loop
+			if (ls->isDoLoop)
+			{
+				continuePosition = getPosition();
+				compileStatement(ls->iterator);
+				getInstruction(emit(OpCode::Jump)).target = start;
+			}
+
+			ScopedPointer<LoopLabels> labels = loops.removeAndReturn(loops.size() - 1);
+
+			auto end = getPosition();
+
+			for (auto idx : labels->breaks)
+				getInstruction(idx).target = end;
+
+			for (auto idx : labels->continues)
+			{
+				auto& i = getInstruction(idx);
+
+				if (i.op == OpCode::PerformTree)
+					i.secondTarget = continuePosition;
+				else
+					i.target = continuePosition;
+			}
+		}
+
+		void compileInterpretedStatement(Statement* st)
+		{
+			auto idx = emit(OpCode::PerformTree, 0, 0, 0, st);
+
+			// The statement might return a break or continue result code
+			if (auto l = loops.getLast())
+			{
+				l->breaks.add(idx);
+				l->continues.add(idx);
+			}
+
+			interpret(st);
+		}
+
+		void compileStatement(Statement* st)
+		{
+			if (st == nullptr || isEmpty(st))
+				return;
+
+			if (auto bs = dynamic_cast<BlockStatement*>(st))
+			{
+				if (!bs->scopedBlockStatements.isEmpty())
+				{
+					compileInterpretedStatement(st);
+					return;
+				}
+
+				for (auto s : bs->statements)
+					compileStatement(s);
+			}
+			else if (auto is = dynamic_cast<IfStatement*>(st))
+			{
+				auto c = compileOperand(is->condition);
+				auto jumpToFalse = emit(OpCode::JumpIfFalse, 0, c.operand);
+				release(c);
+
+				compileStatement(is->trueBranch);
+
+				if (is->falseBranch != nullptr && !isEmpty(is->falseBranch))
+				{
+					auto jumpToEnd = emit(OpCode::Jump);
+					getInstruction(jumpToFalse).target = getPosition();
+					compileStatement(is->falseBranch);
+					getInstruction(jumpToEnd).target = getPosition();
+				}
+				else
+				{
+					getInstruction(jumpToFalse).target = getPosition();
+				}
+			}
+			else if (auto ls = dynamic_cast<LoopStatement*>(st))
+			{
+				if (ls->isIterator)
+					compileInterpretedStatement(st);
+				else
+					compileLoop(ls);
+			}
+			else if (auto rs = dynamic_cast<ReturnStatement*>(st))
+			{
+				auto v = compileOperand(rs->returnValue);
+				emit(OpCode::Return, 0, v.operand);
+				release(v);
+			}
+			else if (dynamic_cast<BreakStatement*>(st) != nullptr)
+			{
+				compileJumpOrExit(true);
+			}
+			else if (dynamic_cast<ContinueStatement*>(st) != nullptr)
+			{
+				compileJumpOrExit(false);
+			}
+			else if (auto lv = dynamic_cast<LocalVarStatement*>(st))
+			{
+				auto v = compileOperand(lv->initialiser);
+				auto idx = emit(OpCode::StoreLocal, 0, v.operand);
+				getInstruction(idx).object = lv->parentFunction;
+				getInstruction(idx).id = lv->name;
+				release(v);
+			}
+			else if (auto cl = dynamic_cast<CallbackLocalStatement*>(st))
+			{
+				auto v = compileOperand(cl->initialiser);
+				auto idx = emit(OpCode::StoreCallbackLocal, 0, v.operand);
+				getInstruction(idx).object = cl->parentCallback;
+				getInstruction(idx).id = cl->name;
+				release(v);
+			}
+			else if (auto e = dynamic_cast<Expression*>(st))
+			{
+				if (overridesPerform(st))
+				{
+					compileInterpretedStatement(st);
+					return;
+				}
+
+				Value unused = { allocate(), true };
+				compileExpression(e, unused.operand);
+				release(unused);
+			}
+			else
+			{
+				compileInterpretedStatement(st);
+			}
+		}
+
+		void finalise()
+		{
+			jassert(loops.isEmpty());
+			program.values.addArray(pointers);
+		}
+
+		BytecodeStatement& program;
+
+		Array<const var*> pointers;
+		OwnedArray<LoopLabels> loops;
+		Array<Statement*> interpretedStatements;
+
+		int nextRegister = 0;
+		int numNativeOperations = 0;
+		bool ok = true;
+	};
+};
+
+HiseJavascriptEngine::RootObject::OptimizationPass* HiseJavascriptEngine::RootObject::createBytecodeCompiler()
+{
+	return new BytecodeCompiler();
+}
+
+} // namespace hise
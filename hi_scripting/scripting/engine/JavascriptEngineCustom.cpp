@@ -1155,7 +1155,9 @@ void HiseJavascriptEngine::RootObject::HiseSpecialData::registerOptimisationPass
 		optimizations.add(new FunctionInliner());
 	}
 
-	
+	// This must be the last pass because it hides the compiled parts of the syntax tree
+	if (HiseJavascriptEngine::compileToBytecode)
+		optimizations.add(createBytecodeCompiler());
 }
 
 } // namespace hise
@@ -41,7 +41,12 @@ struct HiseJavascriptEngine::RootObject::BinaryOperator : public BinaryOperatorB
 	var getResult(const Scope& s) const override
 	{
 		var a(lhs->getResult(s)), b(rhs->getResult(s));
+		return getResultForValues(a, b);
+	}
 
+	/** Applies the operator to the already evaluated operands. */
+	var getResultForValues(const var& a, const var& b) const
+	{
 		if (isNumericOrUndefined(a) && isNumericOrUndefined(b))
 			return (a.isDouble() || b.isDouble()) ? getWithDoubles(a, b) : getWithInts(a, b);
 
@@ -596,9 +596,7 @@ struct HiseJavascriptEngine::RootObject::BlockStatement : public Statement
 		}
 		else
 		{
-			auto idx = statements.indexOf(childToReplace);
-			statements.set(idx, newStatement.release(), true);
-			return true;
+			return swapIfArrayElement(newStatement, childToReplace, statements);
 		}
 	}
 
@@ -49,6 +49,10 @@ struct DspNetwork::Wrapper
 	API_METHOD_WRAPPER_3(DspNetwork, createAndAdd);
 	API_METHOD_WRAPPER_2(DspNetwork, createFromJSON);
 	API_METHOD_WRAPPER_0(DspNetwork, undo);
+	API_METHOD_WRAPPER_1(DspNetwork, setUseJitCompilation);
+	API_VOID_METHOD_WRAPPER_1(DspNetwork, setProfilingEnabled);
+	API_METHOD_WRAPPER_0(DspNetwork, getProfilingData);
+	API_METHOD_WRAPPER_1(DspNetwork, exportProfilingTrace);
 	//API_VOID_METHOD_WRAPPER_0(DspNetwork, disconnectAll);
 	//API_VOID_METHOD_WRAPPER_3(DspNetwork, injectAfter);
 };
@@ -65,6 +69,9 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
 #endif
 	parentHolder(dynamic_cast<Holder*>(p)),
 	projectNodeHolder(*this)
+#if HISE_INCLUDE_SNEX
+	, jitNodeHolder(*this)
+#endif
 {
 	jassert(data.getType() == PropertyIds::Network);
 
@@ -165,7 +172,13 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
 
 	localCableManager = new routing::local_cable_base::Manager(this);
 
-	setRootNode(createFromValueTree(true, data.getChild(0), true));
+	{
+#if HISE_INCLUDE_SNEX
+		CodeManager::ScopedDeferredCompilation sdc(codeManager);
+#endif
+		setRootNode(createFromValueTree(true, data.getChild(0), true));
+	}
+	
 	networkParameterHandler.root = getRootNode();
 
 	initialId = getId();
@@ -183,6 +196,10 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
 	ADD_API_METHOD_2(clear);
 	ADD_API_METHOD_2(createFromJSON);
 	ADD_API_METHOD_0(undo);
+	ADD_API_METHOD_1(setUseJitCompilation);
+	ADD_API_METHOD_1(setProfilingEnabled);
+	ADD_API_METHOD_0(getProfilingData);
+	ADD_API_METHOD_1(exportProfilingTrace);
 	//ADD_API_METHOD_0(disconnectAll);
 	//ADD_API_METHOD_3(injectAfter);
 
@@ -235,6 +252,29 @@ DspNetwork::DspNetwork(hise::ProcessorWithScriptingContent* p, ValueTree data_,
         nodes.sort(sorter);
     });
 
+#if HISE_FLAT_SCRIPTNODE_SCHEDULE
+	topologyListener.setTypeToWatch(PropertyIds::Nodes);
+	topologyListener.setCallback(data, valuetree::AsyncMode::Synchronously, [this](ValueTree, bool)
+	{
+		// invalidate the schedule immediately and rebuild it once the containers have updated their node lists
+		++topologyVersion;
+
+		if (!flatScheduleRebuildPending.exchange(true))
+		{
+			WeakReference<DspNetwork> safeThis(this);
+
+			MessageManager::callAsync([safeThis]()
+			{
+				if (safeThis.get() != nullptr)
+				{
+					safeThis->flatScheduleRebuildPending = false;
+					safeThis->rebuildFlatSchedule();
+				}
+			});
+		}
+	});
+#endif
+
 	checkIfDeprecated();
 
 	runPostInitFunctions();
@@ -244,6 +284,13 @@ DspNetwork::~DspNetwork()
 {
 	stopTimer();
 
+	activeProfiler.store(nullptr);
+	samplingProfiler = nullptr;
+
+#if HISE_FLAT_SCRIPTNODE_SCHEDULE
+	flatSchedule = nullptr;
+#endif
+
 	root = nullptr;
 	selectionUpdater = nullptr;
 	nodes.clear();
@@ -505,6 +552,10 @@ void DspNetwork::reset()
 	
 	if (projectNodeHolder.isActive())
 		projectNodeHolder.n.reset();
+#if HISE_INCLUDE_SNEX
+	else if (jitNodeHolder.isActive())
+		jitNodeHolder.node->reset();
+#endif
 	else if (auto rn = getRootNode())
 		rn->reset();
 }
@@ -513,6 +564,10 @@ void DspNetwork::handleHiseEvent(HiseEvent& e)
 {
 	if (projectNodeHolder.isActive())
 		projectNodeHolder.n.handleHiseEvent(e);
+#if HISE_INCLUDE_SNEX
+	else if (jitNodeHolder.isActive())
+		jitNodeHolder.node->handleHiseEvent(e);
+#endif
 	else
 		getRootNode()->handleHiseEvent(e);
 }
@@ -538,10 +593,25 @@ void DspNetwork::process(ProcessDataDyn& data)
 		return;
 	}
 
+#if HISE_INCLUDE_SNEX
+	if (jitNodeHolder.isActive())
+	{
+		jitNodeHolder.process(data);
+		return;
+	}
+#endif
+
 	if (auto s = SimpleReadWriteLock::ScopedTryReadLock(getConnectionLock()))
 	{
 		if (exceptionHandler.isOk())
+		{
+#if HISE_FLAT_SCRIPTNODE_SCHEDULE
+			if (processFlatSchedule(data))
+				return;
+#endif
+
 			getRootNode()->process(data);
+		}
 	}
 }
 
@@ -603,8 +673,17 @@ void DspNetwork::prepareToPlay(double sampleRate, double blockSize)
 
 				getRootNode()->reset();
 
+#if HISE_FLAT_SCRIPTNODE_SCHEDULE
+				rebuildFlatSchedule();
+#endif
+
 				if (projectNodeHolder.isActive())
 					projectNodeHolder.prepare(currentSpecs);
+
+#if HISE_INCLUDE_SNEX
+				if (jitNodeHolder.isActive())
+					jitNodeHolder.prepare(currentSpecs);
+#endif
 			}
             
             initialised = true;
@@ -1264,6 +1343,155 @@ void DspNetwork::setUseFrozenNode(bool shouldBeEnabled)
 	reset();
 }
 
+void DspNetwork::setUseFlatSchedule(bool shouldUseFlatSchedule)
+{
+#if HISE_FLAT_SCRIPTNODE_SCHEDULE
+	SimpleReadWriteLock::ScopedWriteLock sl(getConnectionLock(), isInitialised());
+	useFlatSchedule = shouldUseFlatSchedule;
+#else
+	ignoreUnused(shouldUseFlatSchedule);
+#endif
+}
+
+bool DspNetwork::isUsingFlatSchedule() const
+{
+#if HISE_FLAT_SCRIPTNODE_SCHEDULE
+	return useFlatSchedule && flatSchedule != nullptr && flatScheduleVersion == topologyVersion.load();
+#else
+	return false;
+#endif
+}
+
+#if HISE_FLAT_SCRIPTNODE_SCHEDULE
+void DspNetwork::rebuildFlatSchedule()
+{
+	auto version = topologyVersion.load();
+
+	ScopedPointer<FlatProcessSchedule> newSchedule;
+
+	if (auto rn = getRootNode())
+	{
+		if (currentSpecs.blockSize > 0 && currentSpecs.numChannels > 0)
+			newSchedule = new FlatProcessSchedule(rn, currentSpecs);
+	}
+
+	{
+		SimpleReadWriteLock::ScopedWriteLock sl(getConnectionLock(), isInitialised());
+		flatSchedule.swapWith(newSchedule);
+		flatScheduleVersion = version;
+	}
+}
+
+bool DspNetwork::processFlatSchedule(ProcessDataDyn& d)
+{
+	// the recursive calls are required for the peak meters and the CPU profilers
+	if (!useFlatSchedule || signalDisplayEnabled || enableCpuProfiling || getActiveProfiler() != nullptr)
+		return false;
+
+	if (flatSchedule == nullptr || flatScheduleVersion != topologyVersion.load(std::memory_order_relaxed))
+		return false;
+
+	return flatSchedule->process(d);
+}
+#endif
+
+bool DspNetwork::setUseJitCompilation(bool shouldUseJit)
+{
+#if HISE_INCLUDE_SNEX
+	auto r = setUseJitCompiledNode(shouldUseJit);
+
+	if (!r.wasOk())
+		debugError(dynamic_cast<Processor*>(getScriptProcessor()), "JIT compilation of " + getId() + " failed: " + r.getErrorMessage());
+
+	return isJitCompiled() == shouldUseJit;
+#else
+	ignoreUnused(shouldUseJit);
+	return false;
+#endif
+}
+
+void DspNetwork::setProfilingEnabled(bool shouldProfile)
+{
+	if ((getActiveProfiler() != nullptr) == shouldProfile)
+		return;
+
+	if (shouldProfile)
+	{
+		ScopedPointer<NetworkProfiler> newProfiler = new NetworkProfiler(this);
+
+		SimpleReadWriteLock::ScopedWriteLock sl(getConnectionLock(), isInitialised());
+		samplingProfiler.swapWith(newProfiler);
+		activeProfiler.store(samplingProfiler.get(), std::memory_order_release);
+	}
+	else
+	{
+		{
+			SimpleReadWriteLock::ScopedWriteLock sl(getConnectionLock(), isInitialised());
+			activeProfiler.store(nullptr, std::memory_order_release);
+		}
+
+		// keep the profiler alive so that the data can be queried after stopping
+		samplingProfiler->collect();
+	}
+}
+
+var DspNetwork::getProfilingData()
+{
+	if (samplingProfiler == nullptr)
+		return var();
+
+	return samplingProfiler->toJSON();
+}
+
+bool DspNetwork::exportProfilingTrace(var file)
+{
+	if (samplingProfiler == nullptr)
+	{
+		reportScriptError("Call setProfilingEnabled(true) before exporting a trace");
+		return false;
+	}
+
+	if (auto sf = dynamic_cast<ScriptingObjects::ScriptFile*>(file.getObject()))
+	{
+		sf->f.deleteFile();
+		FileOutputStream fos(sf->f);
+
+		if (fos.failedToOpen())
+			return false;
+
+		samplingProfiler->writePerfettoTrace(fos);
+		fos.flush();
+		return fos.getStatus().wasOk();
+	}
+
+	reportScriptError("argument is not a file");
+	return false;
+}
+
+#if HISE_INCLUDE_SNEX
+Result DspNetwork::setUseJitCompiledNode(bool shouldBeEnabled)
+{
+	if (isJitCompiled() == shouldBeEnabled)
+		return Result::ok();
+
+	if (shouldBeEnabled)
+	{
+		if (isFrozen())
+			return Result::fail("The network is already frozen");
+
+		auto r = jitNodeHolder.compile();
+
+		if (!r.wasOk())
+			return r;
+	}
+
+	jitNodeHolder.setEnabled(shouldBeEnabled);
+	reset();
+
+	return Result::ok();
+}
+#endif
+
 bool DspNetwork::hashMatches()
 {
 	return projectNodeHolder.hashMatches;
@@ -1278,6 +1506,10 @@ hise::ScriptParameterHandler* DspNetwork::getCurrentParameterHandler()
 {
 	if (projectNodeHolder.isActive())
 		return &projectNodeHolder;
+#if HISE_INCLUDE_SNEX
+	else if (jitNodeHolder.isActive())
+		return &jitNodeHolder;
+#endif
 	else
 		return &networkParameterHandler;
 }
@@ -1782,12 +2014,98 @@ DspNetwork::CodeManager::CodeManager(DspNetwork& p):
 			
 }
 
+DspNetwork::CodeManager::ScopedDeferredCompilation::ScopedDeferredCompilation(CodeManager& m):
+	manager(m),
+	wasDeferring(m.deferCompilations)
+{
+	manager.deferCompilations = true;
+}
+
+DspNetwork::CodeManager::ScopedDeferredCompilation::~ScopedDeferredCompilation()
+{
+	manager.deferCompilations = wasDeferring;
+
+	if (!wasDeferring)
+		manager.compilePendingWorkbenches();
+}
+
+bool DspNetwork::CodeManager::deferCompilation(snex::ui::WorkbenchData* wb)
+{
+	if (!deferCompilations)
+		return false;
+
+	pendingCompilations.addIfNotAlreadyThere(wb);
+	return true;
+}
+
+void DspNetwork::CodeManager::compilePendingWorkbenches()
+{
+	Array<snex::ui::WorkbenchData::Ptr> workbenches;
+	std::swap(workbenches, pendingCompilations);
+
+	auto compile = [](snex::ui::WorkbenchData::Ptr wb)
+	{
+		if (auto h = dynamic_cast<SnexSourceCompileHandler*>(wb->getCompileHandler()))
+			h->compileAndMeasure();
+		else
+			wb->handleCompilation();
+	};
+
+	const int numThreads = jmin(HISE_NUM_SNEX_COMPILE_THREADS, SystemStats::getNumCpus(), workbenches.size());
+
+	if (numThreads <= 1)
+	{
+		for (auto wb : workbenches)
+			compile(wb);
+
+		return;
+	}
+
+	// Only the compilation itself runs on the worker threads. The compile handlers
+	// update the network's ValueTree through the shared UndoManager when they are
+	// notified, so this happens one workbench after another on this thread.
+	Array<double> compileTimes;
+	compileTimes.insertMultiple(0, 0.0, workbenches.size());
+
+	{
+		ThreadPool pool(numThreads);
+		WaitableEvent allCompiled;
+		std::atomic<int> numPending = { workbenches.size() };
+
+		for (int i = 0; i < workbenches.size(); i++)
+		{
+			pool.addJob([&, i]()
+			{
+				auto start = Time::getMillisecondCounterHiRes();
+				workbenches[i]->compileWithoutNotification();
+				compileTimes.getReference(i) = Time::getMillisecondCounterHiRes() - start;
+
+				if (--numPending == 0)
+					allCompiled.signal();
+			});
+		}
+
+		allCompiled.wait();
+	}
+
+	for (int i = 0; i < workbenches.size(); i++)
+	{
+		auto wb = workbenches[i];
+
+		// This starts the optimisation on the compile handler thread
+		wb->handlePostCompilation();
+
+		if (auto h = dynamic_cast<SnexSourceCompileHandler*>(wb->getCompileHandler()))
+			h->addCompileTime(compileTimes[i]);
+	}
+}
+
 DspNetwork::CodeManager::SnexSourceCompileHandler::SnexCompileListener::~SnexCompileListener()
 {}
 
 DspNetwork::CodeManager::SnexSourceCompileHandler::~SnexSourceCompileHandler()
 {
-	stopThread(1000);
+	cancelAndWaitForThread();
 }
 
 void DspNetwork::CodeManager::SnexSourceCompileHandler::processTestParameterEvent(int parameterIndex, double value)
@@ -1806,8 +2124,7 @@ void DspNetwork::CodeManager::SnexSourceCompileHandler::postCompile(ui::Workbenc
 
 	if (currentThread != this)
 	{
-		runTestNext.store(true);
-		startThread();
+		startPostCompileThread();
 		return;
 	}
 
@@ -1853,11 +2170,17 @@ snex::ui::WorkbenchData::Ptr DspNetwork::CodeManager::getOrCreate(const Identifi
 
 	auto ef = parent.getMainController()->getExternalScriptFile(targetFile, false);
 
+	Entry* e;
+
 	if(ef != nullptr)
-		return entries.add(new Entry(typeId, ef, parent.getScriptProcessor()))->wb;
+		e = entries.add(new Entry(typeId, ef, parent.getScriptProcessor()));
 	else
-		return entries.add(new Entry(typeId, targetFile, parent.getScriptProcessor()))->wb;
-	
+		e = entries.add(new Entry(typeId, targetFile, parent.getScriptProcessor()));
+
+	if (auto h = dynamic_cast<SnexSourceCompileHandler*>(e->wb->getCompileHandler()))
+		h->setCodeManager(this);
+
+	return e->wb;
 }
 
 ValueTree DspNetwork::CodeManager::getParameterTree(const Identifier& typeId, const Identifier& classId)
@@ -1985,28 +2308,65 @@ void DspNetwork::CodeManager::SnexSourceCompileHandler::run()
 	{
         auto r = getParent()->getLastResult();
 		postCompile(r);
-		return;
 	}
+	else
+		compileAndMeasure();
+
+	// The baseline code is already running, so we can take our time
+	// and replace it with the optimised code
+	if (!threadShouldExit())
+		getParent()->optimiseLastResult();
+}
+
+void DspNetwork::CodeManager::SnexSourceCompileHandler::startPostCompileThread()
+{
+	// startThread() does nothing if the thread is still busy with the last result
+	cancelAndWaitForThread();
+
+	runTestNext.store(true);
+	startThread();
+}
+
+void DspNetwork::CodeManager::SnexSourceCompileHandler::cancelAndWaitForThread()
+{
+	signalThreadShouldExit();
+	waitForThreadToExit(-1);
+}
+
+void DspNetwork::CodeManager::SnexSourceCompileHandler::compileAndMeasure()
+{
+	auto start = Time::getMillisecondCounterHiRes();
 
 	getParent()->handleCompilation();
+
+	addCompileTime(Time::getMillisecondCounterHiRes() - start);
+}
+
+void DspNetwork::CodeManager::SnexSourceCompileHandler::addCompileTime(double milliseconds)
+{
+	auto& timings = getMainController()->getJavascriptThreadPool().getCompileTimings();
+	timings.add(dynamic_cast<Processor*>(sp), "SNEX", getParent()->getInstanceId().toString(), milliseconds);
 }
 
 bool DspNetwork::CodeManager::SnexSourceCompileHandler::triggerCompilation()
 {
 	getParent()->getGlobalScope().getBreakpointHandler().abort();
 
-	if (isThreadRunning())
-		stopThread(3000);
+	cancelAndWaitForThread();
 
 	auto currentThread = getMainController()->getKillStateHandler().getCurrentThread();
 
 	if (currentThread == MainController::KillStateHandler::TargetThread::SampleLoadingThread ||
 		currentThread == MainController::KillStateHandler::TargetThread::ScriptingThread)
 	{
-		getParent()->handleCompilation();
+		if (manager == nullptr || !manager->deferCompilation(getParent()))
+			compileAndMeasure();
+
 		return true;
 	}
 
+	// a cancelled thread might not have reset this flag
+	runTestNext.store(false);
 	startThread();
 	return false;
 }
@@ -2410,6 +2770,188 @@ void DspNetwork::ProjectNodeHolder::init(dll::StaticLibraryHostFactory* staticLi
 	}
 }
 
+#if HISE_INCLUDE_SNEX
+DspNetwork::JitNodeHolder::JitNodeHolder(DspNetwork& parent):
+	AnyListener(valuetree::AsyncMode::Asynchronously),
+	network(parent)
+{
+	memset(parameterValues, 0, sizeof(parameterValues));
+
+	memory.setUseTieredCompilation(SNEX_MIR_TIERED_COMPILATION);
+
+	setPropertyCondition([](const ValueTree& v, const Identifier& id)
+	{
+		// The root parameters are forwarded to the compiled node...
+		if (id == PropertyIds::Value && v.getType() == PropertyIds::Parameter)
+			return v.getParent().getParent().getParent().getType() != PropertyIds::Network;
+
+		// ...and these properties don't change the generated code
+		static const Array<Identifier> uiIds =
+		{
+			PropertyIds::Folded, 
+			PropertyIds::NodeColour, 
+			PropertyIds::Comment, 
+			PropertyIds::ShowComments,
+			PropertyIds::ShowParameters,
+			PropertyIds::Locked,
+			PropertyIds::Bookmarks
+		};
+
+		return !uiIds.contains(id);
+	});
+
+	setRootValueTree(network.data);
+}
+
+DspNetwork::JitNodeHolder::~JitNodeHolder()
+{
+	optimiser.stop();
+}
+
+DspNetwork::JitNodeHolder::Optimiser::Optimiser():
+	Thread("JIT Network Optimiser")
+{}
+
+void DspNetwork::JitNodeHolder::Optimiser::optimise(snex::jit::JitCompiledNode::Ptr n)
+{
+	stop();
+	nodeToOptimise = n;
+	startThread();
+}
+
+void DspNetwork::JitNodeHolder::Optimiser::stop()
+{
+	// The optimisation can't be interrupted, so this waits until it's done
+	signalThreadShouldExit();
+	waitForThreadToExit(-1);
+	nodeToOptimise = nullptr;
+}
+
+void DspNetwork::JitNodeHolder::Optimiser::run()
+{
+	if (!threadShouldExit() && nodeToOptimise != nullptr)
+		nodeToOptimise->optimise();
+}
+
+Identifier DspNetwork::JitNodeHolder::getParameterId(int index) const
+{ return network.networkParameterHandler.getParameterId(index); }
+
+int DspNetwork::JitNodeHolder::getNumParameters() const
+{ return parameters.size(); }
+
+void DspNetwork::JitNodeHolder::setParameter(int index, float newValue)
+{
+	if (isPositiveAndBelow(index, parameters.size()))
+	{
+		parameterValues[index] = newValue;
+		parameters.getReference(index).callback.call(newValue);
+	}
+}
+
+float DspNetwork::JitNodeHolder::getParameter(int index) const
+{
+	if (isPositiveAndBelow(index, OpaqueNode::NumMaxParameters))
+		return parameterValues[index];
+
+	return 0.0f;
+}
+
+Result DspNetwork::JitNodeHolder::compile()
+{
+	if (network.isPolyphonic())
+		return Result::fail("Polyphonic networks can't be JIT compiled");
+
+	auto rn = network.getRootNode();
+
+	if (rn == nullptr)
+		return Result::fail("No root node");
+
+	auto rootTree = rn->getValueTree();
+
+	snex::cppgen::ValueTreeBuilder vb(rootTree, snex::cppgen::ValueTreeBuilder::Format::JitCompiledInstance);
+	auto br = vb.createCppCode();
+
+	if (!br.r.wasOk())
+		return br.r;
+
+	auto numChannels = network.currentSpecs.numChannels;
+
+	if (numChannels == 0)
+		numChannels = snex::cppgen::ValueTreeBuilder::getRootChannelAmount(rootTree);
+
+	snex::jit::Compiler::Ptr newCompiler = new snex::jit::Compiler(memory);
+	snex::jit::JitCompiledNode::Ptr newNode = new snex::jit::JitCompiledNode(*newCompiler, br.code, rootTree[PropertyIds::ID].toString(), numChannels);
+
+	if (!newNode->r.wasOk())
+		return newNode->r;
+
+	if (auto dh = network.getExternalDataHolder())
+		newNode->setExternalDataHolder(dh);
+
+	if (network.currentSpecs)
+		newNode->prepare(network.currentSpecs);
+
+	{
+		SimpleReadWriteLock::ScopedWriteLock sl(network.getConnectionLock());
+
+		std::swap(node, newNode);
+		std::swap(compiler, newCompiler);
+		parameters = node->getParameterList();
+	}
+
+	// The node runs the baseline code until the optimised code is ready
+	if (node->getJitObject().isBaseline())
+		optimiser.optimise(node);
+
+	return Result::ok();
+}
+
+void DspNetwork::JitNodeHolder::prepare(PrepareSpecs ps)
+{
+	if (node != nullptr)
+		node->prepare(ps);
+}
+
+void DspNetwork::JitNodeHolder::process(ProcessDataDyn& data)
+{
+	if (auto s = SimpleReadWriteLock::ScopedTryReadLock(network.getConnectionLock()))
+	{
+		NodeProfiler np(network.getRootNode(), data.getNumSamples());
+		node->process(data);
+	}
+}
+
+void DspNetwork::JitNodeHolder::setEnabled(bool shouldBeEnabled)
+{
+	if (node == nullptr)
+		return;
+
+	if (shouldBeEnabled != forwardToNode)
+	{
+		auto s1 = static_cast<ScriptParameterHandler*>(&network.networkParameterHandler);
+		auto s2 = static_cast<ScriptParameterHandler*>(this);
+
+		auto oh = shouldBeEnabled ? s1 : s2;
+		auto nh = shouldBeEnabled ? s2 : s1;
+
+		for (int i = 0; i < nh->getNumParameters(); i++)
+			nh->setParameter(i, oh->getParameter(i));
+
+		SimpleReadWriteLock::ScopedWriteLock sl(network.getConnectionLock());
+		forwardToNode = shouldBeEnabled;
+	}
+}
+
+void DspNetwork::JitNodeHolder::anythingChanged(CallbackType cb)
+{
+	if (cb == CallbackType::ValueTreeRedirected || !isActive())
+		return;
+
+	// the compiled code doesn't reflect the network anymore, so go back to the interpreted nodes
+	network.setUseJitCompiledNode(false);
+}
+#endif
+
 int HostHelpers::getNumMaxDataObjects(const ValueTree& v, snex::ExternalData::DataType t)
 {
 	auto id = Identifier(snex::ExternalData::getDataTypeName(t, false));
@@ -47,6 +47,8 @@ using namespace hise;
 
 
 struct NodeFactory;
+struct FlatProcessSchedule;
+class NetworkProfiler;
 
 struct DeprecationChecker
 {
@@ -312,6 +314,24 @@ public:
 	{
 		CodeManager(DspNetwork& p);
 
+		/** Collects the SNEX compilations that would be executed synchronously while this object
+		    exists and compiles them in parallel when it goes out of scope. 
+			
+			This is used during the creation of the network so that the load time isn't the sum of
+			all SNEX classes. Every workbench has its own GlobalScope, so they can be compiled at the 
+			same time.
+		*/
+		struct ScopedDeferredCompilation
+		{
+			ScopedDeferredCompilation(CodeManager& m);
+			~ScopedDeferredCompilation();
+
+		private:
+
+			CodeManager& manager;
+			const bool wasDeferring;
+		};
+
 		struct SnexSourceCompileHandler : public snex::ui::WorkbenchData::CompileHandler,
 		                                  public ControlledObject,
 		                                  public Thread
@@ -359,8 +379,32 @@ public:
 
 			void setTestBase(TestBase* ownedTest);
 
+			void setCodeManager(CodeManager* m) { manager = m; }
+
+			/** Compiles the workbench and adds the compile time to the CompileTimings. */
+			void compileAndMeasure();
+
+			/** Adds the time it took to compile the workbench to the CompileTimings. */
+			void addCompileTime(double milliseconds);
+
 		private:
 
+			/** Runs the test and the optimisation of the last result on this thread. 
+			
+				This is used by every compilation that doesn't happen on this thread (the
+				synchronous and the deferred parallel compilation).
+			*/
+			void startPostCompileThread();
+
+			/** Cancels the test or optimisation that is running on this thread. 
+			
+				The MIR code generator can't be interrupted, so this waits until a running
+				optimisation is finished instead of killing the thread.
+			*/
+			void cancelAndWaitForThread();
+
+			CodeManager* manager = nullptr;
+
 			std::atomic<bool> runTestNext = false;
 
 			ScopedPointer<TestBase> test;
@@ -380,6 +424,13 @@ public:
 
 	private:
 
+		bool deferCompilation(snex::ui::WorkbenchData* wb);
+
+		void compilePendingWorkbenches();
+
+		bool deferCompilations = false;
+		Array<snex::ui::WorkbenchData::Ptr> pendingCompilations;
+
 		struct Entry
 		{
 			Entry(const Identifier& t, const File& targetFile, ProcessorWithScriptingContent* sp);
@@ -409,6 +460,7 @@ public:
 				wb = new snex::ui::WorkbenchData();
 				wb->setCodeProvider(cp, dontSendNotification);
 				wb->setCompileHandler(new SnexSourceCompileHandler(wb.get(), sp));
+				wb->getGlobalScope().setUseTieredCompilation(SNEX_MIR_TIERED_COMPILATION);
 
 				parameterTree = pTree;
 
@@ -527,6 +579,18 @@ public:
 	/** Undo the last action. */
 	bool undo();
 
+	/** Compiles the network with the SNEX JIT compiler and processes the compiled graph instead of the nodes. Returns false if the network can't be compiled. */
+	bool setUseJitCompilation(bool shouldUseJit);
+
+	/** Starts or stops the per-node sampling profiler. The data of the last session stays available after stopping. */
+	void setProfilingEnabled(bool shouldProfile);
+
+	/** Returns a hierarchical JSON object with the call count, average / max time and the CPU budget of every node. */
+	var getProfilingData();
+
+	/** Writes the recorded node calls as trace event JSON file that can be loaded into Perfetto / chrome://tracing. */
+	bool exportProfilingTrace(var file);
+
 	void checkValid() const
 	{
 		if (parentHolder == nullptr)
@@ -691,6 +755,9 @@ public:
 
 	bool& getCpuProfileFlag() { return enableCpuProfiling; };
 
+	/** Returns the profiler that is currently recording or nullptr. This is called from the audio thread. */
+	NetworkProfiler* getActiveProfiler() const noexcept { return activeProfiler.load(std::memory_order_acquire); }
+
 	void setVoiceKiller(VoiceResetter* newVoiceKiller)
 	{
 		if (isPolyphonic())
@@ -703,6 +770,16 @@ public:
 
 	bool isFrozen() const { return projectNodeHolder.isActive(); }
 
+#if HISE_INCLUDE_SNEX
+	/** Generates the SNEX code for this network, compiles it with the JIT compiler and swaps
+	    it with the interpreted nodes. If the compilation fails, the nodes will stay active. 
+		
+		This must not be called from the audio thread. */
+	Result setUseJitCompiledNode(bool shouldBeEnabled);
+
+	bool isJitCompiled() const { return jitNodeHolder.isActive(); }
+#endif
+
 	bool hashMatches();
 
 	void setExternalData(const snex::ExternalData & d, int index);
@@ -737,6 +814,12 @@ public:
 
 
     bool isSignalDisplayEnabled() const { return signalDisplayEnabled; }
+
+	/** Enables the flattened process schedule (if HISE_FLAT_SCRIPTNODE_SCHEDULE is enabled). 
+	    Disable it to compare the performance with the recursive container calls. */
+	void setUseFlatSchedule(bool shouldUseFlatSchedule);
+
+	bool isUsingFlatSchedule() const;
     
     void setSignalDisplayEnabled(bool shouldBeEnabled)
     {
@@ -756,6 +839,19 @@ private:
 	valuetree::PropertyListener idGuard;
 
     bool signalDisplayEnabled = false;
+
+#if HISE_FLAT_SCRIPTNODE_SCHEDULE
+	void rebuildFlatSchedule();
+
+	bool processFlatSchedule(ProcessDataDyn& data);
+
+	ScopedPointer<FlatProcessSchedule> flatSchedule;
+	std::atomic<int> topologyVersion = { 0 };
+	int flatScheduleVersion = -1;
+	std::atomic<bool> flatScheduleRebuildPending = { false };
+	bool useFlatSchedule = true;
+	valuetree::RecursiveTypedChildListener topologyListener;
+#endif
     
 	Array<std::function<bool()>> postInitFunctions;
 
@@ -763,6 +859,9 @@ private:
 
 	bool enableCpuProfiling = false;
 
+	ScopedPointer<NetworkProfiler> samplingProfiler;
+	std::atomic<NetworkProfiler*> activeProfiler = { nullptr };
+
 	WeakReference<ExternalDataHolder> dataHolder;
 	WeakReference<DspNetwork> parentNetwork;
 
@@ -882,6 +981,69 @@ private:
 		bool loaded = false;
 		bool forwardToNode = false;
 	} projectNodeHolder;
+
+#if HISE_INCLUDE_SNEX
+	/** Holds the JIT compiled version of the network. It will fall back to the interpreted
+	    nodes as soon as anything that is baked into the compiled code is changed. */
+	struct JitNodeHolder: public hise::ScriptParameterHandler,
+						  public valuetree::AnyListener
+	{
+		JitNodeHolder(DspNetwork& parent);
+
+		~JitNodeHolder();
+
+		Identifier getParameterId(int index) const override;
+
+		int getParameterIndexForIdentifier(const Identifier& id) const override
+		{
+			return network.networkParameterHandler.getParameterIndexForIdentifier(id);
+		}
+
+		int getNumParameters() const override;
+
+		void setParameter(int index, float newValue) override;
+
+		float getParameter(int index) const override;
+
+		bool isActive() const { return forwardToNode; }
+
+		Result compile();
+
+		void prepare(PrepareSpecs ps);
+
+		void process(ProcessDataDyn& data);
+
+		void setEnabled(bool shouldBeEnabled);
+
+		void anythingChanged(CallbackType cb) override;
+
+		/** Replaces the baseline code of the tiered compilation with the optimised code
+		    on a background thread. */
+		struct Optimiser: public Thread
+		{
+			Optimiser();
+
+			/** Waits for the current optimisation and starts optimising the given node. */
+			void optimise(snex::jit::JitCompiledNode::Ptr n);
+
+			/** Waits until the current optimisation is finished. */
+			void stop();
+
+			void run() override;
+
+			snex::jit::JitCompiledNode::Ptr nodeToOptimise;
+		};
+
+		float parameterValues[OpaqueNode::NumMaxParameters];
+		DspNetwork& network;
+		snex::jit::GlobalScope memory;
+		snex::jit::Compiler::Ptr compiler;
+		snex::jit::JitCompiledNode::Ptr node;
+		ParameterDataList parameters;
+		bool forwardToNode = false;
+		Optimiser optimiser;
+	} jitNodeHolder;
+#endif
     
 	JUCE_DECLARE_WEAK_REFERENCEABLE(DspNetwork);
 };
@@ -0,0 +1,279 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licensed for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+
+namespace scriptnode
+{
+using namespace juce;
+using namespace hise;
+
+NetworkProfiler::NetworkProfiler(DspNetwork* network) :
+	Thread("Scriptnode Profiler"),
+	sampleRate(network->getOriginalSampleRate())
+{
+	for (auto n : network->getListOfNodesWithType<NodeBase>(true))
+		n->setProfileIndex(-1);
+
+	if (auto rn = network->getRootNode())
+		addNode(rn, -1, {});
+
+	traceEvents.ensureStorageAllocated(NumMaxTraceEvents);
+	firstTick = Time::getHighResolutionTicks();
+
+	startThread(3);
+}
+
+NetworkProfiler::~NetworkProfiler()
+{
+	stopThread(1000);
+}
+
+void NetworkProfiler::addNode(NodeBase* n, int parentIndex, const String& parentPath)
+{
+	Statistics s;
+	s.id = n->getId();
+	s.path = parentPath.isEmpty() ? s.id : (parentPath + "." + s.id);
+	s.parentIndex = parentIndex;
+
+	auto index = statistics.size();
+	n->setProfileIndex(index);
+
+	auto container = dynamic_cast<NodeContainer*>(n);
+	s.isContainer = container != nullptr;
+
+	statistics.add(s);
+
+	if (container != nullptr)
+	{
+		for (auto c : container->getNodeList())
+			addNode(c, index, statistics[index].path);
+	}
+}
+
+void NetworkProfiler::run()
+{
+	while (!threadShouldExit())
+	{
+		collect();
+		wait(50);
+	}
+
+	collect();
+}
+
+void NetworkProfiler::collect()
+{
+	ScopedLock sl(statisticLock);
+
+	auto now = Time::getHighResolutionTicks();
+	auto staleTicks = Time::secondsToHighResolutionTicks((double)StaleMilliseconds * 0.001);
+
+	for (int i = 0; i < NumMaxThreads; i++)
+	{
+		auto& tb = buffers[i];
+		auto owner = tb.threadId.load();
+
+		if (owner == nullptr)
+			continue;
+
+		// a new thread has claimed the buffer, so start the stale timeout from now
+		if (owner != lastOwners[i])
+		{
+			lastOwners[i] = owner;
+			lastActivityTicks[i] = now;
+		}
+
+		auto numPopped = tb.pop([&](const Sample& s) { addSample(s, i); });
+
+		if (numPopped > 0)
+			lastActivityTicks[i] = now;
+		else if (now - lastActivityTicks[i] > staleTicks)
+			releaseBuffer(i, owner);
+	}
+}
+
+void NetworkProfiler::releaseBuffer(int index, Thread::ThreadID owner)
+{
+	auto& tb = buffers[index];
+
+	// Mark the buffer as released first so that the owner stops writing, then wait
+	// for a push that has already passed the owner check
+	if (!tb.threadId.compare_exchange_strong(owner, getReleasedThreadId()))
+		return;
+
+	while (tb.busy.load())
+		Thread::yield();
+
+	tb.pop([&](const Sample& s) { addSample(s, index); });
+
+	lastOwners[index] = nullptr;
+	tb.threadId.store(nullptr);
+}
+
+void NetworkProfiler::addSample(const Sample& s, int threadIndex)
+{
+	if (!isPositiveAndBelow(s.nodeIndex, statistics.size()))
+		return;
+
+	auto& st = statistics.getReference(s.nodeIndex);
+	auto delta = s.endTicks - s.startTicks;
+
+	st.numCalls++;
+	st.numSamples += s.numSamples;
+	st.totalTicks += delta;
+	st.maxTicks = jmax(st.maxTicks, delta);
+
+	TraceEvent e = { s, threadIndex };
+
+	if (traceEvents.size() < NumMaxTraceEvents)
+		traceEvents.add(e);
+	else
+		traceEvents.set(traceWriteIndex, e);
+
+	traceWriteIndex = (traceWriteIndex + 1) % NumMaxTraceEvents;
+}
+
+int NetworkProfiler::getNumDroppedSamples() const
+{
+	int numDropped = 0;
+
+	for (const auto& tb : buffers)
+		numDropped += tb.numDropped.load(std::memory_order_relaxed);
+
+	return numDropped;
+}
+
+Array<NetworkProfiler::Statistics> NetworkProfiler::getStatistics() const
+{
+	ScopedLock sl(statisticLock);
+	return statistics;
+}
+
+var NetworkProfiler::createJSONNode(int index, double budgetSeconds)
+{
+	const auto& s = statistics.getReference(index);
+
+	auto toMs = [](int64 ticks) { return Time::highResolutionTicksToSeconds(ticks) * 1000.0; };
+
+	auto childTicks = (int64)0;
+	Array<var> children;
+
+	for (int i = index + 1; i < statistics.size(); i++)
+	{
+		const auto& c = statistics.getReference(i);
+
+		if (c.parentIndex == index)
+		{
+			childTicks += c.totalTicks;
+			children.add(createJSONNode(i, budgetSeconds));
+		}
+	}
+
+	DynamicObject::Ptr obj = new DynamicObject();
+
+	obj->setProperty("id", s.id);
+	obj->setProperty("path", s.path);
+	obj->setProperty("calls", s.numCalls);
+	obj->setProperty("totalMs", toMs(s.totalTicks));
+	obj->setProperty("averageMs", s.numCalls > 0 ? toMs(s.totalTicks) / (double)s.numCalls : 0.0);
+	obj->setProperty("maxMs", toMs(s.maxTicks));
+	obj->setProperty("selfMs", toMs(s.totalTicks > childTicks ? s.totalTicks - childTicks : 0));
+
+	auto seconds = Time::highResolutionTicksToSeconds(s.totalTicks);
+	obj->setProperty("budgetPercent", budgetSeconds > 0.0 ? 100.0 * seconds / budgetSeconds : 0.0);
+
+	if (s.isContainer)
+		obj->setProperty("children", var(children));
+
+	return var(obj.get());
+}
+
+var NetworkProfiler::toJSON()
+{
+	collect();
+
+	ScopedLock sl(statisticLock);
+
+	if (statistics.isEmpty())
+		return {};
+
+	// The audio time that was processed by the root node is the available CPU budget
+	auto budgetSeconds = sampleRate > 0.0 ? (double)statistics.getReference(0).numSamples / sampleRate : 0.0;
+
+	auto root = createJSONNode(0, budgetSeconds);
+
+	if (auto obj = root.getDynamicObject())
+	{
+		obj->setProperty("sampleRate", sampleRate);
+		obj->setProperty("droppedSamples", getNumDroppedSamples());
+	}
+
+	return root;
+}
+
+void NetworkProfiler::writePerfettoTrace(OutputStream& output)
+{
+	collect();
+
+	ScopedLock sl(statisticLock);
+
+	// The events are stored in a ring buffer so we start with the oldest one
+	auto numEvents = traceEvents.size();
+	auto offset = numEvents < NumMaxTraceEvents ? 0 : traceWriteIndex;
+
+	auto toMicroSeconds = [this](int64 ticks)
+	{
+		return String(Time::highResolutionTicksToSeconds(ticks - firstTick) * 1000000.0, 3);
+	};
+
+	output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+	for (int i = 0; i < numEvents; i++)
+	{
+		const auto& e = traceEvents.getReference((offset + i) % numEvents);
+		const auto& s = statistics.getReference(e.s.nodeIndex);
+
+		if (i != 0)
+			output << ",";
+
+		output << "\n{\"name\":" << JSON::toString(s.id) << ",\"cat\":" << JSON::toString(s.isContainer ? "container" : "node");
+		output << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << String(e.threadIndex);
+		output << ",\"ts\":" << toMicroSeconds(e.s.startTicks);
+		output << ",\"dur\":" << String(Time::highResolutionTicksToSeconds(e.s.endTicks - e.s.startTicks) * 1000000.0, 3);
+		output << ",\"args\":{\"path\":" << JSON::toString(s.path) << ",\"numSamples\":" << String(e.s.numSamples) << "}}";
+	}
+
+	output << "\n]}\n";
+}
+
+}
@@ -0,0 +1,230 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licensed for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+#pragma once
+
+namespace scriptnode
+{
+using namespace juce;
+/** A sampling profiler that records the processing time of every node of a running network.
+
+	When the profiler is running, every NodeProfiler scope writes a sample with the high resolution
+	tick counts of the process call into a lock free ring buffer that belongs to the calling thread
+	(so nodes processed on the worker threads of a parallel container don't contend with the
+	audio thread). A background thread collects the samples and accumulates them into a timing
+	tree that mirrors the container hierarchy of the network, which can then be exported as JSON
+	or as trace file that can be loaded into Perfetto (or chrome://tracing).
+
+	The nodes are identified by the index that was assigned when the profiler was started, so
+	nodes that are added while profiling are ignored and deleted nodes can't cause dangling pointers.
+
+	A thread claims a ring buffer with its first sample. If a thread stops recording (eg. because
+	the worker pool was rebuilt), the background thread releases its buffer after StaleMilliseconds
+	so that the slot can be reused by another thread.
+*/
+class NetworkProfiler : private Thread
+{
+public:
+
+	static constexpr int NumMaxThreads = 16;
+	static constexpr int NumSamplesPerThread = 8192;
+	static constexpr int NumMaxTraceEvents = 65536;
+	static constexpr int StaleMilliseconds = 1000;
+
+	struct Statistics
+	{
+		String id;
+		String path;
+		int parentIndex = -1;
+		bool isContainer = false;
+
+		int64 numCalls = 0;
+		int64 numSamples = 0;
+		int64 totalTicks = 0;
+		int64 maxTicks = 0;
+	};
+
+	NetworkProfiler(DspNetwork* network);
+	~NetworkProfiler();
+
+	/** Called by the NodeProfiler on the audio thread (or a worker thread). */
+	void record(int nodeIndex, int64 startTicks, int64 endTicks, int numSamples) noexcept
+	{
+		auto id = Thread::getCurrentThreadId();
+
+		if (auto tb = getBufferForThread(id))
+		{
+			tb->busy.store(true);
+
+			// The background thread might have released the buffer in the meantime
+			if (tb->threadId.load() == id)
+				tb->push({ nodeIndex, startTicks, endTicks, numSamples });
+			else
+				tb->numDropped.fetch_add(1, std::memory_order_relaxed);
+
+			tb->busy.store(false);
+		}
+	}
+
+	/** Collects the pending samples. This is called periodically by the background thread. */
+	void collect();
+
+	/** Returns the timing tree as JSON object. 
+	
+		Every node contains its total, average, maximum and self time (the time not spent in
+		child nodes) in milliseconds as well as the percentage of the audio budget that it used.
+	*/
+	var toJSON();
+
+	/** Writes the recorded process calls in the JSON trace event format that Perfetto can load. */
+	void writePerfettoTrace(OutputStream& output);
+
+	/** Returns the number of samples that were dropped because a ring buffer was full. */
+	int getNumDroppedSamples() const;
+
+	Array<Statistics> getStatistics() const;
+
+private:
+
+	struct Sample
+	{
+		int nodeIndex;
+		int64 startTicks;
+		int64 endTicks;
+		int numSamples;
+	};
+
+	struct TraceEvent
+	{
+		Sample s;
+		int threadIndex;
+	};
+
+	/** A single producer, single consumer queue that is owned by one audio thread. */
+	struct ThreadBuffer
+	{
+		ThreadBuffer()
+		{
+			samples.calloc(NumSamplesPerThread);
+		}
+
+		void push(const Sample& s) noexcept
+		{
+			auto w = writePosition.load(std::memory_order_relaxed);
+
+			if (w - readPosition.load(std::memory_order_acquire) >= NumSamplesPerThread)
+			{
+				numDropped.fetch_add(1, std::memory_order_relaxed);
+				return;
+			}
+
+			samples[w & (NumSamplesPerThread - 1)] = s;
+			writePosition.store(w + 1, std::memory_order_release);
+		}
+
+		template <typename F> int pop(const F& f)
+		{
+			auto r = readPosition.load(std::memory_order_relaxed);
+			auto w = writePosition.load(std::memory_order_acquire);
+			auto numPopped = (int)(w - r);
+
+			for (; r != w; r++)
+				f(samples[r & (NumSamplesPerThread - 1)]);
+
+			readPosition.store(r, std::memory_order_release);
+			return numPopped;
+		}
+
+		std::atomic<Thread::ThreadID> threadId = { nullptr };
+		std::atomic<bool> busy = { false };
+		std::atomic<uint32> writePosition = { 0 };
+		std::atomic<uint32> readPosition = { 0 };
+		std::atomic<int> numDropped = { 0 };
+		HeapBlock<Sample> samples;
+	};
+
+	/** The owner of a buffer that is being released. This is never a valid thread ID. */
+	static Thread::ThreadID getReleasedThreadId() noexcept
+	{
+		return reinterpret_cast<Thread::ThreadID>(~(pointer_sized_int)0);
+	}
+
+	ThreadBuffer* getBufferForThread(Thread::ThreadID id) noexcept
+	{
+		// released slots leave gaps, so look for an existing buffer before claiming a new one
+		for (auto& tb : buffers)
+		{
+			if (tb.threadId.load(std::memory_order_relaxed) == id)
+				return &tb;
+		}
+
+		for (auto& tb : buffers)
+		{
+			Thread::ThreadID expected = nullptr;
+
+			if (tb.threadId.compare_exchange_strong(expected, id))
+				return &tb;
+		}
+
+		return nullptr;
+	}
+
+	/** Drains the buffer and makes it available for other threads. */
+	void releaseBuffer(int index, Thread::ThreadID owner);
+
+	void addSample(const Sample& s, int threadIndex);
+
+	void run() override;
+
+	void addNode(NodeBase* n, int parentIndex, const String& parentPath);
+
+	var createJSONNode(int index, double budgetSeconds);
+
+	ThreadBuffer buffers[NumMaxThreads];
+
+	// only accessed by collect()
+	Thread::ThreadID lastOwners[NumMaxThreads] = {};
+	int64 lastActivityTicks[NumMaxThreads] = {};
+
+	mutable CriticalSection statisticLock;
+	Array<Statistics> statistics;
+	Array<TraceEvent> traceEvents;
+	int traceWriteIndex = 0;
+
+	int64 firstTick = 0;
+	double sampleRate = 0.0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NetworkProfiler);
+};
+
+}
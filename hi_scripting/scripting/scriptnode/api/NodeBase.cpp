@@ -1803,10 +1803,21 @@ RealNodeProfiler::RealNodeProfiler(NodeBase* n, int numSamples_) :
 {
 	if (enabled)
 		start = Time::getMillisecondCounterHiRes();
+
+	if (n->getProfileIndex() != -1)
+	{
+		profiler = n->getRootNetwork()->getActiveProfiler();
+
+		if (profiler != nullptr)
+			startTicks = Time::getHighResolutionTicks();
+	}
 }
 
 RealNodeProfiler::~RealNodeProfiler()
 {
+	if (profiler != nullptr)
+		profiler->record(node->getProfileIndex(), startTicks, Time::getHighResolutionTicks(), numSamples);
+
 	if (enabled)
 	{
 		auto delta = Time::getMillisecondCounterHiRes() - start;
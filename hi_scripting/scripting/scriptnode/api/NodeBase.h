@@ -39,6 +39,7 @@ using namespace juce;
 using namespace hise;
 
 class DspNetwork;
+class NetworkProfiler;
 struct NodeHolder;
 class NodeComponent;
 class HardcodedNode;
@@ -467,6 +468,11 @@ public:
     
 	double& getCpuFlag();
 
+	/** Returns the index of this node in the NetworkProfiler or -1 if it isn't profiled. */
+	int getProfileIndex() const noexcept { return profileIndex; }
+
+	void setProfileIndex(int newIndex) noexcept { profileIndex = newIndex; }
+
 	String getCpuUsageInPercent() const;
 
 	bool isClone() const;
@@ -522,6 +528,7 @@ private:
 	WeakReference<NodeBase::Holder> subHolder;
 	
 	double cpuUsage = 0.0;
+	int profileIndex = -1;
 
 	bool isCurrentlyMoved = false;
 
@@ -583,6 +590,9 @@ struct RealNodeProfiler
 	double& profileFlag;
 	double start;
 	const int numSamples;
+
+	NetworkProfiler* profiler = nullptr;
+	int64 startTicks = 0;
 };
 
 #if ENABLE_NODE_PROFILING
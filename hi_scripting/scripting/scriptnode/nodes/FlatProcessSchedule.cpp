@@ -0,0 +1,266 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licensed for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+namespace scriptnode
+{
+using namespace juce;
+using namespace hise;
+
+FlatProcessSchedule::FlatProcessSchedule(NodeBase* rootNode, PrepareSpecs ps):
+	specs(ps)
+{
+	jassert(specs.blockSize > 0 && specs.numChannels > 0);
+
+	addNode(rootNode, 0);
+	signalStack.allocate(maxDepth + 1, true);
+}
+
+int FlatProcessSchedule::addOp(OpType t, NodeBase* n, int scratchIndex)
+{
+	Op op;
+	op.type = t;
+	op.node = n;
+	op.scratchIndex = scratchIndex;
+
+	ops.add(op);
+	return ops.size() - 1;
+}
+
+void FlatProcessSchedule::addNode(NodeBase* n, int depth)
+{
+	maxDepth = jmax(maxDepth, depth);
+
+	if (auto chain = dynamic_cast<ChainNode*>(n))
+	{
+		numFlattenedContainers++;
+
+		auto skipIndex = addOp(OpType::SkipIfBypassed, n);
+
+		for (auto c : chain->getNodeList())
+			addNode(c.get(), depth);
+
+		ops.getReference(skipIndex).jumpIndex = ops.size();
+		return;
+	}
+
+	// The parallel split renders its branches on the worker pool, so it's processed as a single node
+	if (dynamic_cast<ParallelSplitNode*>(n) != nullptr)
+	{
+		addOp(OpType::Process, n);
+		return;
+	}
+
+	if (auto split = dynamic_cast<SplitNode*>(n))
+	{
+		numFlattenedContainers++;
+
+		auto sb = new ScratchBuffer();
+		DspHelpers::increaseBuffer(sb->original, specs, false);
+		DspHelpers::increaseBuffer(sb->work, specs, false);
+
+		auto scratchIndex = scratchBuffers.size();
+		scratchBuffers.add(sb);
+
+		auto beginIndex = addOp(OpType::SplitBegin, n, scratchIndex);
+
+		for (auto c : split->getNodeList())
+		{
+			auto branchIndex = addOp(OpType::SplitBranch, c.get(), scratchIndex);
+			addNode(c.get(), depth + 1);
+			addOp(OpType::SplitMerge, c.get(), scratchIndex);
+
+			ops.getReference(branchIndex).jumpIndex = ops.size();
+		}
+
+		ops.getReference(beginIndex).jumpIndex = ops.size();
+		return;
+	}
+
+	if (auto multi = dynamic_cast<MultiChannelNode*>(n))
+	{
+		numFlattenedContainers++;
+
+		addOp(OpType::MultiBegin, n);
+
+		for (auto c : multi->getNodeList())
+		{
+			auto branchIndex = addOp(OpType::ChannelBranch, c.get());
+			addNode(c.get(), depth + 1);
+			addOp(OpType::PopSignal, c.get());
+
+			ops.getReference(branchIndex).jumpIndex = ops.size();
+		}
+
+		return;
+	}
+
+	addOp(OpType::Process, n);
+}
+
+bool FlatProcessSchedule::process(ProcessDataDyn& data)
+{
+	const int numSamples = data.getNumSamples();
+
+	if (numSamples > specs.blockSize || data.getNumChannels() > specs.numChannels)
+		return false;
+
+	auto s = signalStack.get();
+
+	s->numChannels = data.getNumChannels();
+	memcpy(s->channels, data.getRawDataPointers(), sizeof(float*) * s->numChannels);
+
+	const int numOps = ops.size();
+	auto opData = ops.getRawDataPointer();
+
+	int i = 0;
+
+	while (i < numOps)
+	{
+		auto& op = opData[i++];
+
+		switch (op.type)
+		{
+		case OpType::Process:
+		{
+			ProcessDataDyn d(s->channels, numSamples, s->numChannels);
+			d.copyNonAudioDataFrom(data);
+			op.node->process(d);
+			break;
+		}
+		case OpType::SkipIfBypassed:
+		{
+			if (op.node->isBypassed())
+				i = op.jumpIndex;
+
+			break;
+		}
+		case OpType::SplitBegin:
+		{
+			if (op.node->isBypassed())
+			{
+				i = op.jumpIndex;
+				break;
+			}
+
+			auto optr = scratchBuffers.getUnchecked(op.scratchIndex)->original.begin();
+
+			for (int c = 0; c < s->numChannels; c++)
+				FloatVectorOperations::copy(optr + c * numSamples, s->channels[c], numSamples);
+
+			s->numProcessedBranches = 0;
+			break;
+		}
+		case OpType::SplitBranch:
+		{
+			if (op.node->isBypassed())
+			{
+				i = op.jumpIndex;
+				break;
+			}
+
+			auto parent = s++;
+
+			s->numChannels = parent->numChannels;
+			s->isScratch = parent->numProcessedBranches++ != 0;
+
+			if (s->isScratch)
+			{
+				// All branches except for the first one process a copy of the input
+				auto sb = scratchBuffers.getUnchecked(op.scratchIndex);
+				auto wptr = sb->work.begin();
+
+				FloatVectorOperations::copy(wptr, sb->original.begin(), numSamples * s->numChannels);
+
+				for (int c = 0; c < s->numChannels; c++)
+					s->channels[c] = wptr + c * numSamples;
+			}
+			else
+			{
+				memcpy(s->channels, parent->channels, sizeof(float*) * s->numChannels);
+			}
+
+			break;
+		}
+		case OpType::SplitMerge:
+		{
+			auto branch = s--;
+
+			if (branch->isScratch)
+			{
+				for (int c = 0; c < s->numChannels; c++)
+					FloatVectorOperations::add(s->channels[c], branch->channels[c], numSamples);
+			}
+
+			break;
+		}
+		case OpType::MultiBegin:
+		{
+			s->channelOffset = 0;
+			break;
+		}
+		case OpType::ChannelBranch:
+		{
+			const int numChannelsThisTime = op.node->getCurrentChannelAmount();
+			const int startChannel = s->channelOffset;
+
+			s->channelOffset += numChannelsThisTime;
+
+			if (startChannel + numChannelsThisTime > s->numChannels)
+			{
+				i = op.jumpIndex;
+				break;
+			}
+
+			auto parent = s++;
+
+			s->numChannels = numChannelsThisTime;
+			s->isScratch = false;
+			memcpy(s->channels, parent->channels + startChannel, sizeof(float*) * numChannelsThisTime);
+			break;
+		}
+		case OpType::PopSignal:
+		{
+			s--;
+			break;
+		}
+		default:
+			jassertfalse;
+			break;
+		}
+	}
+
+	jassert(s == signalStack.get());
+	return true;
+}
+
+}
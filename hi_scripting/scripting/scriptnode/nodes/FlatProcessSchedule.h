@@ -0,0 +1,112 @@
+/*  ===========================================================================
+ *
+ *   This file is part of HISE.
+ *   Copyright 2016 Christoph Hart
+ *
+ *   HISE is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   HISE is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with HISE.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Commercial licenses for using HISE in an closed source project are
+ *   available on request. Please visit the project's website to get more
+ *   information about commercial licensing:
+ *
+ *   http://www.hise.audio/
+ *
+ *   HISE is based on the JUCE library,
+ *   which also must be licensed for commercial applications:
+ *
+ *   http://www.juce.com
+ *
+ *   ===========================================================================
+ */
+
+
+#pragma once
+
+namespace scriptnode
+{
+using namespace juce;
+using namespace hise;
+
+/** A flat list of operations that replaces the recursive process calls of the serial, split and
+	multichannel containers of a network.
+
+	The schedule is built on the message thread whenever the topology of the network changes. 
+	Every node that isn't one of those containers (including containers with frame processing, 
+	oversampling, etc.) will be called like a regular node, so their behaviour doesn't change.
+*/
+struct FlatProcessSchedule
+{
+	enum class OpType
+	{
+		Process,		// calls process() on a node that wasn't flattened
+		SkipIfBypassed,	// jumps over the operations of a bypassed container
+		SplitBegin,		// copies the input of a split container into its scratch buffer
+		SplitBranch,	// pushes the signal for the next split branch or jumps over it
+		SplitMerge,		// pops the signal of a split branch and adds it to the output
+		MultiBegin,		// resets the channel offset of a multichannel container
+		ChannelBranch,	// pushes the channel range for the next multichannel child
+		PopSignal,		// pops the signal of a multichannel child
+		numOpTypes
+	};
+
+	struct Op
+	{
+		OpType type;
+		ReferenceCountedObjectPtr<NodeBase> node;
+		int jumpIndex = -1;
+		int scratchIndex = -1;
+	};
+
+	FlatProcessSchedule(NodeBase* rootNode, PrepareSpecs ps);
+
+	/** Processes the network. Returns false if the data doesn't fit into the prepared buffers. */
+	bool process(ProcessDataDyn& data);
+
+	int getNumOps() const { return ops.size(); }
+
+	int getNumFlattenedContainers() const { return numFlattenedContainers; }
+
+private:
+
+	struct Signal
+	{
+		float* channels[NUM_MAX_CHANNELS];
+		int numChannels = 0;
+		int channelOffset = 0;
+		int numProcessedBranches = 0;
+		bool isScratch = false;
+	};
+
+	struct ScratchBuffer
+	{
+		heap<float> original;
+		heap<float> work;
+	};
+
+	void addNode(NodeBase* n, int depth);
+
+	int addOp(OpType t, NodeBase* n, int scratchIndex = -1);
+
+	Array<Op> ops;
+	OwnedArray<ScratchBuffer> scratchBuffers;
+	HeapBlock<Signal> signalStack;
+
+	PrepareSpecs specs;
+	int maxDepth = 0;
+	int numFlattenedContainers = 0;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FlatProcessSchedule);
+};
+
+}
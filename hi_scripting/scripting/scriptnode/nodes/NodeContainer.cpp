@@ -725,6 +725,7 @@ NodeContainerFactory::NodeContainerFactory(DspNetwork* parent) :
 {
 	registerNodeRaw<ChainNode>();
 	registerNodeRaw<SplitNode>();
+	registerNodeRaw<ParallelSplitNode>();
 	registerNodeRaw<MultiChannelNode>();
 	registerNodeRaw<ModulationChainNode>();
 	registerNodeRaw<MidiChainNode>();
@@ -200,6 +200,126 @@ void SplitNode::reset()
 	resetNodes();
 }
 
+ParallelSplitNode::ParallelSplitNode(DspNetwork* root, ValueTree data) :
+	SplitNode(root, data)
+{
+	pool = root->getScriptProcessor()->getMainController_()->getRealtimeWorkerPool();
+}
+
+void ParallelSplitNode::prepare(PrepareSpecs ps)
+{
+	SplitNode::prepare(ps);
+
+	numPreparedBranches = 0;
+	numPreparedSamples = 0;
+
+	if (pool != nullptr && ps.blockSize > 1)
+	{
+		auto numElements = nodes.size() * ps.numChannels * ps.blockSize;
+
+		if (numElements > branchBuffers.size())
+			branchBuffers.setSize(numElements);
+
+		if (nodes.size() > branchIndexes.size())
+			branchIndexes.setSize(nodes.size());
+
+		numPreparedBranches = nodes.size();
+		numPreparedSamples = ps.blockSize;
+	}
+}
+
+void ParallelSplitNode::process(ProcessDataDyn& data)
+{
+	if (isBypassed())
+		return;
+
+	const int numSamples = data.getNumSamples();
+	const int numChannels = data.getNumChannels();
+
+	// The hand-off to the workers costs a few microseconds, so small blocks are
+	// processed serially
+	auto useSerialProcessing = pool == nullptr ||
+		numSamples < HISE_SCRIPTNODE_PARALLEL_MIN_SAMPLES ||
+		numSamples > numPreparedSamples ||
+		nodes.size() > numPreparedBranches;
+
+	int numActive = 0;
+
+	if (!useSerialProcessing)
+	{
+		for (int i = 0; i < nodes.size(); i++)
+		{
+			if (!nodes[i]->isBypassed())
+				branchIndexes[numActive++] = i;
+		}
+	}
+
+	if (numActive < 2)
+	{
+		SplitNode::process(data);
+		return;
+	}
+
+	NodeProfiler np(this, numSamples);
+	ProcessDataPeakChecker pd(this, data);
+	TRACE_DSP();
+
+	const int branchSize = numChannels * numSamples;
+
+	auto getBranchChannel = [&](int branchIndex, int channelIndex)
+	{
+		return branchBuffers.begin() + branchIndex * branchSize + channelIndex * numSamples;
+	};
+
+	// The first branch processes the data in place, so the other branches
+	// need a copy of the input before anything is processed
+	for (int i = 1; i < numActive; i++)
+	{
+		int channelIndex = 0;
+
+		for (auto& c : data)
+		{
+			FloatVectorOperations::copy(getBranchChannel(branchIndexes[i], channelIndex), c.getRawReadPointer(), numSamples);
+			channelIndex++;
+		}
+	}
+
+	auto renderBranch = [&](int taskIndex)
+	{
+		auto nodeIndex = branchIndexes[taskIndex];
+
+		if (taskIndex == 0)
+		{
+			nodes[nodeIndex]->process(data);
+			return;
+		}
+
+		float* ptrs[NUM_MAX_CHANNELS];
+
+		for (int c = 0; c < numChannels; c++)
+			ptrs[c] = getBranchChannel(nodeIndex, c);
+
+		ProcessDataDyn cp(ptrs, numSamples, numChannels);
+		cp.copyNonAudioDataFrom(data);
+		nodes[nodeIndex]->process(cp);
+	};
+
+	pool->parallelFor(numActive, renderBranch);
+
+	// Sum up the branches in the order of the child nodes
+	// so that the result is identical to the serial processing
+	for (int i = 1; i < numActive; i++)
+	{
+		int channelIndex = 0;
+
+		for (auto& c : data)
+		{
+			FloatVectorOperations::add(c.getRawWritePointer(), getBranchChannel(branchIndexes[i], channelIndex), numSamples);
+			channelIndex++;
+		}
+	}
+}
+
 ModulationChainNode::ModulationChainNode(DspNetwork* n, ValueTree t) :
 	SerialNode(n, t)
 {
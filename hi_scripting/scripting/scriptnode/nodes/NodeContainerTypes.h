@@ -770,7 +770,7 @@ public:
 	void prepare(PrepareSpecs ps) override;
 	void reset() final override;
 	void handleHiseEvent(HiseEvent& e) final override;
-	void process(ProcessDataDyn& data) final override;
+	void process(ProcessDataDyn& data) override;
 
 	void processFrame(FrameType& data) final override
 	{
@@ -823,6 +823,37 @@ public:
 	
 };
 
+/** A split container that distributes its branches across the RealtimeWorkerPool.
+
+	Every branch except the first one gets its own preallocated buffer, so the branches can
+	be rendered at the same time. The results are added in the order of the child nodes, so the
+	output is identical to the split container. If there is no worker pool, the block is smaller
+	than HISE_SCRIPTNODE_PARALLEL_MIN_SAMPLES or the pool is already busy, the branches are 
+	processed serially. Frame processing is always serial.
+*/
+class ParallelSplitNode : public SplitNode
+{
+public:
+
+	ParallelSplitNode(DspNetwork* root, ValueTree data);
+
+	SCRIPTNODE_FACTORY(ParallelSplitNode, "parallel_split");
+
+	String getNodeDescription() const override { return "Processes each node on a separate audio thread and sums up the output."; }
+
+	void prepare(PrepareSpecs ps) override;
+	void process(ProcessDataDyn& data) final override;
+
+private:
+
+	RealtimeWorkerPool* pool = nullptr;
+
+	heap<float> branchBuffers;
+	heap<int> branchIndexes;
+	int numPreparedBranches = 0;
+	int numPreparedSamples = 0;
+};
+
 
 class MultiChannelNode : public ParallelNode
 {
@@ -157,7 +157,8 @@ struct snex_node : public SnexSource
 				ok = r.wasOk();
 			}
 
-			prepare(lastSpecs);
+			if (!parent.isSwappingOptimisedCode())
+				prepare(lastSpecs);
 
 			return Result::ok();
 		}
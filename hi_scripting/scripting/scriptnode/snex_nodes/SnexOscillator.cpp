@@ -80,7 +80,8 @@ juce::Result core::SnexOscillator::OscillatorCallbacks::recompiledOk(snex::jit::
 		std::swap(newPrepareFunction, prepareFunction);
 	}
 
-	prepare(lastSpecs);
+	if (!parent.isSwappingOptimisedCode())
+		prepare(lastSpecs);
 
 	return r;
 }
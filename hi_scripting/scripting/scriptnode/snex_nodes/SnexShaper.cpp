@@ -204,7 +204,8 @@ namespace waveshapers
 			std::swap(resetFunc, newResetFunc);
 		}
 
-		prepare(lastSpecs);
+		if (!parent.isSwappingOptimisedCode())
+			prepare(lastSpecs);
 
 		return r;
 	}
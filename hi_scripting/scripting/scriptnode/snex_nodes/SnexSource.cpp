@@ -110,6 +110,30 @@ void SnexSource::recompiled(WorkbenchData::Ptr wb)
 	}
 }
 
+void SnexSource::codeOptimised(WorkbenchData::Ptr wb)
+{
+	if (!lastResult.wasOk())
+		return;
+
+	if (auto objPtr = wb->getLastResult().mainClassPtr)
+	{
+		// The optimised code uses the same object, so we just fetch
+		// the new functions without initialising the object storage
+		ScopedValueSetter<bool> svs(swappingOptimisedCode, true);
+
+		auto r = getCallbackHandler().recompiledOk(objPtr);
+
+		if (r.wasOk())
+			r = getParameterHandler().recompiledOk(objPtr);
+
+		if (r.wasOk())
+			r = getComplexDataHandler().recompiledOk(objPtr);
+
+		jassert(r.wasOk());
+		lastCompiledObject = wb->getLastJitObject();
+	}
+}
+
 void SnexSource::throwScriptnodeErrorIfCompileFail()
 {
 	if (auto wb = getWorkbench())
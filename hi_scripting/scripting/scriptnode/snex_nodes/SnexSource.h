@@ -600,6 +600,13 @@ public:
     
 	void recompiled(WorkbenchData::Ptr wb) final override;
 
+	/** Swaps the function pointers to the optimised code of the tiered compilation. */
+	void codeOptimised(WorkbenchData::Ptr wb) final override;
+
+	/** Returns true while the handlers swap to the optimised code. Skip anything
+	    that resets the state of the object in the recompiledOk() callback then. */
+	bool isSwappingOptimisedCode() const { return swappingOptimisedCode; }
+
 	void throwScriptnodeErrorIfCompileFail();
 
 	void logMessage(WorkbenchData::Ptr wb, int level, const String& s) override;
@@ -834,6 +841,7 @@ private:
 
 	valuetree::ParentListener compileChecker;
 	bool processingEnabled = true;
+	bool swappingOptimisedCode = false;
 
 	ParameterHandler parameterHandler;
 	ComplexDataHandler dataHandler;
@@ -180,8 +180,11 @@ struct snex_timer : public OptionalSnexSource
 				ok = r.wasOk();
 			}
 
-			prepare(lastSpecs);
-			resetTimer();
+			if (!parent.isSwappingOptimisedCode())
+			{
+				prepare(lastSpecs);
+				resetTimer();
+			}
 
 			return r;
 		}
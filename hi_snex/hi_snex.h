@@ -105,6 +105,36 @@ Set to 0 to disable SNEX compilation (default on iOS).
 #define SNEX_MIR_BACKEND 1
 #endif
 
+/** Config: SNEX_MIR_TIERED_COMPILATION
+
+If enabled, the SNEX nodes in scriptnode are compiled with the fast baseline code generator of MIR
+first and then compiled again with full optimisation on a background thread. The optimised code 
+replaces the baseline code once it's ready.
+*/
+#ifndef SNEX_MIR_TIERED_COMPILATION
+#define SNEX_MIR_TIERED_COMPILATION 1
+#endif
+
+/** Config: SNEX_MIR_VECTORISE_LOOPS
+
+If enabled, the MIR backend replaces range-based loops over float spans and blocks that perform a 
+single elementwise operation (add, multiply, multiply-add, min, max, abs, clip) with a call to a
+precompiled SIMD kernel instead of emitting a scalar loop.
+*/
+#ifndef SNEX_MIR_VECTORISE_LOOPS
+#define SNEX_MIR_VECTORISE_LOOPS 1
+#endif
+
+/** Config: SNEX_MIR_VECTORISE_MIN_SPAN_SIZE
+
+The minimum number of elements of a span loop that is replaced with a vector kernel. Smaller spans
+are emitted as scalar loop, because the kernel call would be slower than the loop itself. Loops
+over blocks are always vectorised.
+*/
+#ifndef SNEX_MIR_VECTORISE_MIN_SPAN_SIZE
+#define SNEX_MIR_VECTORISE_MIN_SPAN_SIZE 16
+#endif
+
 /** The SNEX compiler is only available on x64 builds so this preprocessor will allow compiling HISE on ARM withouth the JIT compiler. */
 #ifndef HISE_INCLUDE_SNEX_X64_CODEGEN
 #if JUCE_ARM
@@ -190,9 +190,17 @@ void ui::WorkbenchData::callAsyncWithSafeCheck(const std::function<void(Workbenc
 }
 
 bool ui::WorkbenchData::handleCompilation()
+{
+	if (compileWithoutNotification())
+		handlePostCompilation();
+
+	return true;
+}
+
+bool ui::WorkbenchData::compileWithoutNotification()
 {
 	if (getGlobalScope().getBreakpointHandler().shouldAbort())
-		return true;
+		return false;
 
 	if (compileHandler != nullptr)
 	{
@@ -208,25 +216,67 @@ bool ui::WorkbenchData::handleCompilation()
 		}
 
 		if (getGlobalScope().getBreakpointHandler().shouldAbort())
-			return true;
+			return false;
 
 		lastCompileResult = compileHandler->compile(s);
 
-		callAsyncWithSafeCheck([](WorkbenchData* d) { d->postCompile(); });
+#if SNEX_MIR_BACKEND
+		if (mir::MirCompiler::CodeCache::getDirectory() != File())
+			logMessage(BaseCompiler::PassMessage, mir::MirCompiler::CodeCache::getStatistics().toString());
+#endif
 
-		// Might get deleted in the meantime...
-		if (compileHandler != nullptr)
-		{
-            compileHandler->postCompile(lastCompileResult);
-            
-			callAsyncWithSafeCheck([](WorkbenchData* d) { d->postPostCompile(); });
-		}
+		return true;
 	}
 
-	return true;
+	return false;
 }
 
+void ui::WorkbenchData::handlePostCompilation()
+{
+	callAsyncWithSafeCheck([](WorkbenchData* d) { d->postCompile(); });
 
+	// Might get deleted in the meantime...
+	if (compileHandler != nullptr)
+	{
+        compileHandler->postCompile(lastCompileResult);
+            
+		callAsyncWithSafeCheck([](WorkbenchData* d) { d->postPostCompile(); });
+	}
+}
+
+bool ui::WorkbenchData::optimiseLastResult()
+{
+	auto baseline = lastCompileResult.obj;
+
+	if (!lastCompileResult.compiledOk() || !baseline.isBaseline())
+		return false;
+
+	auto r = Result::ok();
+	auto optimised = baseline.createOptimisedObject(r);
+
+	// The code generation can't be interrupted, so we just drop the result if
+	// the thread was cancelled in the meantime
+	if (Thread::currentThreadShouldExit())
+		return false;
+
+	if (!r.wasOk())
+	{
+		logMessage(BaseCompiler::Warning, "Optimisation failed: " + r.getErrorMessage());
+		return false;
+	}
+
+	callAsyncWithSafeCheck([baseline, optimised](WorkbenchData* d)
+	{
+		// The code might have been recompiled in the meantime...
+		if (d->lastCompileResult.obj == baseline)
+		{
+			d->lastCompileResult.obj = optimised;
+			d->codeOptimised();
+		}
+	}, true);
+
+	return true;
+}
 
 snex::ui::WorkbenchData::Ptr ui::WorkbenchManager::getWorkbenchDataForCodeProvider(WorkbenchData::CodeProvider* p, bool ownCodeProvider)
 {
@@ -319,7 +369,7 @@ juce::Identifier ui::ValueTreeCodeProvider::getInstanceId() const
 
 void ui::ValueTreeCodeProvider::rebuild() const
 {
-	snex::cppgen::ValueTreeBuilder vb(lastTree, cppgen::ValueTreeBuilder::Format::JitCompiledInstance);
+	snex::cppgen::ValueTreeBuilder vb(lastTree, cppgen::ValueTreeBuilder::Format::CppDynamicLibrary);
 	lastResult = vb.createCppCode();
 }
 
@@ -185,6 +185,10 @@ public:
 		    you rely on a test execution, use this callback instead. */
 		virtual void postPostCompile(WorkbenchData::Ptr wb) {};
 
+		/** This is called on the message thread when the baseline code of the
+		    tiered compilation was replaced with the optimised code. */
+		virtual void codeOptimised(WorkbenchData::Ptr wb) {};
+
 		virtual void drawBreakpoints(Graphics& g) {};
 
 		virtual void debugModeChanged(bool isEnabled) {};
@@ -1105,6 +1109,15 @@ public:
 		}
 	}
 
+	void codeOptimised()
+	{
+		for (auto l : listeners)
+		{
+			if (l != nullptr)
+				l->codeOptimised(this);
+		}
+	}
+
     
     
 	void callAsyncWithSafeCheck(const std::function<void(WorkbenchData* d)>& f, bool callSyncIfMessageThread=false);
@@ -1130,6 +1143,21 @@ public:
 
 	bool handleCompilation();
 
+	/** Compiles the code without notifying the compile handler and the listeners. This can
+	    be called on a worker thread, then call handlePostCompilation() on the thread that
+		started the compilation. Returns false if the compilation was aborted. */
+	bool compileWithoutNotification();
+
+	/** Notifies the compile handler and the listeners about the last compilation. */
+	void handlePostCompilation();
+
+	/** Compiles the last result again with full optimisation if it was compiled 
+	    with the tiered compilation. Call this on a background thread after the 
+		compilation, the listeners will be notified on the message thread. If the
+		thread was signalled to exit during the optimisation, the result is dropped.
+	*/
+	bool optimiseLastResult();
+
 	void setUseFileAsContentSource(const File& f)
 	{
 		codeProvider = new DefaultCodeProvider(this, f);
@@ -36,7 +36,7 @@ namespace jit {
 using namespace juce;
 USE_ASMJIT_NAMESPACE;
 
-int ComplexType::numInstances = 0;
+std::atomic<int> ComplexType::numInstances = { 0 };
 
 Result ComplexType::callConstructor(InitData& d)
 {
@@ -143,7 +143,7 @@ using Data64 = ConstDataBase<64>;
 
 struct ComplexType : public ReferenceCountedObject
 {
-	static int numInstances;
+	static std::atomic<int> numInstances;
 
 	struct InitData
 	{
@@ -176,6 +176,22 @@ JitObject::operator bool() const
 	return functionClass != nullptr;
 }
 
+bool JitObject::isBaseline() const
+{
+	return functionClass != nullptr && functionClass->isBaseline();
+}
+
+JitObject JitObject::createOptimisedObject(Result& r) const
+{
+	if (!isBaseline())
+	{
+		r = Result::fail("Not a baseline object");
+		return {};
+	}
+
+	return JitObject(functionClass->createOptimisedCollection(r).get());
+}
+
 bool JitObject::initMainObject(ObjectStorage<16, 16>& obj)
 {
 	if (functionClass != nullptr)
@@ -118,6 +118,19 @@ public:
 
 	explicit operator bool() const;;
 
+	bool operator==(const JitObject& other) const { return functionClass == other.functionClass; }
+
+	/** Returns true if this object was compiled by the baseline tier of the tiered compilation. */
+	bool isBaseline() const;
+
+	/** Compiles the code of a baseline object again with full optimisation. 
+
+		The returned object shares the data with this object and keeps it alive, so you can replace 
+		the function pointers while the code is running. This might take a while so call it on a 
+		background thread.
+	*/
+	JitObject createOptimisedObject(Result& r) const;
+
 	void* getMainObjectPtr()
 	{
 		return functionClass != nullptr ? functionClass->getMainObjectPtr() : nullptr;
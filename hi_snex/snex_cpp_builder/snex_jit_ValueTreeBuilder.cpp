@@ -1972,6 +1972,11 @@ snex::NamespacedIdentifier ValueTreeIterator::getNodeFactoryPath(const ValueTree
 		auto isClone = fId.id.toString() == "clone";
 		auto isBranch = fId.id.toString() == "branch";
 
+		// The compiled containers have no access to the worker pool,
+		// so the parallel split will be processed serially
+		if (fId.id.toString() == "parallel_split")
+			return NamespacedIdentifier::fromString("container::split");
+
 		if (!isSplit && !isMulti && !isClone && !isBranch)
 		{
 			return NamespacedIdentifier::fromString("container::chain");
@@ -555,7 +555,7 @@ struct ValueTreeBuilder: public Base
 	ValueTreeBuilder(const ValueTree& data, Format outputFormatToUse) :
 		Base(Base::OutputType::AddTabs),
 		v(data),
-		outputFormat(Format::CppDynamicLibrary),
+		outputFormat(outputFormatToUse),
 		r(Result::ok()),
 		rootChannelAmount(getRootChannelAmount(v)),
 		numChannelsToCompile(rootChannelAmount),
@@ -40,7 +40,7 @@ USE_ASMJIT_NAMESPACE;
 #if SNEX_ASMJIT_BACKEND
 
 // Just for debugging purposes...
-static int reg_counter = 0;
+static std::atomic<int> reg_counter = { 0 };
 
 AssemblyRegister::AssemblyRegister(BaseCompiler* compiler_, TypeInfo type_) :
 	type(type_),
@@ -300,12 +300,21 @@ MathFunctions::MathFunctions(bool addInlinedFunctions, ComplexType::Ptr blockTyp
 	HNODE_JIT_ADD_C_FUNCTION_3(double, hmath::map, double, double, double, "map");
 	setDescription("maps the normalised input to the output range", { "input" , "lowerlimit", "upperlimit" });
 
+	using UnaryFunc = void*(*)(void*);
 	using ScalarFunc = void*(*)(void*, float);
+	using ScalarFunc2 = void*(*)(void*, float, float);
 	using VectorFunc = void*(*)(void*, void*);
 
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vmuls, void*, float, "vmuls");
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vadds, void*, float, "vadds");
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vmovs, void*, float, "vmovs");
+	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vmins, void*, float, "vmins");
+	HNODE_JIT_ADD_C_FUNCTION_2(void*, (ScalarFunc)hmath::vmaxs, void*, float, "vmaxs");
+
+	// These kernels are used by the MIR backend to lower vectorisable loops
+	HNODE_JIT_ADD_C_FUNCTION_1(void*, (UnaryFunc)hmath::vabs, void*, "vabs");
+	HNODE_JIT_ADD_C_FUNCTION_3(void*, (ScalarFunc2)hmath::vclip, void*, float, float, "vclip");
+	HNODE_JIT_ADD_C_FUNCTION_3(void*, (ScalarFunc2)hmath::vmadds, void*, float, float, "vmadds");
 
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (VectorFunc)hmath::vmul, void*, void*, "vmul");
 	HNODE_JIT_ADD_C_FUNCTION_2(void*, (VectorFunc)hmath::vadd, void*, void*, "vadd");
@@ -41,6 +41,262 @@ namespace InstructionIds
 	DEFINE_ID(VectorOp);
 }
 
+#if SNEX_MIR_VECTORISE_LOOPS
+
+/** Checks whether a range-based loop over a float span or block contains a single 
+	elementwise operation that can be replaced with a call to one of the precompiled 
+	vector kernels of the Math class (vmuls, vadds, vmadds, ...).
+	
+	The loop body must be a single assignment to the iterator and all other operands 
+	must be loop invariant float values (immediates or non-reference variables). 
+	Spans with less than SNEX_MIR_VECTORISE_MIN_SPAN_SIZE elements and everything 
+	else are emitted as scalar loop.
+*/
+struct VectorKernelMatcher
+{
+	VectorKernelMatcher(const ValueTree& loop_):
+		loop(loop_)
+	{
+		auto loopType = loop[InstructionPropertyIds::LoopType].toString();
+
+		if (loopType != "Span" && loopType != "Dyn")
+			return;
+
+		if (loopType == "Span" && loop[InstructionPropertyIds::NumElements].toString().getIntValue() < SNEX_MIR_VECTORISE_MIN_SPAN_SIZE)
+			return;
+
+		auto it = TypeConverters::String2Symbol(loop[InstructionPropertyIds::Iterator].toString());
+
+		if (!it.typeInfo.isRef() || it.typeInfo.getType() != Types::ID::Float)
+			return;
+
+		iteratorId = it.id;
+
+		auto body = loop.getChild(1);
+
+		if (body.getType() != InstructionIds::StatementBlock || body.getNumChildren() != 1)
+			return;
+
+		auto a = body.getChild(0);
+
+		if (a.getType() != InstructionIds::Assignment || 
+			a[InstructionPropertyIds::First].toString() == "1" ||
+			!isIterator(a.getChild(1)))
+			return;
+
+		auto opType = a[InstructionPropertyIds::AssignmentType].toString();
+		auto source = a.getChild(0);
+
+		if (opType == JitTokens::timesEquals && isScalar(source))
+			setKernel("vmuls", { source });
+		else if (opType == JitTokens::plusEquals && isScalar(source))
+			setKernel("vadds", { source });
+		else if (opType == JitTokens::assign_)
+			matchExpression(source);
+	}
+
+	bool matches() const { return signature.isNotEmpty(); }
+
+	String getSignature() const { return signature; }
+
+	/** Emits the kernel call instead of the loop. */
+	Result emit(State* state_) const
+	{
+		auto& state = *state_;
+		MirCodeGenerator cc(state_);
+
+		state.processChildTree(0);
+
+		String blockData;
+
+		if (loop[InstructionPropertyIds::LoopType].toString() == "Span")
+		{
+			auto data = state.registerManager.getOperandForChild(0, RegisterType::Pointer);
+
+			blockData = cc.alloca(16);
+			cc.mov(cc.deref<void*>(blockData, 8), data);
+			cc.mov(cc.deref<int>(blockData, 4), loop[InstructionPropertyIds::NumElements].toString());
+		}
+		else
+		{
+			// the dyn object has the same layout as the block argument of the kernels
+			blockData = state.registerManager.loadIntoRegister(0, RegisterType::Pointer);
+		}
+
+		StringArray args;
+		args.add(blockData);
+
+		for (const auto& s : scalarOperands)
+		{
+			auto parent = s.getParent();
+			auto index = parent.indexOf(s);
+
+			ScopedValueSetter<ValueTree> svs(state.currentTree, parent);
+			state.processChildTree(index);
+			args.add(state.registerManager.loadIntoRegister(index, RegisterType::Value));
+		}
+
+		cc.setInlineComment("vectorised loop");
+		cc.call<void*>({}, signature, args);
+
+		return Result::ok();
+	}
+
+private:
+
+	void setKernel(const String& name, const Array<ValueTree>& operands)
+	{
+		signature << "pointer& Math::" << name << "(pointer& Param0";
+
+		for (int i = 0; i < operands.size(); i++)
+			signature << ", float Param" << String(i + 1);
+
+		signature << ")";
+		scalarOperands = operands;
+	}
+
+	void matchExpression(const ValueTree& v)
+	{
+		if (isScalar(v))
+			setKernel("vmovs", { v });
+		else if (isMathCall(v, "abs", 1) && isIterator(v.getChild(0)))
+			setKernel("vabs", {});
+		else if (isMathCall(v, "range", 3) && isIterator(v.getChild(0)) && isScalar(v.getChild(1)) && isScalar(v.getChild(2)))
+			setKernel("vclip", { v.getChild(1), v.getChild(2) });
+		else if (isMathCall(v, "min", 2) || isMathCall(v, "max", 2))
+		{
+			auto s = getScalarOperandWithIterator(v);
+
+			if (s.isValid())
+				setKernel(isMathCall(v, "min", 2) ? "vmins" : "vmaxs", { s });
+		}
+		else if (isBinaryOp(v, JitTokens::times) || isBinaryOp(v, JitTokens::plus))
+		{
+			auto s = getScalarOperandWithIterator(v);
+
+			if (s.isValid())
+			{
+				setKernel(isBinaryOp(v, JitTokens::times) ? "vmuls" : "vadds", { s });
+				return;
+			}
+
+			if (!isBinaryOp(v, JitTokens::plus))
+				return;
+
+			// it * a + b, a * it + b, b + it * a, b + a * it
+			for (int i = 0; i < 2; i++)
+			{
+				auto product = v.getChild(i);
+				auto offset = v.getChild(1 - i);
+
+				if (isBinaryOp(product, JitTokens::times) && isScalar(offset))
+				{
+					auto factor = getScalarOperandWithIterator(product);
+
+					if (factor.isValid())
+					{
+						setKernel("vmadds", { factor, offset });
+						return;
+					}
+				}
+			}
+		}
+	}
+
+	/** Returns the other operand if one of the two operands is the iterator. */
+	ValueTree getScalarOperandWithIterator(const ValueTree& v) const
+	{
+		if (v.getNumChildren() != 2)
+			return {};
+
+		if (isIterator(v.getChild(0)) && isScalar(v.getChild(1)))
+			return v.getChild(1);
+
+		if (isIterator(v.getChild(1)) && isScalar(v.getChild(0)))
+			return v.getChild(0);
+
+		return {};
+	}
+
+	bool isIterator(const ValueTree& v) const
+	{
+		return v.getType() == InstructionIds::VariableReference &&
+			   TypeConverters::String2Symbol(v[InstructionPropertyIds::Symbol].toString()).id == iteratorId;
+	}
+
+	bool isBinaryOp(const ValueTree& v, const char* op) const
+	{
+		return v.getType() == InstructionIds::BinaryOp && v[InstructionPropertyIds::OpType].toString() == op;
+	}
+
+	bool isMathCall(const ValueTree& v, const String& name, int numArgs) const
+	{
+		if (v.getType() != InstructionIds::FunctionCall || v.getNumChildren() != numArgs)
+			return false;
+
+		auto f = TypeConverters::String2FunctionData(v[InstructionPropertyIds::Signature].toString());
+
+		return f.id.toString() == "Math::" + name && 
+			   f.returnType.getType() == Types::ID::Float;
+	}
+
+	/** Checks if the expression is a float value that doesn't change within the loop. */
+	bool isScalar(const ValueTree& v) const
+	{
+		return isLoopInvariant(v) && getType(v) == Types::ID::Float;
+	}
+
+	bool isLoopInvariant(const ValueTree& v) const
+	{
+		if (v.getType() == InstructionIds::Immediate)
+			return true;
+
+		if (v.getType() == InstructionIds::VariableReference)
+		{
+			// a reference might point into the data we're processing
+			auto s = TypeConverters::String2Symbol(v[InstructionPropertyIds::Symbol].toString());
+			return !s.typeInfo.isRef() && s.id != iteratorId;
+		}
+
+		if (v.getType() == InstructionIds::Cast || v.getType() == InstructionIds::BinaryOp)
+		{
+			for (auto c : v)
+			{
+				if (!isLoopInvariant(c))
+					return false;
+			}
+
+			return true;
+		}
+
+		return false;
+	}
+
+	Types::ID getType(const ValueTree& v) const
+	{
+		if (v.getType() == InstructionIds::Immediate)
+			return Types::Helpers::getTypeFromStringValue(v[InstructionPropertyIds::Value].toString());
+
+		if (v.getType() == InstructionIds::VariableReference)
+			return TypeConverters::String2Symbol(v[InstructionPropertyIds::Symbol].toString()).typeInfo.getType();
+
+		if (v.getType() == InstructionIds::Cast)
+			return Types::Helpers::getTypeFromTypeName(v[InstructionPropertyIds::Target].toString());
+
+		if (v.getType() == InstructionIds::BinaryOp)
+			return getType(v.getChild(0));
+
+		return Types::ID::Void;
+	}
+
+	ValueTree loop;
+	NamespacedIdentifier iteratorId;
+	String signature;
+	Array<ValueTree> scalarOperands;
+};
+
+#endif
+
 
 
 struct InstructionParsers
@@ -76,6 +332,15 @@ struct InstructionParsers
 
 					staticSignatures.addIfNotAlreadyThere({ NamespacedIdentifier(), sig });
 				}
+#if SNEX_MIR_VECTORISE_LOOPS
+				if (v.getType() == InstructionIds::Loop)
+				{
+					VectorKernelMatcher kernel(v);
+
+					if (kernel.matches())
+						staticSignatures.addIfNotAlreadyThere({ NamespacedIdentifier(), kernel.getSignature() });
+				}
+#endif
 				if (v.getType() == InstructionIds::FunctionCall)
 				{
 					auto sig = v[InstructionPropertyIds::Signature].toString();
@@ -1006,11 +1271,16 @@ struct InstructionParsers
 
 	static Result Loop(State* state_)
 	{
-		
-
 		auto& state = *state_;
 		auto& rm = state.registerManager;
 
+#if SNEX_MIR_VECTORISE_LOOPS
+		VectorKernelMatcher kernel(state.currentTree);
+
+		if (kernel.matches())
+			return kernel.emit(state_);
+#endif
+
 		MirCodeGenerator cc(state_);
 		
 
@@ -150,6 +150,16 @@ struct MirFunctionCollection : public jit::FunctionCollectionBase
 		return {};
 	}
 
+	bool isBaseline() const override
+	{
+		return optimizationLevel < MirCompiler::FullOptimization && mirCode.isNotEmpty();
+	}
+
+	Ptr createOptimisedCollection(Result& r) override
+	{
+		return MirCompiler::createOptimisedCollection(this, r);
+	}
+
 	ValueTree fillLayoutWithData(const String& dataId, const ValueTree& valueData) const;
 
 	void fillRecursive(ValueTree& copy, const String& dataId, size_t offset) const;
@@ -167,6 +177,16 @@ struct MirFunctionCollection : public jit::FunctionCollectionBase
 
 	ValueTree globalData;
 
+	// The MIR code and the library functions are stored so that 
+	// the code can be compiled again with full optimisation
+	String mirCode;
+	int optimizationLevel = MirCompiler::FullOptimization;
+	Array<StaticFunctionPointer> libraryFunctions;
+	FunctionClass::Ptr console;
+
+	// The collection that owns the data if this collection was optimised
+	FunctionCollectionBase::Ptr baseline;
+
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(MirFunctionCollection);
 };
 
@@ -276,22 +296,327 @@ ValueTree MirFunctionCollection::fillLayoutWithData(const String& dataId, const
 
 
 
-void* MirCompiler::currentConsole = nullptr;
-Array<StaticFunctionPointer> MirCompiler::currentFunctions;
+CriticalSection MirCompiler::CodeCache::lock;
+File MirCompiler::CodeCache::directory;
+MirCompiler::CodeCache::Statistics MirCompiler::CodeCache::statistics;
+
+namespace CodeCacheHelpers
+{
+/** Bump this if the MIR builder creates different code for the same syntax tree. */
+static constexpr int FormatVersion = 1;
+
+static constexpr uint32 Magic = 0x4d495243; // "MIRC"
+
+/** A 64 bit FNV-1a hash (used with different seeds to create the cache key and the checksum). */
+static uint64 hash(const void* data, size_t numBytes, uint64 seed = 14695981039346656037ull)
+{
+	auto ptr = static_cast<const uint8*>(data);
+	auto h = seed;
+
+	for (size_t i = 0; i < numBytes; i++)
+	{
+		h ^= ptr[i];
+		h *= 1099511628211ull;
+	}
+
+	return h;
+}
+
+static String toHexString(const MemoryBlock& mb)
+{
+	return String::toHexString((int64)hash(mb.getData(), mb.getSize()));
+}
+
+static thread_local MemoryOutputStream* currentOutput = nullptr;
+static thread_local MemoryInputStream* currentInput = nullptr;
+
+static int writeByte(MIR_context_t, uint8_t byte)
+{
+	return currentOutput->writeByte((char)byte) ? 1 : 0;
+}
+
+static int readByte(MIR_context_t)
+{
+	if (currentInput->isExhausted())
+		return EOF;
+
+	return (int)(uint8)currentInput->readByte();
+}
+}
+
+String MirCompiler::CodeCache::Statistics::toString() const
+{
+	String s;
+	s << "MIR code cache: " << String(numHits) << " hits, " << String(numMisses) << " misses";
+
+	if (numErrors > 0)
+		s << ", " << String(numErrors) << " errors";
+
+	return s;
+}
+
+void MirCompiler::CodeCache::setDirectory(const File& newDirectory)
+{
+	ScopedLock sl(lock);
+	directory = newDirectory;
+
+	if (directory != File())
+		directory.createDirectory();
+}
+
+File MirCompiler::CodeCache::getDirectory()
+{
+	ScopedLock sl(lock);
+	return directory;
+}
+
+MirCompiler::CodeCache::Statistics MirCompiler::CodeCache::getStatistics()
+{
+	ScopedLock sl(lock);
+	return statistics;
+}
+
+void MirCompiler::CodeCache::resetStatistics()
+{
+	ScopedLock sl(lock);
+	statistics = {};
+}
+
+void MirCompiler::CodeCache::clear()
+{
+	ScopedLock sl(lock);
+
+	if (directory.isDirectory())
+	{
+		for (auto f : directory.findChildFiles(File::findFiles, false, "*.mirc"))
+			f.deleteFile();
+	}
+}
+
+String MirCompiler::CodeCache::createKey(const ValueTree& ast, const Array<ValueTree>& dataLayout)
+{
+	if (getDirectory() == File())
+		return {};
+
+	MemoryOutputStream mos;
+
+	mos << "v" << String(CodeCacheHelpers::FormatVersion) << " mir" << String(MIR_API_VERSION) << " O3\n";
+
+	ast.writeToStream(mos);
+
+	for (const auto& l : dataLayout)
+		l.writeToStream(mos);
+
+	// use two hashes with different seeds to make collisions practically impossible
+	auto h1 = CodeCacheHelpers::hash(mos.getData(), mos.getDataSize());
+	auto h2 = CodeCacheHelpers::hash(mos.getData(), mos.getDataSize(), 0x9e3779b97f4a7c15ull);
+
+	return String::toHexString((int64)h1).paddedLeft('0', 16) + String::toHexString((int64)h2).paddedLeft('0', 16);
+}
+
+bool MirCompiler::CodeCache::load(const String& key, MIR_context* ctx, ValueTree& globalData, String& mirCode)
+{
+	auto f = getDirectory().getChildFile(key).withFileExtension("mirc");
+
+	MemoryBlock mb;
+
+	if (!f.existsAsFile() || !f.loadFileAsData(mb))
+	{
+		ScopedLock sl(lock);
+		statistics.numMisses++;
+		return false;
+	}
+
+	MemoryInputStream mis(mb, false);
+
+	auto ok = mis.readInt() == (int)CodeCacheHelpers::Magic;
+
+	MemoryBlock moduleData;
+	String checksum;
+
+	if (ok)
+	{
+		globalData = ValueTree::readFromStream(mis);
+		mirCode = mis.readString();
+		checksum = mis.readString();
+		auto numBytes = (size_t)mis.readInt64();
+		ok = numBytes == (size_t)mis.readIntoMemoryBlock(moduleData, (ssize_t)numBytes);
+	}
+
+	// MIR doesn't recover from reading invalid binary data, so we need to make sure it's not corrupted
+	ok &= CodeCacheHelpers::toHexString(moduleData) == checksum;
+
+	if (!ok)
+	{
+		f.deleteFile();
+
+		ScopedLock sl(lock);
+		statistics.numErrors++;
+		statistics.numMisses++;
+		return false;
+	}
+
+	MemoryInputStream moduleStream(moduleData, false);
+
+	CodeCacheHelpers::currentInput = &moduleStream;
+	MIR_read_with_func(ctx, CodeCacheHelpers::readByte);
+	CodeCacheHelpers::currentInput = nullptr;
+
+	ScopedLock sl(lock);
+	statistics.numHits++;
+	return true;
+}
+
+void MirCompiler::CodeCache::store(const String& key, MIR_context* ctx, MIR_module* m, const ValueTree& globalData, const String& mirCode)
+{
+	MemoryOutputStream moduleData;
+
+	CodeCacheHelpers::currentOutput = &moduleData;
+	MIR_write_module_with_func(ctx, CodeCacheHelpers::writeByte, m);
+	CodeCacheHelpers::currentOutput = nullptr;
+
+	MemoryOutputStream mos;
+
+	mos.writeInt((int)CodeCacheHelpers::Magic);
+	globalData.writeToStream(mos);
+	mos.writeString(mirCode);
+	mos.writeString(CodeCacheHelpers::toHexString(moduleData.getMemoryBlock()));
+	mos.writeInt64((int64)moduleData.getDataSize());
+	mos.write(moduleData.getData(), moduleData.getDataSize());
+
+	auto f = getDirectory().getChildFile(key).withFileExtension("mirc");
+
+	// write to a temporary file first so that another instance never reads a partial file
+	TemporaryFile tmp(f);
+
+	if (!tmp.getFile().replaceWithData(mos.getData(), mos.getDataSize()) || !tmp.overwriteTargetFileWithTemporary())
+	{
+		ScopedLock sl(lock);
+		statistics.numErrors++;
+	}
+}
+
+thread_local void* MirCompiler::currentConsole = nullptr;
+thread_local Array<StaticFunctionPointer> MirCompiler::currentFunctions;
 
 MirCompiler::MirCompiler(jit::GlobalScope& m):
-	r(Result::fail("nothing compiled")),
-	memory(m)
+	r(Result::fail("nothing compiled"))
 {
 	currentConsole = m.getGlobalFunctionClass(NamespacedIdentifier("Console"));
 	
 }
 
+MirCompiler::MirCompiler(MirFunctionCollection* baseline):
+	r(Result::fail("nothing compiled")),
+	baselineCollection(baseline)
+{
+	
+}
+
+void MirCompiler::setOptimizationLevel(int newLevel)
+{
+	optimizationLevel = jlimit<int>(Baseline, FullOptimization, newLevel);
+}
+
+snex::jit::FunctionCollectionBase::Ptr MirCompiler::createOptimisedCollection(MirFunctionCollection* baseline, Result& r)
+{
+	if (baseline == nullptr || !baseline->isBaseline())
+	{
+		r = Result::fail("Not a baseline collection");
+		return nullptr;
+	}
+
+	// This is most likely called on another thread than the baseline compilation,
+	// so we need to restore the library functions that were available back then
+	auto prevFunctions = currentFunctions;
+	auto prevConsole = currentConsole;
+
+	currentFunctions = baseline->libraryFunctions;
+	currentConsole = baseline->console.get();
+
+	jit::FunctionCollectionBase::Ptr optimised;
+
+	{
+		MirCompiler mc(baseline);
+		mc.setOptimizationLevel(FullOptimization);
+
+		optimised = mc.compileMirCode(baseline->mirCode);
+		r = mc.getLastError();
+	}
+
+	currentFunctions = prevFunctions;
+	currentConsole = prevConsole;
+
+	if (!r.wasOk())
+		return nullptr;
+
+	return optimised;
+}
+
+void MirCompiler::shareDataWithBaseline(MIR_module* m)
+{
+	// The generated code will use the data of the baseline collection, so the state
+	// of the object is kept when the function pointers are swapped. The original 
+	// addresses are restored after the code generation so MIR can free the data.
+	for (auto item = DLIST_HEAD(MIR_item_t, m->items); item != NULL; item = DLIST_NEXT(MIR_item_t, item))
+	{
+		const char* name = nullptr;
+
+		if (item->item_type == MIR_data_item)
+			name = item->u.data->name;
+		else if (item->item_type == MIR_bss_item)
+			name = item->u.bss->name;
+
+		if (name == nullptr)
+			continue;
+
+		String s(name);
+
+		if (s.isNotEmpty() && !s.startsWithChar('.') && baselineCollection->dataItems.contains(s))
+		{
+			remappedDataItems.add({ item, item->addr });
+			item->addr = baselineCollection->dataItems[s];
+		}
+	}
+}
+
+void MirCompiler::restoreDataAddresses()
+{
+	for (auto& p : remappedDataItems)
+		p.first->addr = p.second;
+
+	remappedDataItems.clearQuick();
+}
+
 snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const ValueTree& ast)
 {
 	if (currentFunctionClass == nullptr)
 		currentFunctionClass = new MirFunctionCollection();
 
+	cacheKey = CodeCache::createKey(ast, dataLayout);
+
+	if (cacheKey.isNotEmpty())
+	{
+		auto ctx = getFunctionClass()->ctx;
+		ValueTree globalData;
+		String code;
+
+		if (CodeCache::load(cacheKey, ctx, globalData, code))
+		{
+			cacheKey = {};
+			assembly = code;
+			getFunctionClass()->mirCode = code;
+			r = Result::ok();
+
+			if (auto m = DLIST_TAIL(MIR_module_t, *MIR_get_module_list(ctx)))
+			{
+				auto ok = linkModule(m);
+				getFunctionClass()->globalData = globalData;
+				return ok;
+			}
+		}
+	}
+
 	MirBuilder b(getFunctionClass()->ctx, ast);
 
     b.setDataLayout(dataLayout);
@@ -301,13 +626,17 @@ snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const ValueTree&
 	if (r.wasOk())
 	{
         auto code = b.getMirText();
+
+		cachedGlobalData = b.getGlobalData();
 		auto ok = compileMirCode(code);
         
         getFunctionClass()->globalData = b.getGlobalData();
         
+		cacheKey = {};
         return ok;
 	}
 
+	cacheKey = {};
 	return nullptr;
 }
 
@@ -382,102 +711,137 @@ snex::jit::FunctionCollectionBase* MirCompiler::compileMirCode(const String& cod
 		currentFunctionClass = new MirFunctionCollection();
 
 	assembly = code;
+	getFunctionClass()->mirCode = code;
 
 	r = Result::ok();
 
 	try
 	{
-        File fs;
-        
 		auto ctx = getFunctionClass()->ctx;
 
 		MIR_scan_string(ctx, code.getCharPointer().getAddress());
 
 		if (auto m = DLIST_TAIL(MIR_module_t, *MIR_get_module_list(ctx)))
 		{
-			getFunctionClass()->modules.add(m);
-			MIR_load_module(ctx, m);
-			MIR_gen_init(ctx);
-			MIR_gen_set_optimize_level(ctx, 3);
-            //MIR_gen_set_debug_file(ctx, 1, dbgfile);
-			MIR_link(ctx, MIR_set_gen_interface, &MirCompiler::resolve);
-            
-            for(auto& m: getFunctionClass()->modules)
+			// store the module before it gets modified by the linker
+			if (cacheKey.isNotEmpty())
+				CodeCache::store(cacheKey, ctx, m, cachedGlobalData, code);
+
+			return linkModule(m);
+		}
+		else
+		{
+			r = Result::fail("Can't find module");
+		}
+	}
+	catch (String& error)
+	{
+		r = Result::fail(error);
+	}
+
+	return nullptr;
+
+}
+
+snex::jit::FunctionCollectionBase* MirCompiler::linkModule(MIR_module* module)
+{
+	try
+	{
+		auto ctx = getFunctionClass()->ctx;
+
+		auto fc = getFunctionClass();
+
+		fc->modules.add(module);
+		fc->optimizationLevel = optimizationLevel;
+		fc->libraryFunctions = currentFunctions;
+		fc->console = static_cast<FunctionClass*>(currentConsole);
+
+		MIR_load_module(ctx, module);
+
+		if (baselineCollection != nullptr)
+		{
+			fc->baseline = baselineCollection;
+			fc->globalData = baselineCollection->globalData;
+			shareDataWithBaseline(module);
+		}
+
+		MIR_gen_init(ctx);
+		MIR_gen_set_optimize_level(ctx, (unsigned int)optimizationLevel);
+        //MIR_gen_set_debug_file(ctx, 1, dbgfile);
+		MIR_link(ctx, MIR_set_gen_interface, &MirCompiler::resolve);
+        
+        for(auto& m: getFunctionClass()->modules)
+        {
+            for (auto f = DLIST_HEAD(MIR_item_t, m->items); f != NULL; f = DLIST_NEXT(MIR_item_t, f))
             {
-                for (auto f = DLIST_HEAD(MIR_item_t, m->items); f != NULL; f = DLIST_NEXT(MIR_item_t, f))
+                if(f->item_type == MIR_data_item)
                 {
-                    if(f->item_type == MIR_data_item)
+                    String s(f->u.data->name);
+                    
+                    if(s.isNotEmpty() && !s.startsWithChar('.'))
                     {
-                        String s(f->u.data->name);
-                        
-                        if(s.isNotEmpty() && !s.startsWithChar('.'))
-                        {
-                            getFunctionClass()->dataItems.set(s, f->addr);
+                        getFunctionClass()->dataItems.set(s, f->addr);
 
-							NamespacedIdentifier id(s);
-							TypeInfo t(Types::ID::Integer, false, false);
+						NamespacedIdentifier id(s);
+						TypeInfo t(Types::ID::Integer, false, false);
 
-                            getFunctionClass()->dataIds.add(jit::Symbol(id, t));
-                        }
+                        getFunctionClass()->dataIds.add(jit::Symbol(id, t));
                     }
-					else if (f->item_type == MIR_func_item)
-					{
-						String s(f->u.data->name);
+                }
+				else if (f->item_type == MIR_func_item)
+				{
+					String s(f->u.data->name);
 
-						s = s.upToLastOccurrenceOf("_", false, false);
+					s = s.upToLastOccurrenceOf("_", false, false);
 
-						if (s.isNotEmpty())
-						{
-							NamespacedIdentifier id(s);
-							getFunctionClass()->allFunctions.add(id);
-						}
+					if (s.isNotEmpty())
+					{
+						NamespacedIdentifier id(s);
+						getFunctionClass()->allFunctions.add(id);
+					}
 
-						auto main_func = f;
-						
-						jit::FunctionData fd;
-						fd.id = NamespacedIdentifier::fromString(s);
+					auto main_func = f;
+					
+					jit::FunctionData fd;
+					fd.id = NamespacedIdentifier::fromString(s);
 
-						auto x = main_func->u.func;
+					auto x = main_func->u.func;
 
-						if (x->nres != 0)
-							fd.returnType = TypeInfo(MirHelpers::getTypeFromMirEnum(x->res_types[0]), false, false);
-						else
-							fd.returnType = Types::ID::Void;
+					if (x->nres != 0)
+						fd.returnType = TypeInfo(MirHelpers::getTypeFromMirEnum(x->res_types[0]), false, false);
+					else
+						fd.returnType = Types::ID::Void;
 
-						for (uint32 i = 0; i < x->nargs; i++)
-						{
-							auto v = x->vars->varr[i];
-							fd.addArgs(v.name, TypeInfo(MirHelpers::getTypeFromMirEnum(v.type)));
-						}
+					for (uint32 i = 0; i < x->nargs; i++)
+					{
+						auto v = x->vars->varr[i];
+						fd.addArgs(v.name, TypeInfo(MirHelpers::getTypeFromMirEnum(v.type)));
+					}
 
-						fd.function = MIR_gen(ctx, main_func);
+					fd.function = MIR_gen(ctx, main_func);
 
-						if (fd.function != nullptr)
-							fd.function = main_func->u.func->machine_code;
+					if (fd.function != nullptr)
+						fd.function = main_func->u.func->machine_code;
 
-						//fd.numBytes = main_func->u.func. u.func->num_bytes;
+					//fd.numBytes = main_func->u.func. u.func->num_bytes;
 
-						getFunctionClass()->functionMap.emplace(s, fd);
-					}
-                }
+					getFunctionClass()->functionMap.emplace(s, fd);
+				}
             }
+        }
 
-			MIR_gen_finish(ctx);
+		MIR_gen_finish(ctx);
+		restoreDataAddresses();
 
-			return getFunctionClass();
-		}
-		else
-		{
-			r = Result::fail("Can't find module");
-		}
+		return getFunctionClass();
 	}
 	catch (String& error)
 	{
+		restoreDataAddresses();
 		r = Result::fail(error);
 	}
 
 	return nullptr;
-
 }
 
 
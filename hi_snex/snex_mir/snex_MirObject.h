@@ -36,6 +36,7 @@
 
 struct MIR_context;
 struct MIR_module;
+struct MIR_item;
 
 namespace snex {
 namespace mir {
@@ -49,8 +50,65 @@ struct MirFunctionCollection;
 
 struct MirCompiler
 {
+	/** A persistent cache for the MIR modules that are created from the SNEX syntax tree.
+
+		The key is a hash of the syntax tree, the data layout and the compiler options, so
+		every change to the code or the types will create a new entry. On a cache hit the binary MIR
+		module is loaded directly which skips the MIR builder and the MIR text parser. The machine
+		code generation still has to run because MIR can't serialise the generated code.
+
+		The cache is disabled until you set a directory.
+	*/
+	struct CodeCache
+	{
+		struct Statistics
+		{
+			String toString() const;
+
+			int numHits = 0;
+			int numMisses = 0;
+			int numErrors = 0;
+		};
+
+		/** Sets the directory for the cache files. Pass in File() to disable the cache. */
+		static void setDirectory(const File& newDirectory);
+
+		static File getDirectory();
+
+		static Statistics getStatistics();
+
+		static void resetStatistics();
+
+		/** Deletes all cache files. */
+		static void clear();
+
+	private:
+
+		friend struct MirCompiler;
+
+		static String createKey(const ValueTree& ast, const Array<ValueTree>& dataLayout);
+		static bool load(const String& key, MIR_context* ctx, ValueTree& globalData, String& mirCode);
+		static void store(const String& key, MIR_context* ctx, MIR_module* m, const ValueTree& globalData, const String& mirCode);
+
+		static CriticalSection lock;
+		static File directory;
+		static Statistics statistics;
+	};
+
+	/** The optimisation levels of the MIR code generator. */
+	enum OptimizationLevel
+	{
+		Baseline = 0,
+		FullOptimization = 3
+	};
+
 	MirCompiler(jit::GlobalScope& m);
 
+	/** Sets the optimisation level for the machine code generation. If you use a lower level than
+		FullOptimization, the function collection can be optimised later with 
+		FunctionCollectionBase::createOptimisedCollection(). */
+	void setOptimizationLevel(int newLevel);
+
 	jit::FunctionCollectionBase* compileMirCode(const String& code);
 	jit::FunctionCollectionBase* compileMirCode(const ValueTree& ast);
 
@@ -65,6 +123,9 @@ struct MirCompiler
 	static void* resolve(const char* name);
 
 	static bool isExternalFunction(const String& sig);
+
+	/** Compiles the MIR code of the baseline collection again with full optimisation. */
+	static jit::FunctionCollectionBase::Ptr createOptimisedCollection(MirFunctionCollection* baseline, Result& r);
     
     String getAssembly() const { return assembly; }
     
@@ -72,15 +133,31 @@ struct MirCompiler
 
 	private:
 
-	jit::GlobalScope& memory;
+	MirCompiler(MirFunctionCollection* baseline);
 
 	MirFunctionCollection* getFunctionClass();
 
+	void shareDataWithBaseline(MIR_module* m);
+	void restoreDataAddresses();
+
+	jit::FunctionCollectionBase* linkModule(MIR_module* m);
+
+	String cacheKey;
+	ValueTree cachedGlobalData;
+
     Array<ValueTree> dataLayout;
     String assembly;
+
+	int optimizationLevel = FullOptimization;
+
+	// the data items that point to the baseline collection during the code generation
+	MirFunctionCollection* baselineCollection = nullptr;
+	Array<std::pair<MIR_item*, void*>> remappedDataItems;
     
-	static Array<StaticFunctionPointer> currentFunctions;
-	static void* currentConsole;
+	// The library functions are registered for the thread that is compiling
+	// the code so that multiple compilers can run in parallel
+	static thread_local Array<StaticFunctionPointer> currentFunctions;
+	static thread_local void* currentConsole;
 
 	Result r;
 
@@ -474,6 +474,13 @@ struct FunctionCollectionBase : public ReferenceCountedObject
 
 	virtual ValueTree getDataLayout(int dataIndex) const { return {}; }
 
+	/** Returns true if the functions were created by the baseline tier of the tiered compilation. */
+	virtual bool isBaseline() const { return false; }
+
+	/** Compiles the functions again with full optimisation. The new collection uses the data of this
+		collection so the state is kept if you swap the function pointers. */
+	virtual Ptr createOptimisedCollection(Result& r) { r = Result::fail("Can't optimise this function collection"); return nullptr; }
+
 protected:
 
 	static NamespacedIdentifier getMainId();
@@ -598,6 +598,13 @@ public:
     void setUseInterpreter(bool shouldUseInterpreter) { interpreterMode = shouldUseInterpreter; }
     
     bool isUsingInterpreter() const { return interpreterMode; }
+
+	/** Enables the tiered compilation. The code will be compiled with the baseline code generator
+		and you need to call JitObject::createOptimisedObject() on a background thread to get the 
+		optimised code. */
+	void setUseTieredCompilation(bool shouldUseTieredCompilation) { tieredCompilation = shouldUseTieredCompilation; }
+
+	bool isUsingTieredCompilation() const { return tieredCompilation; }
     
 	void clearDebugMessages();
 
@@ -612,6 +619,7 @@ private:
 	Map currentMap;
 
     bool interpreterMode = false;
+	bool tieredCompilation = false;
     bool debugMode = false;
 
 	Array<Identifier> noInliners;
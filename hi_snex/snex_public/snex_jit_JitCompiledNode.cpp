@@ -43,12 +43,13 @@ int JitCompiledNode::getNumRequiredDataObjects(ExternalData::DataType t) const
 void JitCompiledNode::setExternalData(const ExternalData& b, int index)
 {
 	auto ptr = (void*)&b;
-	setExternalDataFunction.callVoid(ptr, index);
+	currentTable.load()->setExternalDataFunction.callVoid(ptr, index);
 }
 
 JitCompiledNode::JitCompiledNode(Compiler& c, const String& code, const String& classId, int numChannels_, const CompilerInitFunction& cf) :
 	r(Result::ok()),
-	numChannels(numChannels_)
+	numChannels(numChannels_),
+	currentTable(tables)
 {
 	String s;
 
@@ -154,15 +155,18 @@ JitCompiledNode::JitCompiledNode(Compiler& c, const String& code, const String&
 
 				instanceType = c.getComplexType(implId);
 
-				parameterFunctions.clear();
+				tables[0].parameterFunctions.clear();
+				parameterIds.clear();
 
 				for (auto& n : encoderData)
 				{
 					scriptnode::parameter::data d;
 					d.info = n;
-					auto f = obj[Identifier("set" + n.getId())];
+					Identifier pId("set" + n.getId());
+					auto f = obj[pId];
 
-					parameterFunctions.add(f);
+					tables[0].parameterFunctions.add(f);
+					parameterIds.add(pId);
 
 					auto pIndex = n.index;
 
@@ -191,6 +195,10 @@ JitCompiledNode::JitCompiledNode(Compiler& c, const String& code, const String&
 
 
 
+			callbackIds = fIds;
+
+			auto callbacks = tables[0].callbacks;
+
 			for (int i = 0; i < fIds.size(); i++)
 			{
 				callbacks[i] = obj[fIds[i]];
@@ -228,9 +236,9 @@ JitCompiledNode::JitCompiledNode(Compiler& c, const String& code, const String&
 					ok = false;
 			}
 
-			setExternalDataFunction = obj["setExternalData"];
+			tables[0].setExternalDataFunction = obj["setExternalData"];
 
-			if (setExternalDataFunction.isResolved())
+			if (tables[0].setExternalDataFunction.isResolved())
 			{
 				ExternalData d;
 				setExternalData(d, -1);
@@ -244,6 +252,43 @@ JitCompiledNode::JitCompiledNode(Compiler& c, const String& code, const String&
 	}
 }
 
+Result JitCompiledNode::optimise()
+{
+	if (!ok || isOptimised() || !obj.isBaseline())
+		return Result::ok();
+
+	auto r = Result::ok();
+	auto optimised = obj.createOptimisedObject(r);
+
+	if (!r.wasOk())
+		return r;
+
+	auto& t = tables[1];
+
+	for (int i = 0; i < callbackIds.size(); i++)
+	{
+		t.callbacks[i] = optimised[callbackIds[i]];
+
+		if (t.callbacks[i].function == nullptr)
+			return Result::fail("Can't find optimised function " + callbackIds[i].toString());
+	}
+
+	t.parameterFunctions.clear();
+
+	for (const auto& id : parameterIds)
+		t.parameterFunctions.add(optimised[id]);
+
+	t.setExternalDataFunction = optimised["setExternalData"];
+
+	optimisedObj = optimised;
+
+	// The audio thread picks up the new functions with the next callback, the
+	// baseline code is kept alive by the optimised object.
+	currentTable.store(&t);
+
+	return Result::ok();
+}
+
 
 }
 }
@@ -86,32 +86,44 @@ struct JitCompiledNode : public ReferenceCountedObject,
 
 		lastSpecs = ps;
 
-		callbacks[Types::ScriptnodeCallbacks::PrepareFunction].callVoid(&lastSpecs);
-		callbacks[Types::ScriptnodeCallbacks::ResetFunction].callVoid();
+		auto t = currentTable.load();
+
+		t->callbacks[Types::ScriptnodeCallbacks::PrepareFunction].callVoid(&lastSpecs);
+		t->callbacks[Types::ScriptnodeCallbacks::ResetFunction].callVoid();
 	}
 
 	template <typename T> void process(T& data)
 	{
 		jassert(data.getNumChannels() >= numChannels);
-		callbacks[Types::ScriptnodeCallbacks::ProcessFunction].callVoid(&data);
+		currentTable.load()->callbacks[Types::ScriptnodeCallbacks::ProcessFunction].callVoid(&data);
 	}
 
 	void reset()
 	{
-		callbacks[Types::ScriptnodeCallbacks::ResetFunction].callVoid();
+		currentTable.load()->callbacks[Types::ScriptnodeCallbacks::ResetFunction].callVoid();
 	}
 
 	void handleHiseEvent(HiseEvent& e)
 	{
-		callbacks[Types::ScriptnodeCallbacks::HandleEventFunction].callVoid(&e);
+		currentTable.load()->callbacks[Types::ScriptnodeCallbacks::HandleEventFunction].callVoid(&e);
 	}
 
 	template <typename T> void processFrame(T& data)
 	{
 		jassert(data.size() >= numChannels);
-		callbacks[Types::ScriptnodeCallbacks::ProcessFrameFunction].callVoid(data.begin());
+		currentTable.load()->callbacks[Types::ScriptnodeCallbacks::ProcessFrameFunction].callVoid(data.begin());
 	}
 
+	/** Compiles the code again with full optimisation if the node was compiled with the 
+		tiered compilation and swaps the function pointers once the code is ready.
+
+		The optimised code uses the same data as the baseline code, so you can call this 
+		on a background thread while the node is processing.
+	*/
+	Result optimise();
+
+	bool isOptimised() const { return currentTable.load() == tables + 1; }
+
 	scriptnode::ParameterDataList getParameterList() const
 	{
 		return parameterList;
@@ -128,10 +140,11 @@ struct JitCompiledNode : public ReferenceCountedObject,
 	template <int P> static void setParameterStatic(void* obj, double value)
 	{
 		auto typed = static_cast<JitCompiledNode*>(obj);
+		auto& pf = typed->currentTable.load()->parameterFunctions;
 
-		if(isPositiveAndBelow(P, typed->parameterFunctions.size()))
+		if(isPositiveAndBelow(P, pf.size()))
 		{
-			typed->parameterFunctions.getReference(P).callVoid(value);
+			pf.getReference(P).callVoid(value);
 		}
 	}
 
@@ -165,13 +178,24 @@ private:
 
 	int numChannels = 0;
 	bool ok = false;
-	FunctionData callbacks[Types::ScriptnodeCallbacks::OptionalOffset];
 
-	FunctionData setExternalDataFunction;
+	struct CallbackTable
+	{
+		FunctionData callbacks[Types::ScriptnodeCallbacks::OptionalOffset];
+		FunctionData setExternalDataFunction;
+		Array<FunctionData> parameterFunctions;
+	};
+
+	// The first table contains the compiled functions and the second one the 
+	// optimised functions of the tiered compilation.
+	CallbackTable tables[2];
+	std::atomic<CallbackTable*> currentTable;
 
-	Array<FunctionData> parameterFunctions;
+	Array<Identifier> callbackIds;
+	Array<Identifier> parameterIds;
 
 	JitObject obj;
+	JitObject optimisedObj;
     
 	String assembly;
     
@@ -38,7 +38,7 @@ USE_ASMJIT_NAMESPACE;
 
 
 
-int Compiler::compileCount = 0;
+std::atomic<int> Compiler::compileCount = { 0 };
 
  void Compiler::reset()
  {
@@ -221,6 +221,9 @@ JitObject Compiler::compileJitObject(const juce::String& code)
 
 		mc.setDataLayout(layout);
 
+		if (memory.isUsingTieredCompilation())
+			mc.setOptimizationLevel(mir::MirCompiler::Baseline);
+
 		JitObject mirObject(mc.compileMirCode(getAST()));
 
 		cr = mc.getLastError();
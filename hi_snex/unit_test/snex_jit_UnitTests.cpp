@@ -539,7 +539,216 @@ public:
 		optimizations = OptimizationIds::Helpers::getDefaultIds();
 
 		runTestsWithOptimisation(OptimizationIds::Helpers::getDefaultIds());
+
+#if SNEX_MIR_BACKEND
+		testMirCodeCache();
+		testTieredCompilation();
+#endif
+
+#if SNEX_MIR_BACKEND && SNEX_MIR_VECTORISE_LOOPS
+		testLoopVectorisation();
+#endif
+
+		testParallelCompilation();
+	}
+
+	void testParallelCompilation()
+	{
+		beginTest("Testing parallel compilation with separate global scopes");
+
+		constexpr int NumThreads = 8;
+
+		int results[NumThreads];
+		String errors[NumThreads];
+
+		{
+			ThreadPool pool(NumThreads);
+
+			for (int i = 0; i < NumThreads; i++)
+			{
+				results[i] = -1;
+
+				pool.addJob([i, &results, &errors]()
+				{
+					String code;
+					code << "int test(int a){ return Math.max(a, 0) * " << String(i + 2) << " + " << String(i) << "; }";
+
+					GlobalScope s;
+					Compiler compiler(s);
+					auto obj = compiler.compileJitObject(code);
+
+					if (compiler.getCompileResult().wasOk())
+						results[i] = obj["test"].call<int>(3);
+					else
+						errors[i] = compiler.getCompileResult().getErrorMessage();
+				});
+			}
+
+			while (pool.getNumJobs() > 0)
+				Thread::sleep(5);
+		}
+
+		for (int i = 0; i < NumThreads; i++)
+		{
+			expect(errors[i].isEmpty(), errors[i]);
+			expectEquals(results[i], 3 * (i + 2) + i, "wrong result for compiler " + String(i));
+		}
+	}
+
+#if SNEX_MIR_BACKEND
+	void testMirCodeCache()
+	{
+		beginTest("Testing MIR code cache");
+
+		using CodeCache = mir::MirCompiler::CodeCache;
+
+		TemporaryFile tmpDirectory;
+		auto prevDirectory = CodeCache::getDirectory();
+
+		CodeCache::setDirectory(tmpDirectory.getFile());
+		CodeCache::resetStatistics();
+
+		const String code = "int test(int a){ return a * 2 + 1; }";
+
+		for (int i = 0; i < 2; i++)
+		{
+			GlobalScope s;
+			Compiler compiler(s);
+			auto obj = compiler.compileJitObject(code);
+
+			expect(compiler.getCompileResult().wasOk(), compiler.getCompileResult().getErrorMessage());
+			expectEquals(obj["test"].call<int>(4), 9, "wrong result after cache load");
+		}
+
+		auto stats = CodeCache::getStatistics();
+
+		expectEquals(stats.numMisses, 1, "first compilation should miss");
+		expectEquals(stats.numHits, 1, "second compilation should hit");
+
+		CodeCache::clear();
+		tmpDirectory.getFile().deleteRecursively();
+		CodeCache::setDirectory(prevDirectory);
+	}
+
+	void testTieredCompilation()
+	{
+		beginTest("Testing tiered compilation");
+
+		GlobalScope s;
+		s.setUseTieredCompilation(true);
+
+		Compiler compiler(s);
+		auto baseline = compiler.compileJitObject("int counter = 0; int next(int delta){ counter += delta; return counter; }");
+
+		expect(compiler.getCompileResult().wasOk(), compiler.getCompileResult().getErrorMessage());
+		expect(baseline.isBaseline(), "not compiled with the baseline tier");
+		expectEquals(baseline["next"].call<int>(2), 2, "wrong baseline result");
+
+		auto r = Result::ok();
+		auto optimised = baseline.createOptimisedObject(r);
+
+		expect(r.wasOk(), r.getErrorMessage());
+		expect(!optimised.isBaseline(), "optimised object is still a baseline");
+
+		// Both tiers must work on the same data
+		expectEquals(optimised["next"].call<int>(3), 5, "optimised code doesn't keep the state");
+		expectEquals(baseline["next"].call<int>(1), 6, "baseline code doesn't see the optimised state");
+	}
+#endif
+
+#if SNEX_MIR_BACKEND && SNEX_MIR_VECTORISE_LOOPS
+	void testLoopVectorisation()
+	{
+		beginTest("Testing vectorised loops");
+
+		using ScalarFunction = std::function<float(float, float)>;
+
+		// The index based loop is not picked up by the vectoriser so it can be used as scalar reference
+		auto testLoop = [&](const String& body, const ScalarFunction& f)
+		{
+			String code;
+			code << "void vectorised(block b, float k){ for(auto& s: b) " << body << "; }\n";
+			code << "void scalar(block b, float k){ for(int i = 0; i < b.size(); i++) { auto& s = b[i]; " << body << "; } }\n";
+			code << "span<float, 64> data;\n";
+			code << "void spanLoop(float k){ for(auto& s: data) " << body << "; }\n";
+			code << "float getSpanValue(int i){ return data[i]; }\n";
+			code << "span<float, 4> smallData;\n";
+			code << "void smallSpanLoop(float k){ for(auto& s: smallData) " << body << "; }\n";
+			code << "float getSmallSpanValue(int i){ return smallData[i]; }\n";
+
+			GlobalScope s;
+			Compiler compiler(s);
+			auto obj = compiler.compileJitObject(code);
+
+			expect(compiler.getCompileResult().wasOk(), compiler.getCompileResult().getErrorMessage());
+
+			if (!compiler.getCompileResult().wasOk())
+				return;
+
+			constexpr int NumSamples = 8191;
+			const float k = 0.37f;
+
+			AudioSampleBuffer buffer(3, NumSamples);
+
+			auto input = buffer.getWritePointer(0);
+			auto vectorData = buffer.getWritePointer(1);
+			auto scalarData = buffer.getWritePointer(2);
+
+			Random r;
+
+			for (int i = 0; i < NumSamples; i++)
+				input[i] = r.nextFloat() * 2.0f - 1.0f;
+
+			FloatVectorOperations::copy(vectorData, input, NumSamples);
+			FloatVectorOperations::copy(scalarData, input, NumSamples);
+
+			block vb(vectorData, NumSamples);
+			block sb(scalarData, NumSamples);
+
+			auto vf = obj["vectorised"];
+			auto sf = obj["scalar"];
+
+			vf.callVoid(&vb, k);
+
+			for (int i = 0; i < NumSamples; i++)
+				expectWithinAbsoluteError(vectorData[i], f(input[i], k), 1e-6f, body + ": wrong value at " + String(i));
+
+			obj["spanLoop"].callVoid(k);
+			expectWithinAbsoluteError(obj["getSpanValue"].call<float>(63), f(0.0f, k), 1e-6f, body + ": wrong span result");
+
+			// this span is below SNEX_MIR_VECTORISE_MIN_SPAN_SIZE and uses the scalar loop
+			obj["smallSpanLoop"].callVoid(k);
+			expectWithinAbsoluteError(obj["getSmallSpanValue"].call<float>(3), f(0.0f, k), 1e-6f, body + ": wrong small span result");
+
+			constexpr int NumRuns = 200;
+
+			auto measure = [&](FunctionData& fn, block& b)
+			{
+				auto start = Time::getHighResolutionTicks();
+
+				for (int i = 0; i < NumRuns; i++)
+					fn.callVoid(&b, k);
+
+				return Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+			};
+
+			auto vectorTime = measure(vf, vb);
+			auto scalarTime = measure(sf, sb);
+
+			logMessage(body + ": " + String(scalarTime / jmax(vectorTime, 1e-9), 2) + "x speedup");
+		};
+
+		testLoop("s *= k", [](float x, float k) { return x * k; });
+		testLoop("s += k", [](float x, float k) { return x + k; });
+		testLoop("s = k", [](float, float k) { return k; });
+		testLoop("s = s * k + 0.25f", [](float x, float k) { return x * k + 0.25f; });
+		testLoop("s = 0.25f + k * s", [](float x, float k) { return x * k + 0.25f; });
+		testLoop("s = Math.abs(s)", [](float x, float) { return std::abs(x); });
+		testLoop("s = Math.min(s, k)", [](float x, float k) { return jmin(x, k); });
+		testLoop("s = Math.max(k, s)", [](float x, float k) { return jmax(x, k); });
+		testLoop("s = Math.range(s, -0.5f, 0.5f)", [](float x, float) { return jlimit(-0.5f, 0.5f, x); });
 	}
+#endif
 
 #if INCLUDE_SNEX_BIG_TESTSUITE
 	
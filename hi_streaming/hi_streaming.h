@@ -102,6 +102,28 @@ Set this to false to disable the release start feature.
 #define HISE_SAMPLER_ALLOW_RELEASE_START 1
 #endif
 
+/** Config: HISE_NUM_STREAMING_THREADS
+
+The number of threads that are used for streaming samples from disk. If this is bigger than one,
+the streaming jobs will be distributed across multiple workers (all reads from the same file / monolith
+are executed by the same thread).
+
+*/
+#ifndef HISE_NUM_STREAMING_THREADS
+#define HISE_NUM_STREAMING_THREADS 1
+#endif
+
+/** Config: HISE_STREAMING_PREFETCH
+
+If enabled, the streaming threads will collect all pending read operations before executing them and tell the
+OS to fetch the memory mapped file regions in the background (using `posix_madvise()` on Linux and macOS). This
+allows the disk to work on all requests concurrently instead of blocking on each page fault one after another.
+
+*/
+#ifndef HISE_STREAMING_PREFETCH
+#define HISE_STREAMING_PREFETCH 0
+#endif
+
 
 #include "hi_streaming/lockfree_fifo/readerwriterqueue.h"
 #include "hi_streaming/lockfree_fifo/concurrentqueue.h"
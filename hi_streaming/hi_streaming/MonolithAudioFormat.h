@@ -147,14 +147,15 @@ public:
 	/** Use this for UI rendering stuff to avoid multithreading issues. */
 	AudioFormatReader* createUserInterfaceReader(int sampleIndex, int channelIndex);
 
+	/** Returns the monolith file that contains the given sample. */
+	File getFile(int channelIndex, int sampleIndex) const;
+
 	using Ptr = ReferenceCountedObjectPtr<HlacMonolithInfo>;
 
 private:
 
 	int getFileIndex(int channelIndex, int sampleIndex) const;
 
-	File getFile(int channelIndex, int sampleIndex) const;
-
 	struct SampleInfo
 	{
 		double sampleRate;
@@ -30,111 +30,260 @@
 *   ===========================================================================
 */
 
+
 namespace hise { using namespace juce;
 
 
 struct SampleThreadPool::Pimpl
 {
-	Pimpl() :
-		jobQueue(8192),
-		currentlyExecutedJob(nullptr),
-		diskUsage(0.0)
-	{};
+	struct PendingJob
+	{
+		bool operator<(const PendingJob& other) const noexcept
+		{
+			// inverted so that the std heap functions yield the earliest deadline
+			return deadline > other.deadline;
+		}
 
-	~Pimpl()
+		WeakReference<Job> job;
+		int64 deadline;
+	};
+
+	struct Worker
 	{
-		if (auto currentJob = currentlyExecutedJob.load())
+		Worker(Thread* t) :
+			thread(t),
+			jobQueue(8192),
+			currentlyExecutedJob(nullptr),
+			diskUsage(0.0)
 		{
-			currentJob->signalJobShouldExit();
+			incomingJobs.reserve(8192);
+			pendingJobs.reserve(8192);
+			deferredJobs.reserve(64);
+		};
+
+		/** Moves the jobs from the lockfree queue to the incoming list and tells them to prefetch their data.
+		*
+		*	This is called without holding the clear lock so that a slow prefetch doesn't block clearPendingTasks().
+		*/
+		void dequeueIncomingJobs()
+		{
+			WeakReference<Job> next;
+
+			while (jobQueue.try_dequeue(next))
+			{
+				if (next.get() == nullptr)
+					continue;
+
+#if HISE_STREAMING_PREFETCH
+				next->prefetch();
+#endif
+
+				incomingJobs.push_back(next);
+			}
 		}
-	}
 
-	CriticalSection clearLock;
+		/** Adds the incoming jobs to the pending list. If the pool was cleared since they were dequeued, they are cancelled instead. */
+		void addIncomingJobs(bool wasCleared)
+		{
+			for (auto& j : incomingJobs)
+			{
+				if (j.get() == nullptr)
+					continue;
 
-	std::atomic<double> diskUsage;
-	int64 startTime, endTime;
-	moodycamel::ReaderWriterQueue<WeakReference<Job>> jobQueue;
-	std::atomic<Job*> currentlyExecutedJob;
-	static const String errorMessage;
-};
+				if (wasCleared)
+					cancelJob(*j);
+				else
+					addPendingJob(j, j->getDeadline());
+			}
 
-SampleThreadPool::SampleThreadPool() :
-	Thread("Sample Loading Thread", HISE_DEFAULT_STACK_SIZE),
-	pimpl(new Pimpl())
-{
+			incomingJobs.clear();
+		}
 
-	startThread(9);
-	
-}
+		void addPendingJob(const WeakReference<Job>& j, int64 d)
+		{
+			if (d == 0)
+				d = Time::getHighResolutionTicks();
 
-SampleThreadPool::~SampleThreadPool()
-{
-	stopThread(1000);
-	pimpl = nullptr;
-}
+			pendingJobs.push_back({ j, d });
+			std::push_heap(pendingJobs.begin(), pendingJobs.end());
+		}
 
-double SampleThreadPool::getDiskUsage() const noexcept
-{
-	return pimpl->diskUsage.load();
-}
+		bool popEarliestJob(PendingJob& p)
+		{
+			while (!pendingJobs.empty())
+			{
+				std::pop_heap(pendingJobs.begin(), pendingJobs.end());
+				p = pendingJobs.back();
+				pendingJobs.pop_back();
 
-void SampleThreadPool::clearPendingTasks()
-{
-	ScopedLock sl(pimpl->clearLock);
-		
-	WeakReference<Job> next;
+				if (p.job.get() != nullptr)
+					return true;
+			}
 
-	while (pimpl->jobQueue.try_dequeue(next))
+			return false;
+		}
+
+		/** Puts the jobs that were skipped because another worker was running them back into the pending list. */
+		bool restoreDeferredJobs()
+		{
+			const bool hasDeferredJobs = !deferredJobs.empty();
+
+			for (auto& p : deferredJobs)
+			{
+				pendingJobs.push_back(p);
+				std::push_heap(pendingJobs.begin(), pendingJobs.end());
+			}
+
+			deferredJobs.clear();
+			return hasDeferredJobs;
+		}
+
+		static void cancelJob(Job& j)
+		{
+			j.queued.store(false);
+			j.signalJobShouldExit();
+		}
+
+		/** Cancels all jobs of this worker. Call this with the clear lock held. */
+		void clear()
+		{
+			numClears.fetch_add(1);
+
+			WeakReference<Job> next;
+
+			while (jobQueue.try_dequeue(next))
+			{
+				if (auto j = next.get())
+					cancelJob(*j);
+			}
+
+			for (auto& p : pendingJobs)
+			{
+				if (auto j = p.job.get())
+					cancelJob(*j);
+			}
+
+			pendingJobs.clear();
+		}
+
+		Thread* thread;
+
+		CriticalSection clearLock;
+
+		std::atomic<double> diskUsage;
+		int64 startTime = 0, endTime = 0;
+		// This needs to be a MPMC queue because jobs can be added from multiple audio threads
+		// (eg. when the sound generators are rendered in parallel) and the worker itself.
+		moodycamel::ConcurrentQueue<WeakReference<Job>> jobQueue;
+		std::atomic<int> numClears = { 0 };
+		std::vector<WeakReference<Job>> incomingJobs;
+		std::vector<PendingJob> pendingJobs;
+		std::vector<PendingJob> deferredJobs;
+		std::atomic<Job*> currentlyExecutedJob;
+	};
+
+	struct StreamingThread : public Thread
 	{
-		next->queued.store(false);
-		next->signalJobShouldExit();
-	}
-}
+		StreamingThread(Pimpl& p, int index_) :
+			Thread("Sample Streaming Thread " + String(index_), HISE_DEFAULT_STACK_SIZE),
+			parent(p),
+			index(index_)
+		{};
 
-void SampleThreadPool::addJob(Job* jobToAdd, bool unused)
-{
-	ignoreUnused(unused);
+		void run() override
+		{
+			parent.runWorker(*parent.workers[index]);
+		}
 
-#if ENABLE_CONSOLE_OUTPUT
-	if (jobToAdd->isQueued())
+		Pimpl& parent;
+		const int index;
+	};
+
+	Pimpl(SampleThreadPool& mainThread, int numWorkers)
 	{
-		Logger::writeToLog(pimpl->errorMessage);
+		workers.add(new Worker(&mainThread));
+
+		for (int i = 1; i < numWorkers; i++)
+		{
+			auto t = new StreamingThread(*this, i);
+			streamingThreads.add(t);
+			workers.add(new Worker(t));
+		}
+	};
+
+	~Pimpl()
+	{
+		for (auto w : workers)
+		{
+			if (auto currentJob = w->currentlyExecutedJob.load())
+			{
+				currentJob->signalJobShouldExit();
+			}
+		}
 	}
-#endif
 
+	Worker& getWorkerForJob(const Job& j) const
+	{
+		if (workers.size() == 1)
+			return *workers.getUnchecked(0);
 
-	jobToAdd->queued.store(true);
-	pimpl->jobQueue.enqueue(jobToAdd);
+		auto affinity = (uint64)j.getWorkerAffinity();
+		return *workers.getUnchecked((int)(affinity % (uint64)workers.size()));
+	}
 
-	notify();
-}
+	void runWorker(Worker& w);
 
-void SampleThreadPool::run()
+	OwnedArray<StreamingThread> streamingThreads;
+	OwnedArray<Worker> workers;
+
+	static const String errorMessage;
+};
+
+void SampleThreadPool::Pimpl::runWorker(Worker& w)
 {
-	while (!threadShouldExit())
+	auto& thread = *w.thread;
+
+	while (!thread.threadShouldExit())
 	{
-		WeakReference<Job> next;
+		bool hasExecutedJob = false;
+		bool hasDeferredJobs = false;
+
+		const auto clearIndex = w.numClears.load();
+
+		w.dequeueIncomingJobs();
 
-		if (pimpl->jobQueue.try_dequeue(next))
 		{
-			ScopedLock sl(pimpl->clearLock);
+			ScopedLock sl(w.clearLock);
 
-			Job* j = next.get();
+			w.addIncomingJobs(clearIndex != w.numClears.load());
 
-#if ENABLE_CPU_MEASUREMENT
+			PendingJob next;
+
+			while (w.popEarliestJob(next))
+			{
+				Job* j = next.job.get();
+
+				bool notRunning = false;
+
+				// A job might still be executed by another worker if its affinity has changed
+				// in the meantime, so we skip it and try again after the next job.
+				if (!j->running.compare_exchange_strong(notRunning, true))
+				{
+					w.deferredJobs.push_back(next);
+					continue;
+				}
+
+				hasExecutedJob = true;
 
-			const int64 lastEndTime = pimpl->endTime;
-			pimpl->startTime = Time::getHighResolutionTicks();
+#if ENABLE_CPU_MEASUREMENT
+				const int64 lastEndTime = w.endTime;
+				w.startTime = Time::getHighResolutionTicks();
 #endif
 
-			if (j != nullptr)
-			{
-				pimpl->currentlyExecutedJob.store(j);
+				w.currentlyExecutedJob.store(j);
 
-				j->currentThread.store(this);
+				j->currentThread.store(&thread);
 
-				j->running.store(true);
-				
 				Job::JobStatus status = j->runJob();
 
 				j->running.store(false);
@@ -145,39 +294,117 @@ void SampleThreadPool::run()
 				}
 				else if (status == Job::jobNeedsRunningAgain)
 				{
-					pimpl->jobQueue.enqueue(next);
+					w.jobQueue.enqueue(next.job);
 				}
 
-				pimpl->currentlyExecutedJob.store(nullptr);
-			}
-			else
-			{
-				pimpl->jobQueue.pop();
-			}
+				w.currentlyExecutedJob.store(nullptr);
 
 #if ENABLE_CPU_MEASUREMENT
-			pimpl->endTime = Time::getHighResolutionTicks();
+				w.endTime = Time::getHighResolutionTicks();
 
-			const int64 idleTime = pimpl->startTime - lastEndTime;
-			const int64 busyTime = pimpl->endTime - pimpl->startTime;
+				const int64 idleTime = w.startTime - lastEndTime;
+				const int64 busyTime = w.endTime - w.startTime;
 
-			pimpl->diskUsage.store((double)busyTime / (double)(idleTime + busyTime));
+				w.diskUsage.store((double)busyTime / (double)(idleTime + busyTime));
 #endif
+
+				break;
+			}
+
+			hasDeferredJobs = w.restoreDeferredJobs();
 		}
 
 #if 0 // Set this to true to enable defective threading (for debugging purposes)
-		wait(2500);
+		thread.wait(2500);
 #else
-		else
+		if (!hasExecutedJob)
 		{
-			wait(500);
+			// If the only jobs left are running on another worker, check back
+			// shortly instead of waiting for the next notification.
+			thread.wait(hasDeferredJobs ? 1 : 500);
 		}
 #endif
+	}
+}
+
+SampleThreadPool::SampleThreadPool(int numWorkers) :
+	Thread("Sample Loading Thread", HISE_DEFAULT_STACK_SIZE),
+	pimpl(new Pimpl(*this, jmax(1, numWorkers)))
+{
+	startThread(9);
+
+	for (auto t : pimpl->streamingThreads)
+		t->startThread(9);
+}
 
+SampleThreadPool::~SampleThreadPool()
+{
+	for (auto t : pimpl->streamingThreads)
+		t->signalThreadShouldExit();
 
+	for (auto t : pimpl->streamingThreads)
+		t->stopThread(1000);
+
+	stopThread(1000);
+	pimpl = nullptr;
+}
+
+double SampleThreadPool::getDiskUsage() const noexcept
+{
+	double maxUsage = 0.0;
+
+	for (auto w : pimpl->workers)
+		maxUsage = jmax(maxUsage, w->diskUsage.load());
+
+	return maxUsage;
+}
+
+double SampleThreadPool::getDiskUsage(int workerIndex) const noexcept
+{
+	if (auto w = pimpl->workers[workerIndex])
+		return w->diskUsage.load();
+
+	return 0.0;
+}
+
+int SampleThreadPool::getNumWorkers() const noexcept
+{
+	return pimpl->workers.size();
+}
+
+void SampleThreadPool::clearPendingTasks()
+{
+	for (auto w : pimpl->workers)
+	{
+		ScopedLock sl(w->clearLock);
+		w->clear();
 	}
 }
 
+void SampleThreadPool::addJob(Job* jobToAdd, bool unused)
+{
+	ignoreUnused(unused);
+
+#if ENABLE_CONSOLE_OUTPUT
+	if (jobToAdd->isQueued())
+	{
+		Logger::writeToLog(pimpl->errorMessage);
+	}
+#endif
+
+	auto& w = pimpl->getWorkerForJob(*jobToAdd);
+
+	jobToAdd->queued.store(true);
+	w.jobQueue.enqueue(jobToAdd);
+
+	w.thread->notify();
+}
+
+void SampleThreadPool::run()
+{
+	pimpl->runWorker(*pimpl->workers.getFirst());
+}
+
 const String SampleThreadPool::Pimpl::errorMessage("HDD overflow");
 
 
@@ -187,6 +414,7 @@ void SampleThreadPool::Job::resetJob()
 	running.store(false);
 	shouldStop.store(false);
 	currentThread.store(nullptr);
+	deadline.store(0);
 }
 
 } // namespace hise
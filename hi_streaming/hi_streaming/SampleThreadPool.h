@@ -35,11 +35,20 @@
 
 namespace hise { using namespace juce;
 
+/** The background thread pool that performs all sample loading operations.
+
+	The pool itself is the "Sample Loading Thread" and executes all jobs by default. If it is created
+	with more than one worker, it spawns additional streaming threads with their own job queue and
+	distributes the jobs based on their worker affinity (see Job::getWorkerAffinity()).
+
+	Each worker executes its pending jobs earliest-deadline-first, so a voice that is about to run out
+	of buffered samples is served before a voice that has still plenty of data left.
+*/
 class SampleThreadPool : public Thread
 {
 public:
 
-	SampleThreadPool();
+	SampleThreadPool(int numWorkers=HISE_NUM_STREAMING_THREADS);
 
 	~SampleThreadPool();
 	
@@ -52,7 +61,8 @@ public:
 			name(name_),
 			queued(false),
 			running(false),
-			shouldStop(false)
+			shouldStop(false),
+			deadline(0)
 		{};
         
         virtual ~Job() { masterReference.clear(); }
@@ -73,10 +83,35 @@ public:
 
 		bool isQueued() const noexcept{ return queued.load(); };
 
+		/** Returns the time (in high resolution ticks) when this job needs to be finished.
+		*
+		*	If this is zero, the job will be scheduled as if its deadline was the time it was picked up by the worker.
+		*/
+		int64 getDeadline() const noexcept { return deadline.load(); }
+
+		/** Override this and return a key that determines which worker will execute this job.
+		*
+		*	Jobs with the same key will always be executed by the same worker, so if your job accesses a resource that
+		*	can't be used concurrently (eg. a HLAC monolith decoder), return a hash of that resource here.
+		*	The default (zero) will execute the job on the main sample loading thread.
+		*/
+		virtual int64 getWorkerAffinity() const noexcept { return 0; }
+
+		/** Override this and tell the OS which data this job is about to read.
+		*
+		*	If HISE_STREAMING_PREFETCH is enabled, this will be called for all jobs that were added since the last pass
+		*	before the worker starts executing them, so that the read operations can be batched. It must not block, so
+		*	use try-locks for any resource that might be locked by another thread.
+		*/
+		virtual void prefetch() {}
+
 	protected:
 
 		void resetJob();
 
+		/** Sets the deadline for the next run. Call this before adding the job to the pool. */
+		void setDeadline(int64 newDeadlineInTicks) noexcept { deadline.store(newDeadlineInTicks); }
+
 		Thread* getCurrentThread() { return currentThread.load(); }
 
 	private:
@@ -89,12 +124,33 @@ public:
 		std::atomic<bool> running;
 		std::atomic<bool> shouldStop;
 		std::atomic<Thread*> currentThread;
+		std::atomic<int64> deadline;
 
 		const String name;
 	};
 
+	/** Returns the disk usage of the busiest worker. */
 	double getDiskUsage() const noexcept;
 
+	/** Returns the disk usage of the given worker. */
+	double getDiskUsage(int workerIndex) const noexcept;
+
+	/** Returns the number of workers (including this thread). */
+	int getNumWorkers() const noexcept;
+
+	/** Called by the SampleLoader whenever it has read sample frames from disk. */
+	void addNumStreamedFrames(int64 numFrames, int64 numBytes) noexcept 
+	{ 
+		numStreamedFrames.fetch_add(numFrames, std::memory_order_relaxed); 
+		numStreamedBytes.fetch_add(numBytes, std::memory_order_relaxed);
+	}
+
+	/** Returns the total number of sample frames that were streamed from disk since the pool was created. */
+	int64 getNumStreamedFrames() const noexcept { return numStreamedFrames.load(std::memory_order_relaxed); }
+
+	/** Returns the total number of bytes that were streamed from the sample files since the pool was created. */
+	int64 getNumStreamedBytes() const noexcept { return numStreamedBytes.load(std::memory_order_relaxed); }
+
 	void clearPendingTasks();
 
 	void addJob(Job* jobToAdd, bool unused);
@@ -106,6 +162,9 @@ public:
 	
 	ScopedPointer<Pimpl> pimpl;
 
+	std::atomic<int64> numStreamedFrames = { 0 };
+	std::atomic<int64> numStreamedBytes = { 0 };
+
 };
 
 typedef SampleThreadPool::Job SampleThreadPoolJob;
@@ -177,17 +177,20 @@ public:
 
 	virtual void decreaseNumOpenFileHandles()
 	{
-		--numOpenFileHandles;
-		if (numOpenFileHandles < 0) numOpenFileHandles = 0;
+		auto numOpen = numOpenFileHandles.load();
+
+		while (numOpen > 0 && !numOpenFileHandles.compare_exchange_weak(numOpen, numOpen - 1))
+			;
 	}
 
 	AudioFormatManager afm;
 
-	int getNumOpenFileHandles() const { return numOpenFileHandles; }
+	int getNumOpenFileHandles() const { return numOpenFileHandles.load(); }
 
 private:
 
-	int numOpenFileHandles = 0;
+	// The preloading uses multiple threads, so this needs to be atomic
+	std::atomic<int> numOpenFileHandles = { 0 };
 
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StreamingSamplerSoundPool);
 };
@@ -439,6 +439,8 @@ String StreamingSamplerSound::getFileName(bool getFullPath /*= false*/) const {
 
 int64 StreamingSamplerSound::getHashCode() { return fileReader.getHashCode(); }
 
+int64 StreamingSamplerSound::getStreamingWorkerAffinity() const noexcept { return fileReader.getWorkerAffinity(); }
+
 
 void StreamingSamplerSound::checkFileReference()
 {
@@ -959,6 +961,20 @@ void StreamingSamplerSound::fillSampleBuffer(hlac::HiseSampleBuffer &sampleBuffe
 	}
 };
 
+void StreamingSamplerSound::prefetchSampleData(int uptime, int numSamples) const
+{
+	if (isEntireSampleLoaded())
+		return;
+
+	if (!isReversed())
+		uptime += sampleStart;
+
+	numSamples = jmin(numSamples, sampleEnd - uptime);
+
+	if (numSamples > 0 && uptime + numSamples >= internalPreloadSize)
+		fileReader.prefetch(uptime, numSamples);
+}
+
 void StreamingSamplerSound::fillInternal(hlac::HiseSampleBuffer &sampleBuffer, int samplesToCopy, int uptime, ReleasePlayState releaseState, int offsetInBuffer/*=0*/) const
 {
 	jassert(uptime + samplesToCopy <= sampleEnd);
@@ -1070,11 +1086,13 @@ void StreamingSamplerSound::FileReader::setFile(const String &fileName)
 		fileFormatSupportsMemoryReading = fileExtension.contains("wav") || fileExtension.contains("aif");// || fileExtension.contains("hlac");
 
 		hashCode = loadedFile.hashCode64();
+		workerAffinity = hashCode;
 	}
 	else
 	{
 		faultyFileName = fileName;
 		loadedFile = File();
+		workerAffinity = 0;
 	}
 }
 
@@ -1200,6 +1218,9 @@ void StreamingSamplerSound::FileReader::openFileHandles(NotificationType notifyP
 			stereo = (normalReader != nullptr) ? (normalReader->numChannels > 1) : false;
 		}
 
+		if (normalReader != nullptr)
+			bytesPerFrame = (int)normalReader->numChannels * normalReader->bitsPerSample / 8;
+
 #if USE_BACKEND
 		if (monolithicInfo == nullptr && notifyPool == sendNotification) pool->increaseNumOpenFileHandles();
 #else
@@ -1298,6 +1319,55 @@ void StreamingSamplerSound::FileReader::readFromDisk(hlac::HiseSampleBuffer &buf
 	}
 }
 
+/** Gives access to the mapped memory of a MemoryMappedAudioFormatReader. */
+struct MemoryMappedReaderAccess : public MemoryMappedAudioFormatReader
+{
+	static const void* getPointer(const MemoryMappedAudioFormatReader& r, int64 sample)
+	{
+		return (r.*(&MemoryMappedReaderAccess::sampleToPointer))(sample);
+	}
+
+	static int getBytesPerFrame(const MemoryMappedAudioFormatReader& r)
+	{
+		return r.*(&MemoryMappedReaderAccess::bytesPerFrame);
+	}
+};
+
+void StreamingSamplerSound::FileReader::prefetch(int readerPosition, int numSamples)
+{
+	if (!fileHandlesOpen)
+		return;
+
+	if (isReversed())
+	{
+		auto end = sound->getSampleEnd();
+		readerPosition = (end - readerPosition) - numSamples;
+	}
+
+	// The prefetch is just a hint, so we skip it if the reader is being opened or closed right now.
+	if (!fileAccessLock.tryEnterRead())
+		return;
+
+	if (!isMonolithic())
+	{
+		const Range<int64> r(readerPosition, readerPosition + numSamples);
+
+		if (memoryReader != nullptr && memoryReader->getMappedSection().contains(r))
+		{
+			auto data = MemoryMappedReaderAccess::getPointer(*memoryReader, readerPosition);
+			auto numBytes = (int64)numSamples * MemoryMappedReaderAccess::getBytesPerFrame(*memoryReader);
+
+			hlac::HlacMemoryMappedAudioFormatReader::adviseWillNeed(data, numBytes);
+		}
+	}
+	else if (auto sr = dynamic_cast<hlac::HlacSubSectionReader*>(normalReader.get()))
+	{
+		sr->prefetch(readerPosition, numSamples);
+	}
+
+	fileAccessLock.exitRead();
+}
+
 float getAbsoluteValue(float input)
 {
     return input > 0.0f ? input : input * -1.0f;
@@ -1387,6 +1457,9 @@ void StreamingSamplerSound::FileReader::setMonolithicInfo(HlacMonolithInfo::Ptr
 	monolithicName = info->getFileName(channelIndex, sampleIndex);
 
 	hashCode = monolithicName.hashCode64();
+
+	// All samples of a monolith share the same decoder, so they need to be streamed by the same thread
+	workerAffinity = missing ? 0 : info->getFile(channelIndex, sampleIndex).hashCode64();
 }
 
 } // namespace hise
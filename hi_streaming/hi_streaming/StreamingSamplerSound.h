@@ -266,6 +266,9 @@ public:
 
 	int getBitRate() const;
 
+	/** Returns the number of bytes of one sample frame in the file (or zero if the file hasn't been opened yet). */
+	int getBytesPerFrame() const noexcept { return fileReader.getBytesPerFrame(); }
+
 	bool replaceAudioFile(const AudioSampleBuffer& b);
 
 	bool isMonolithic() const;
@@ -283,6 +286,9 @@ public:
 
 	int64 getHashCode();
 
+	/** Returns a hash of the file that is read by this sound. This is used to distribute the streaming jobs across the workers of the SampleThreadPool. */
+	int64 getStreamingWorkerAffinity() const noexcept;
+
 
 	void refreshFileInformation();
 	void checkFileReference();
@@ -313,6 +319,9 @@ public:
 	*/
 	bool hasEnoughSamplesForBlock(int maxSampleIndexInFile) const;
 
+	/** Tells the OS to fetch the data for the given range in the background (if it's not in the preload buffer). */
+	void prefetchSampleData(int uptime, int numSamples) const;
+
 	/** Returns read only access to the preload buffer.
 	*
 	*	This is used by the SampleLoader class to fetch the samples from the preloaded buffer until the disk streaming
@@ -369,6 +378,7 @@ private:
 		String getFileName(bool getFullPath);
 		void checkFileReference();
 		int64 getHashCode() { return hashCode; };
+		int64 getWorkerAffinity() const noexcept { return workerAffinity; }
 
 		/** Refreshes the information about the file (if it is missing, if it supports memory-mapping). */
 		void refreshFileInformation();
@@ -381,6 +391,9 @@ private:
 		/** Encapsulates all reading operations. It will use the best available reader type and opens the file handle if it is not open yet. */
 		void readFromDisk(hlac::HiseSampleBuffer &buffer, int startSample, int numSamples, int readerPosition, bool useMemoryMappedReader);
 
+		/** Hints the OS to load the given range of a memory mapped file in the background. This never opens the file handles. */
+		void prefetch(int readerPosition, int numSamples);
+
 		/** Call this method if you want to close the file handle. If voices are playing, it won't close it. */
 		void closeFileHandles(NotificationType notifyPool = sendNotification);
 
@@ -400,6 +413,8 @@ private:
 
 		bool isStereo() const noexcept;
 
+		int getBytesPerFrame() const noexcept { return bytesPerFrame; }
+
 		bool isMissing() const { return missing; }
 		void setMissing() { missing = true; }
 
@@ -468,6 +483,8 @@ private:
 
 		bool stereo = true;
 
+		std::atomic<int> bytesPerFrame = { 0 };
+
 		bool isReading;
 
 		int64 sampleLength;
@@ -477,6 +494,7 @@ private:
 		String faultyFileName;
 
 		int64 hashCode;
+		int64 workerAffinity = 0;
 
 		StreamingSamplerSound *sound;
 
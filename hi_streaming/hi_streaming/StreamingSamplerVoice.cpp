@@ -82,6 +82,40 @@ void SampleLoader::setBufferSize(int newBufferSize)
 	refreshBufferSizes();
 }
 
+void SampleLoader::setDirectStreamingBufferSize(int numSamples)
+{
+	ScopedLock sl(getLock());
+
+	auto currentSize = getNumSamplesForStreamingBuffers();
+	int newSize = currentSize;
+
+	if (numSamples > currentSize)
+	{
+		if (realtimeBufferSize == 0)
+			realtimeBufferSize = currentSize;
+
+		newSize = numSamples;
+	}
+	else if (numSamples == 0 && realtimeBufferSize != 0)
+	{
+		newSize = realtimeBufferSize;
+		realtimeBufferSize = 0;
+	}
+
+	if (newSize != currentSize)
+	{
+		b1.setSize(b1.getNumChannels(), newSize);
+		b2.setSize(b2.getNumChannels(), newSize);
+		b1.clear();
+		b2.clear();
+
+		readBuffer = &b1;
+		writeBuffer = &b2;
+
+		reset();
+	}
+}
+
 bool SampleLoader::assertBufferSize(int minimumBufferSize)
 {
 	minimumBufferSizeForSamplesPerBlock = minimumBufferSize;
@@ -435,15 +469,50 @@ bool SampleLoader::requestNewData()
 	}
 	else
 	{
+		updateDeadline();
 		backgroundPool->addJob(this, false);
 		return true;
 	}
 #else
+	updateDeadline();
 	backgroundPool->addJob(this, false);
 	return true;
 #endif
 };
 
+void SampleLoader::updateDeadline()
+{
+	auto localReadBuffer = readBuffer.get();
+
+	if (inputSamplesPerSecond <= 0.0 || localReadBuffer == nullptr)
+	{
+		setDeadline(0);
+		return;
+	}
+
+	const double numSamplesLeft = jmax(0.0, (double)localReadBuffer->getNumSamples() - readIndexDouble);
+	const double secondsLeft = numSamplesLeft / inputSamplesPerSecond;
+
+	setDeadline(Time::getHighResolutionTicks() + (int64)(secondsLeft * (double)Time::getHighResolutionTicksPerSecond()));
+}
+
+void SampleLoader::prefetch()
+{
+	if (cancelled || isWaitingForTimestretchSeek())
+		return;
+
+	if (auto s = sound.get())
+		s->prefetchSampleData(positionInSampleFile, getNumSamplesForStreamingBuffers());
+}
+
+int64 SampleLoader::getWorkerAffinity() const noexcept
+{
+	if (auto s = sound.get())
+		return s->getStreamingWorkerAffinity();
+
+	return 0;
+}
+
 
 SampleThreadPoolJob::JobStatus SampleLoader::runJob()
 {
@@ -515,6 +584,7 @@ void SampleLoader::fillInactiveBuffer()
 		if (localSound->hasEnoughSamplesForBlock(positionInSampleFile + getNumSamplesForStreamingBuffers()))
 		{
 			localSound->fillSampleBuffer(*writeBuffer.get(), getNumSamplesForStreamingBuffers(), (int)positionInSampleFile, getReleasePlayState());
+			backgroundPool->addNumStreamedFrames(getNumSamplesForStreamingBuffers(), (int64)getNumSamplesForStreamingBuffers() * localSound->getBytesPerFrame());
 		}
 		else if (localSound->hasEnoughSamplesForBlock(positionInSampleFile))
 		{
@@ -522,6 +592,7 @@ void SampleLoader::fillInactiveBuffer()
 			const int numSamplesToClear = getNumSamplesForStreamingBuffers() - numSamplesToFill;
 
 			localSound->fillSampleBuffer(*writeBuffer.get(), numSamplesToFill, (int)positionInSampleFile, getReleasePlayState());
+			backgroundPool->addNumStreamedFrames(numSamplesToFill, (int64)numSamplesToFill * localSound->getBytesPerFrame());
 
 			writeBuffer.get()->clear(numSamplesToFill, numSamplesToClear);
 		}
@@ -637,12 +708,6 @@ void StreamingSamplerVoice::startNote(int /*midiNoteNumber*/,
 
 	if (sound != nullptr && sound->getSampleLength() > 0)
 	{
-		loader.startNote(sound, sampleStartModValue);
-
-		jassert(sound != nullptr);
-		
-		voiceUptime = (double)sampleStartModValue;
-
 		// You have to call setPitchFactor() before startNote().
 		jassert(uptimeDelta != 0.0);
 
@@ -654,6 +719,12 @@ void StreamingSamplerVoice::startNote(int /*midiNoteNumber*/,
 
 		constUptimeDelta = uptimeDelta;
 
+		// The playback speed must be set before the loader requests the first buffer
+		loader.setPlaybackSpeed(uptimeDelta * getSampleRate());
+		loader.startNote(sound, sampleStartModValue);
+
+		voiceUptime = (double)sampleStartModValue;
+
 #if HISE_SAMPLER_ALLOW_RELEASE_START
 		jumpToReleaseOnNextRender = false;
 		releaseFadeDuration = 0;
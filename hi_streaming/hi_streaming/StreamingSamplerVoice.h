@@ -70,6 +70,19 @@ public:
 	*/
 	JobStatus runJob() override;
 
+	/** Returns the affinity of the loaded sound so that all reads from the same file are executed by the same worker. */
+	int64 getWorkerAffinity() const noexcept override;
+
+	/** Tells the OS to fetch the data that will be read on the next run. */
+	void prefetch() override;
+
+	/** Sets the speed at which the voice consumes the samples of the sound (in samples per second).
+	*
+	*	This is used to calculate the deadline of the next read operation (it's basically the pitch ratio
+	*	multiplied with the playback sample rate).
+	*/
+	void setPlaybackSpeed(double newInputSamplesPerSecond) noexcept { inputSamplesPerSecond = newInputSamplesPerSecond; }
+
 	size_t getActualStreamingBufferSize() const;
 
 	void setStreamingBufferDataType(bool shouldBeFloat);
@@ -141,6 +154,14 @@ public:
 		nonRealtime = shouldBeNonRealtime;
 	}
 
+	/** Resizes the streaming buffers to the given size while the loader is in non-realtime mode.
+	
+		In non-realtime mode the data is read synchronously by the rendering thread, so bigger buffers
+		result in fewer (but longer) read operations. Pass in 0 to restore the previous buffer size.
+		The voice must not be playing when you call this.
+	*/
+	void setDirectStreamingBufferSize(int numSamples);
+
 	bool isNonRealtime() const { return nonRealtime; }
 	
 
@@ -175,6 +196,7 @@ private:
 #endif
 
 	bool nonRealtime = false;
+	int realtimeBufferSize = 0;
 
 	friend class Unmapper;
 
@@ -188,6 +210,9 @@ private:
 
 	bool requestNewData();
 
+	/** Calculates the time when the samples in the read buffer are consumed. */
+	void updateDeadline();
+
 	bool swapBuffers();
 
 	void fillInactiveBuffer();
@@ -211,6 +236,8 @@ private:
 
 	double lastSwapPosition = 0.0;
 
+	double inputSamplesPerSecond = 0.0;
+
 	Atomic<StreamingSamplerSound const *> sound;
 
 	int readIndex;
@@ -296,6 +323,7 @@ public:
 	void setDynamicPitchFactor(double pitchMultiplier)
 	{
 		uptimeDelta = constUptimeDelta * pitchMultiplier;
+		loader.setPlaybackSpeed(uptimeDelta * getSampleRate());
 	}
 
 	/** You have to call this before startNote() to calculate the pitch factor.
@@ -135,6 +135,7 @@ SlotSender::SlotSender(Source& s, uint8 index_, const HashedCharPtr& id_):
 	id(id_),
 	obj(s),
 	listeners(s.getRootObject(), 128),
+	pending(false),
 	numSlots(0),
 	flowManager(s.getRootObject(), s.getDispatchId(), id_)
 {
@@ -169,6 +170,10 @@ bool SlotSender::flush(DispatchType n)
 		doneSomething |= flush(DispatchType::sendNotificationAsyncHiPriority);
 	}
 
+	// reset this before the flush so that a change during the flush will add it again
+	if(n != DispatchType::sendNotificationSync)
+		pending.get(n).store(false);
+
 	auto& thisBitmap = data.get(n);
 
 	if(thisBitmap.isEmpty())
@@ -268,6 +273,17 @@ bool SlotSender::flush(DispatchType n)
 	return doneSomething;
 }
 
+bool SlotSender::flushPending(DispatchType n)
+{
+	flush(n);
+
+	if(data.get(n).isEmpty())
+		return true;
+
+	pending.get(n).store(true);
+	return false;
+}
+
 bool SlotSender::sendChangeMessage(uint8 indexInSlot, DispatchType n)
 {
 	if(!isPositiveAndBelow(indexInSlot, numSlots))
@@ -282,16 +298,25 @@ bool SlotSender::sendChangeMessage(uint8 indexInSlot, DispatchType n)
 		if(sn == DispatchType::sendNotificationSync)
 			obj.getParentSourceManager().bumpMessageCounter(false);
 
-		if(d[indexInSlot])
-			return;
+		if(!d[indexInSlot])
+		{
+			if(sn == DispatchType::sendNotificationSync)
+				obj.getParentSourceManager().bumpMessageCounter(true);
 
-		if(sn == DispatchType::sendNotificationSync)
-			obj.getParentSourceManager().bumpMessageCounter(true);
+			d.setBit(indexInSlot, true);
 
-		d.setBit(indexInSlot, true);
+			if(!listeners.get(sn).isEmpty())
+				flowManager.openFlow(sn, indexInSlot);
+		}
+
+		// Add this sender to the pending list of the source manager (once until it's flushed)
+		if(sn != DispatchType::sendNotificationSync && !pending.get(sn).exchange(true))
+		{
+			auto& sm = obj.getParentSourceManager();
 
-		if(!listeners.get(sn).isEmpty())
-			flowManager.openFlow(sn, indexInSlot);
+			if(sm.isUsingFastPath())
+				sm.addPendingSlotSender(obj, *this, sn);
+		}
 	});
 
 	// If the message wasn't explicitely sent as sendNotificationAsync, it will flush the sync changes immediately
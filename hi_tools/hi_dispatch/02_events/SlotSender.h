@@ -121,6 +121,10 @@ public:
 	bool flush(DispatchType n=sendNotification);
 	bool sendChangeMessage(uint8 indexInSlot, DispatchType notify);
 
+	// Flushes the changes of the given dispatch type and returns false if the changes couldn't be
+	// sent because the listener queue is suspended.
+	bool flushPending(DispatchType n);
+
 	bool matchesPath(const HashedPath& p, DispatchType n) const
 	{
 		if(p.slot == id)
@@ -160,6 +164,9 @@ private:
 	DispatchTypeContainer<SlotBitmap> data;
 	DispatchTypeContainer<ListenerQueue> listeners;
 
+	// true if the slot sender was added to the pending list of the source manager
+	DispatchTypeContainer<std::atomic<bool>> pending;
+
 	size_t numSlots;
 	
 	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SlotSender);
@@ -77,6 +77,8 @@ public:
 
 	void flushChanges(DispatchType n);
 
+	bool isRunning() const noexcept { return currentState == State::Running; }
+
 	virtual int getNumSlotSenders() const = 0;
 
 	virtual SlotSender* getSlotSender(uint8 slotSenderIndex) = 0;
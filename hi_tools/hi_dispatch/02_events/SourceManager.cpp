@@ -40,7 +40,8 @@ using namespace juce;
 SourceManager::SourceManager(RootObject& r, const HashedCharPtr& typeId):
   Suspendable(r, nullptr),
   SimpleTimer(r.getUpdater()),
-  treeId(typeId)
+  treeId(typeId),
+  pendingLists(PendingQueueSize)
 {
 	messageCounterId << typeId << "messages";
 	skippedCounterId << "skipped " << typeId << "messages";
@@ -61,6 +62,7 @@ void SourceManager::resetMessageCounter()
 {
 	messageCounter = 0;
 	skippedCounter = 0;
+	numFlushedSlotSenders = 0;
 
 	TRACE_COUNTER("dispatch", perfetto::CounterTrack(messageCounterId.get()), 0);
 	TRACE_COUNTER("dispatch", perfetto::CounterTrack(skippedCounterId.get()), 0);
@@ -85,6 +87,43 @@ void SourceManager::removeSource(Source* s)
 {
 	ScopedWriteLock sl(sourceLock);
 	sources.removeFirstMatchingValue(s);
+
+	// Remove all pending slot senders of the source (they are already destroyed at this point)
+	pendingLists.forEach([s](PendingList& l)
+	{
+		SpinLock::ScopedLockType cl(l.consumerLock);
+
+		PendingSlot ps;
+
+		while(l.queue.pop(ps))
+			l.deferred.add(ps);
+
+		for(int i = 0; i < l.deferred.size(); i++)
+		{
+			if(l.deferred.getReference(i).source == s)
+				l.deferred.remove(i--);
+		}
+	});
+}
+
+void SourceManager::addPendingSlotSender(Source& s, SlotSender& sender, DispatchType n)
+{
+	auto& l = pendingLists.get(n);
+
+	if(!l.queue.push({ &s, &sender }))
+		l.overflow = true;
+}
+
+void SourceManager::setUseFastPath(bool shouldUseFastPath)
+{
+	if(useFastPath != shouldUseFastPath)
+	{
+		useFastPath = shouldUseFastPath;
+
+		// The senders might have been changed without being added to the queue,
+		// so the next flush needs to check all sources.
+		pendingLists.forEach([](PendingList& l) { l.overflow = true; });
+	}
 }
 
 void SourceManager::setState(const HashedPath& p, State newState)
@@ -104,11 +143,71 @@ void SourceManager::flush(DispatchType n)
 	{
 		//TRACE_FLUSH(getDispatchId());
 
-		forEachSource<Behaviour::BreakIfPaused>([n](Source& s)
+		if(useFastPath && n != DispatchType::sendNotificationSync)
+			flushPendingSlotSenders(n);
+		else
+			flushAllSources(n);
+	}
+}
+
+void SourceManager::flushAllSources(DispatchType n)
+{
+	forEachSource<Behaviour::BreakIfPaused>([n, this](Source& s)
+	{
+		s.flushChanges(n);
+		numFlushedSlotSenders += s.getNumSlotSenders();
+	});
+}
+
+void SourceManager::flushPendingSlotSenders(DispatchType n)
+{
+	auto& l = pendingLists.get(n);
+
+	// the high priority queue might be flushed by the timer and the high priority thread,
+	// so if it's already flushing, we can skip it
+	SpinLock::ScopedTryLockType cl(l.consumerLock);
+
+	if(!cl.isLocked())
+		return;
+
+	ScopedReadLock sl(sourceLock);
+
+	if(l.overflow.exchange(false))
+	{
+		// The queue was full, so we need to check all sources
+		// (the remaining items in the queue will be skipped because they are not pending anymore)
+		for(auto s: sources)
 		{
-			s.flushChanges(n);
-		});
+			if(currentState != State::Running)
+				break;
+
+			s->flushChanges(n);
+			numFlushedSlotSenders += s->getNumSlotSenders();
+		}
+	}
+
+	auto flushSingle = [&](const PendingSlot& ps)
+	{
+		if(!ps.source->isRunning() || !ps.sender->flushPending(n))
+			l.deferred.addIfNotAlreadyThere(ps);
+
+		numFlushedSlotSenders++;
+	};
+
+	// try the suspended ones first
+	if(!l.deferred.isEmpty())
+	{
+		Array<PendingSlot> suspended;
+		suspended.swapWith(l.deferred);
+
+		for(const auto& ps: suspended)
+			flushSingle(ps);
 	}
+
+	PendingSlot ps;
+
+	while(l.queue.pop(ps))
+		flushSingle(ps);
 }
 } // dispatch
 } // hise
\ No newline at end of file
@@ -37,6 +37,7 @@ namespace dispatch {
 using namespace juce;
 
 class Source;
+class SlotSender;
 
 class SourceManager  : public Suspendable,
 					    public PooledUIUpdater::SimpleTimer
@@ -96,10 +97,63 @@ public:
 
 	void flush(DispatchType n);
 
+	// Adds the slot sender to the list of senders that need to be flushed with the given dispatch type.
+	// This is called by SlotSender::sendChangeMessage() and is lock-free, so you can call it from the audio thread.
+	// Any thread can change a slot sender, so there are multiple producers, but only one consumer
+	// (the thread that flushes the queue).
+	void addPendingSlotSender(Source& s, SlotSender& sender, DispatchType n);
+
+	// Enables the fast path for asynchronous notifications (enabled by default). If this is disabled,
+	// the flush will iterate over all sources and check every slot sender for pending changes.
+	void setUseFastPath(bool shouldUseFastPath);
+
+	bool isUsingFastPath() const noexcept { return useFastPath; }
+
+	// The amount of slot senders that were flushed since the last call to resetMessageCounter()
+	int getNumFlushedSlotSenders() const noexcept { return numFlushedSlotSenders; }
+
 private:
 
+	static constexpr int PendingQueueSize = 2048;
+
+	struct PendingSlot
+	{
+		bool operator==(const PendingSlot& other) const { return sender == other.sender; }
+
+		Source* source = nullptr;
+		SlotSender* sender = nullptr;
+	};
+
+	// A lock free multi-producer queue of all slot senders with pending changes.
+	// The sender will only be added once until it is flushed so the changes
+	// of a slot will coalesce into the slot bitmap.
+	struct PendingList
+	{
+		PendingList(int numElements):
+		  queue(numElements)
+		{};
+
+		MultithreadedLockfreeQueue<PendingSlot, MultithreadedQueueHelpers::Configuration::NoAllocationsTokenlessUsageAllowed> queue;
+
+		// the senders that couldn't be flushed because they are suspended
+		Array<PendingSlot> deferred;
+
+		// only one thread can consume the queue
+		SpinLock consumerLock;
+
+		std::atomic<bool> overflow = { false };
+	};
+
+	void flushAllSources(DispatchType n);
+	void flushPendingSlotSenders(DispatchType n);
+
 	State currentState = State::Running;
 
+	bool useFastPath = true;
+	int numFlushedSlotSenders = 0;
+
+	DispatchTypeContainer<PendingList> pendingLists;
+
 	int messageCounter = 0;
 	int skippedCounter = 0;
 
@@ -425,6 +425,164 @@ void LoggerTest::testSourceManager()
 
 static LoggerTest loggerTest;
 
+void LoggerTest::testSourceManagerFastPath()
+{
+	RootObject root(nullptr);
+	SourceManager sm(root, IDs::source::automation);
+
+	struct MySource: public Source
+	{
+		MySource(SourceManager& sm, LoggerTest& l, int index):
+		  Source(sm, l, HashedCharPtr("source" + String(index))),
+		  slot(*this, 0, "slot")
+		{
+			slot.setNumSlots(8);
+		};
+
+		~MySource()
+		{
+			slot.shutdown();
+			clearFromRoot();
+		}
+
+		int getNumSlotSenders() const override { return 1; }
+		SlotSender* getSlotSender(uint8 slotSenderIndex) override { return &slot; }
+
+		SlotSender slot;
+	};
+
+	struct MyListener: public Listener
+	{
+		MyListener(RootObject& r, ListenerOwner& owner):
+		  Listener(r, owner)
+		{}
+
+		void slotChanged(const ListenerData& d) override
+		{
+			numCalls++;
+
+			for(int i = 0; i < 8; i++)
+				numChanges += (int)d.changes[i];
+		}
+
+		int numCalls = 0;
+		int numChanges = 0;
+	};
+
+	constexpr int NumSources = 512;
+	constexpr int NumIterations = 200;
+	constexpr int NumEventsPerIteration = 1000;
+	constexpr int NumDirtySources = 16;
+
+	OwnedArray<MySource> sources;
+
+	for(int i = 0; i < NumSources; i++)
+		sources.add(new MySource(sm, *this, i));
+
+	MyListener l(root, *this);
+	l.addListenerToAllSources(sm, sendNotificationAsync);
+
+	for(auto useFastPath: { false, true })
+	{
+		beginTest(String("test source manager ") + (useFastPath ? "with" : "without") + " fast path");
+
+		sm.setUseFastPath(useFastPath);
+		sm.flush(sendNotificationAsync);
+
+		l.numCalls = 0;
+		l.numChanges = 0;
+
+		double sendTime = 0.0;
+		double flushTime = 0.0;
+		double maxFlushTime = 0.0;
+
+		for(int i = 0; i < NumIterations; i++)
+		{
+			auto before = Time::getMillisecondCounterHiRes();
+
+			// simulate an automation of a few parameters with many repeated writes
+			for(int j = 0; j < NumEventsPerIteration; j++)
+			{
+				auto s = sources[(i * 7 + j % NumDirtySources * 31) % NumSources];
+				s->slot.sendChangeMessage((uint8)((j / NumDirtySources) % 4), sendNotificationAsync);
+			}
+
+			auto afterSend = Time::getMillisecondCounterHiRes();
+
+			sm.flush(sendNotificationAsync);
+
+			auto afterFlush = Time::getMillisecondCounterHiRes();
+
+			sendTime += afterSend - before;
+			flushTime += afterFlush - afterSend;
+			maxFlushTime = jmax(maxFlushTime, afterFlush - afterSend);
+		}
+
+		expectEquals(l.numCalls, NumIterations * NumDirtySources, "repeated changes didn't coalesce");
+		expectEquals(l.numChanges, NumIterations * NumDirtySources * 4, "missing slot changes");
+
+		auto numEvents = (double)(NumIterations * NumEventsPerIteration);
+
+		String m;
+		m << "events/s: " << String(numEvents / jmax(0.001, sendTime) * 1000.0, 0);
+		m << ", avg flush latency: " << String(flushTime / (double)NumIterations * 1000.0, 2) << "us";
+		m << ", max flush latency: " << String(maxFlushTime * 1000.0, 2) << "us";
+		logMessage(m);
+	}
+
+	beginTest("test source manager with multiple producer threads");
+
+	struct Producer: public Thread
+	{
+		Producer(OwnedArray<MySource>& s, int offset_, int numSources_):
+		  Thread("producer"),
+		  sources(s),
+		  offset(offset_),
+		  numSources(numSources_)
+		{}
+
+		void run() override
+		{
+			for(int i = 0; i < 100; i++)
+			{
+				for(int j = 0; j < numSources; j++)
+					sources[offset + j]->slot.sendChangeMessage((uint8)(i % 4), sendNotificationAsync);
+			}
+		}
+
+		OwnedArray<MySource>& sources;
+		const int offset;
+		const int numSources;
+	};
+
+	constexpr int NumProducers = 4;
+	constexpr int NumSourcesPerProducer = NumSources / NumProducers;
+
+	sm.setUseFastPath(true);
+	sm.flush(sendNotificationAsync);
+
+	l.numCalls = 0;
+	l.numChanges = 0;
+
+	{
+		OwnedArray<Producer> producers;
+
+		for(int i = 0; i < NumProducers; i++)
+			producers.add(new Producer(sources, i * NumSourcesPerProducer, NumSourcesPerProducer))->startThread();
+
+		for(auto p: producers)
+			p->waitForThreadToExit(5000);
+	}
+
+	sm.flush(sendNotificationAsync);
+
+	expectEquals(l.numCalls, NumSources, "missing senders from the producer threads");
+	expectEquals(l.numChanges, NumSources * 4, "missing slot changes from the producer threads");
+
+	for(auto s: sources)
+		l.removeListener(*s);
+}
+
 void LoggerTest::runTest()
 {
 	TRACE_DISPATCH("logger test");
@@ -432,6 +590,7 @@ void LoggerTest::runTest()
 	testLogger();
     testQueueResume();
 	testSourceManager();
+	testSourceManagerFastPath();
 }
 
 CharPtrTest::CharPtrTest():
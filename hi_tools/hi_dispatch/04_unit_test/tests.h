@@ -74,6 +74,7 @@ struct LoggerTest: public UnitTest,
 	void testQueue();
 	void testQueueResume();
 	void testSourceManager();
+	void testSourceManagerFastPath();
 
 	void runTest() override;
 };
@@ -170,6 +170,14 @@ public:
 		print("");
 		print("run_unit_tests");
 		print("Runs the unit tests. In order for this to work, HISE must be built with the CI configuration");
+		print("");
+		print("benchmark -p:PATH -m:MIDIFILE [-sr:SAMPLERATE] [-bs:BLOCKSIZE] [-o:OUTPUT] [-parallel] [-dsb:BUFFERSIZE]");
+		print("Loads the project file and renders the MIDI file offline through the master chain.");
+		print("Prints the total and per-module CPU usage, the peak voice count, the streaming throughput");
+		print("and the render speed factor as JSON. Use -o to write the JSON to a file.");
+		print("Use -parallel to render the sound generators of all containers on the audio worker threads");
+		print("(HISE must be built with HISE_NUM_AUDIO_WORKER_THREADS > 0) and -dsb to read the samples");
+		print("directly on the rendering thread with the given streaming buffer size.");
 
 		exit(0);
 	}
@@ -362,6 +370,271 @@ public:
 		exporter.threadFinished();
 	}
 
+	/** Renders the event list offline as fast as possible and measures the time of each rendered block. 
+	
+		The streaming throughput is measured between the end of the first and the last rendered block
+		using the wall-clock time (so it includes the time where the audio thread waits for the streaming
+		threads).
+	*/
+	struct BenchmarkRenderer : public AudioRendererBase
+	{
+		BenchmarkRenderer(MainController* mc, const HiseEventBuffer& events, bool shouldRenderInParallel, int directStreamingBufferSize_) :
+			AudioRendererBase(mc)
+		{
+			renderInParallel = shouldRenderInParallel;
+			directStreamingBufferSize = directStreamingBufferSize_;
+
+			eventBuffers.add(new HiseEventBuffer());
+
+			for (const auto& e : events)
+			{
+				if (eventBuffers.getLast()->getNumUsed() == HISE_EVENT_BUFFER_SIZE - 1)
+					eventBuffers.add(new HiseEventBuffer());
+
+				eventBuffers.getLast()->addEvent(e);
+			}
+
+			sampleRate = mc->getMainSynthChain()->getSampleRate();
+
+			// Don't pause the rendering after the progress callbacks
+			throttleRendering = false;
+
+			initAfterFillingEventBuffer();
+		}
+
+		void callUpdateCallback(bool isFinished, double /*progress*/) override
+		{
+			if (isFinished)
+				finished = true;
+		}
+
+		void blockRendered(int numSamples, double renderSeconds) override
+		{
+			auto pool = getMainController()->getSampleManager().getGlobalSampleThreadPool();
+			auto now = Time::getHighResolutionTicks();
+
+			if (numRendered == 0)
+			{
+				firstBlockTicks = now;
+				startFrames = pool->getNumStreamedFrames();
+				startBytes = pool->getNumStreamedBytes();
+			}
+
+			lastBlockTicks = now;
+			endFrames = pool->getNumStreamedFrames();
+			endBytes = pool->getNumStreamedBytes();
+
+			renderTime += renderSeconds;
+			maxBlockRatio = jmax(maxBlockRatio, renderSeconds * sampleRate / (double)numSamples);
+			numRendered += numSamples;
+			peakVoices = jmax(peakVoices, getMainController()->getNumActiveVoices());
+		}
+
+		var waitForResult()
+		{
+			while (isThreadRunning())
+				Thread::sleep(20);
+
+			if (!finished || numRendered == 0)
+				return var();
+
+			auto audioSeconds = (double)numRendered / sampleRate;
+			auto wallClockSeconds = Time::highResolutionTicksToSeconds(lastBlockTicks - firstBlockTicks);
+			auto streamedBytes = endBytes - startBytes;
+
+			DynamicObject::Ptr obj = new DynamicObject();
+			obj->setProperty("audioSeconds", audioSeconds);
+			obj->setProperty("renderSeconds", renderTime);
+			obj->setProperty("speedFactor", renderTime > 0.0 ? audioSeconds / renderTime : 0.0);
+			obj->setProperty("cpuPercent", 100.0 * renderTime / audioSeconds);
+			obj->setProperty("maxBlockCpuPercent", 100.0 * maxBlockRatio);
+			obj->setProperty("peakVoices", peakVoices);
+			obj->setProperty("streamedFrames", endFrames - startFrames);
+			obj->setProperty("streamedMB", (double)streamedBytes / (1024.0 * 1024.0));
+			obj->setProperty("wallClockSeconds", wallClockSeconds);
+			obj->setProperty("streamingMBPerSecond", wallClockSeconds > 0.0 ? (double)streamedBytes / (1024.0 * 1024.0) / wallClockSeconds : 0.0);
+
+			return var(obj.get());
+		}
+
+		double sampleRate = 44100.0;
+		double renderTime = 0.0;
+		double maxBlockRatio = 0.0;
+		int64 numRendered = 0;
+		int64 firstBlockTicks = 0;
+		int64 lastBlockTicks = 0;
+		int64 startFrames = 0;
+		int64 endFrames = 0;
+		int64 startBytes = 0;
+		int64 endBytes = 0;
+		int peakVoices = 0;
+		std::atomic<bool> finished = { false };
+	};
+
+	static HiseEventBuffer createEventsFromMidiFile(const File& midiFile, double sampleRate)
+	{
+		FileInputStream fis(midiFile);
+		MidiFile mf;
+
+		if (!fis.openedOk() || !mf.readFrom(fis))
+			throwErrorAndQuit("Can't read MIDI file " + midiFile.getFullPathName());
+
+		mf.convertTimestampTicksToSeconds();
+
+		MidiMessageSequence allTracks;
+
+		for (int i = 0; i < mf.getNumTracks(); i++)
+			allTracks.addSequence(*mf.getTrack(i), 0.0);
+
+		allTracks.sort();
+
+		HiseEventBuffer events;
+		int lastTimestamp = 0;
+
+		for (auto e : allTracks)
+		{
+			HiseEvent he(e->message);
+
+			if (he.isEmpty())
+				continue;
+
+			lastTimestamp = roundToInt(e->message.getTimeStamp() * sampleRate);
+			he.setTimeStamp(lastTimestamp);
+			events.addEvent(he);
+		}
+
+		if (events.isEmpty())
+			throwErrorAndQuit("The MIDI file " + midiFile.getFullPathName() + " doesn't contain any events");
+
+		// Add two seconds for the release tails. The last event defines the render length
+		HiseEvent endMarker(HiseEvent::Type::MidiStop, 0, 0, 1);
+		endMarker.setTimeStamp(lastTimestamp + roundToInt(2.0 * sampleRate));
+		events.addEvent(endMarker);
+
+		return events;
+	}
+
+	static void runBenchmark(const String& commandLine)
+	{
+		auto args = getCommandLineArgs(commandLine);
+
+		auto midiPath = getArgument(args, "-m:");
+		auto outputPath = getArgument(args, "-o:");
+		auto sampleRate = getArgument(args, "-sr:").getDoubleValue();
+		auto blockSize = getArgument(args, "-bs:").getIntValue();
+		auto renderInParallel = args.contains("-parallel");
+		auto directStreamingBufferSize = jmax(0, getArgument(args, "-dsb:").getIntValue());
+
+		if (sampleRate <= 0.0)
+			sampleRate = 44100.0;
+
+		if (blockSize <= 0)
+			blockSize = 512;
+
+		if (midiPath.isEmpty())
+			throwErrorAndQuit("You need to specify a MIDI file with the -m: argument");
+
+		var result;
+
+		auto ok = loadPresetFile(commandLine, [&](BackendProcessor* bp)
+		{
+			auto root = bp->getActiveFileHandler()->getRootFolder();
+
+			File midiFile = File::isAbsolutePath(midiPath) ? File(midiPath) : root.getChildFile(midiPath);
+
+			if (!midiFile.existsAsFile())
+				midiFile = root.getChildFile("MidiFiles").getChildFile(midiPath);
+
+			if (!midiFile.existsAsFile())
+				return Result::fail("Can't find the MIDI file " + midiPath);
+
+			dynamic_cast<AudioProcessor*>(bp)->prepareToPlay(sampleRate, blockSize);
+
+			while (bp->getSampleManager().isPreloading())
+				Thread::sleep(50);
+
+			auto events = createEventsFromMidiFile(midiFile, sampleRate);
+
+			if (renderInParallel && bp->getRealtimeWorkerPool() == nullptr)
+				print("Warning: HISE was built without audio worker threads, so -parallel has no effect");
+
+			auto render = [&]()
+			{
+				BenchmarkRenderer r(bp, events, renderInParallel, directStreamingBufferSize);
+				return r.waitForResult();
+			};
+
+			print("Rendering " + midiFile.getFileName() + "...");
+
+			result = render();
+
+			if (!result.isObject())
+				return Result::fail("Rendering failed");
+
+			result.getDynamicObject()->setProperty("project", getArgument(args, "-p:"));
+			result.getDynamicObject()->setProperty("midiFile", midiFile.getFullPathName());
+			result.getDynamicObject()->setProperty("sampleRate", sampleRate);
+			result.getDynamicObject()->setProperty("blockSize", blockSize);
+			result.getDynamicObject()->setProperty("parallel", renderInParallel && bp->getRealtimeWorkerPool() != nullptr);
+			result.getDynamicObject()->setProperty("directStreamingBufferSize", directStreamingBufferSize);
+
+			// Render the MIDI file again for each sound generator of the master chain with all
+			// other sound generators bypassed to get the per-module CPU usage
+			auto handler = bp->getMainSynthChain()->getHandler();
+
+			Array<bool> bypassStates;
+
+			for (int i = 0; i < handler->getNumProcessors(); i++)
+				bypassStates.add(handler->getProcessor(i)->isBypassed());
+
+			Array<var> modules;
+
+			for (int i = 0; i < handler->getNumProcessors(); i++)
+			{
+				auto p = handler->getProcessor(i);
+
+				if (bypassStates[i])
+					continue;
+
+				for (int j = 0; j < handler->getNumProcessors(); j++)
+					handler->getProcessor(j)->setBypassed(j != i || bypassStates[j]);
+
+				print("Rendering " + p->getId() + "...");
+
+				auto moduleResult = render();
+
+				if (auto obj = moduleResult.getDynamicObject())
+				{
+					obj->setProperty("id", p->getId());
+					obj->setProperty("type", p->getType().toString());
+					modules.add(moduleResult);
+				}
+			}
+
+			for (int i = 0; i < handler->getNumProcessors(); i++)
+				handler->getProcessor(i)->setBypassed(bypassStates[i]);
+
+			result.getDynamicObject()->setProperty("modules", var(modules));
+
+			return Result::ok();
+		});
+
+		if (ok != 0)
+			return;
+
+		auto json = JSON::toString(result);
+
+		if (outputPath.isNotEmpty())
+		{
+			File outputFile = File::isAbsolutePath(outputPath) ? File(outputPath) : File::getCurrentWorkingDirectory().getChildFile(outputPath);
+			
+			if (!outputFile.replaceWithText(json))
+				throwErrorAndQuit("Can't write to " + outputFile.getFullPathName());
+		}
+
+		print(json);
+	}
+
 	static void setProjectFolder(const String& commandLine, bool exitOnSuccess=true)
 	{
 		auto args = getCommandLineArgs(commandLine);
@@ -733,6 +1006,13 @@ public:
 			quit();
 			return;
 		}
+		else if (commandLine.startsWith("benchmark"))
+		{
+			CommandLineActions::runBenchmark(commandLine);
+
+			quit();
+			return;
+		}
 		else
 		{
 			mainWindow = new MainWindow(commandLine);
@@ -921,6 +921,12 @@ public:
 		testDualWrite(1);
 		testDualWrite(2);
 
+		testParallelEncoding(1);
+		testParallelEncoding(2);
+
+		testParallelEncodingIsBitIdentical(1);
+		testParallelEncodingIsBitIdentical(2);
+
 		testPadding(1);
         testPadding(2);
 	
@@ -1048,6 +1054,7 @@ public:
 		currentOption.normalisationMode = 2;
 
 		writer->setOptions(currentOption);
+		writer->setNumEncoderThreads(numEncoderThreads);
 		
 		expect(writer != nullptr);
 
@@ -1182,6 +1189,116 @@ public:
 
 	}
 
+	void testParallelEncoding(int numChannels)
+	{
+		beginTest("Testing parallel encoding with " + String(numChannels) + " channels");
+
+		Array<AudioSampleBuffer> buffers;
+
+		buffers.add(createTestBuffer(numChannels, 200000));
+
+		numEncoderThreads = 1;
+		auto mbSingle = writeIntoMemory(buffers);
+		const double start = Time::getMillisecondCounterHiRes();
+
+		numEncoderThreads = 4;
+		auto mbParallel = writeIntoMemory(buffers);
+		const double delta = Time::getMillisecondCounterHiRes() - start;
+
+		numEncoderThreads = 1;
+
+		logMessage("Parallel encoding time: " + String(delta, 2) + " ms");
+
+		expectEquals<int>((int)mbParallel.getSize(), (int)mbSingle.getSize(), "Size mismatch");
+
+		auto single = readIntoAudioBuffer(mbSingle, false);
+		auto parallel = readIntoAudioBuffer(mbParallel, false);
+
+		int error = (int)CompressionHelpers::checkBuffersEqual(parallel, single);
+
+		expectEquals<int>(error, 0, "buffers equal");
+	}
+
+	/** Writes the buffer in chunks of the given size with the static normalisation mode (like the monolith exporter). */
+	MemoryBlock writeInChunks(AudioSampleBuffer& b, int chunkSize, int numThreads)
+	{
+		HiseLosslessAudioFormat hlac;
+
+		MemoryOutputStream* mos = new MemoryOutputStream();
+
+		StringPairArray empty;
+
+		ScopedPointer<HiseLosslessAudioFormatWriter> writer = dynamic_cast<HiseLosslessAudioFormatWriter*>(hlac.createWriterFor(mos, 44100.0, b.getNumChannels(), 0, empty, 0));
+
+		expect(writer != nullptr);
+
+		auto options = currentOption;
+		options.normalisationMode = CompressionHelpers::NormaliseMap::StaticNormalisation;
+
+		writer->setOptions(options);
+		writer->setNumEncoderThreads(numThreads);
+
+		for (int pos = 0; pos < b.getNumSamples(); pos += chunkSize)
+			writer->writeFromAudioSampleBuffer(b, pos, jmin(chunkSize, b.getNumSamples() - pos));
+
+		writer->flush();
+
+		MemoryBlock mb;
+
+		mb.setSize(mos->getDataSize());
+		mb.copyFrom(mos->getData(), 0, mos->getDataSize());
+
+		return mb;
+	}
+
+	void testParallelEncodingIsBitIdentical(int numChannels)
+	{
+		beginTest("Testing bit identical parallel encoding with static normalisation and " + String(numChannels) + " channels");
+
+		auto b = createTestBuffer(numChannels, 200000);
+
+		// The serial encoder gets the chunks of AudioFormatWriter::writeFromAudioReader(), the parallel one the chunks of the monolith exporter
+		auto mbSingle = writeInChunks(b, 16384, 1);
+		auto mbParallel = writeInChunks(b, COMPRESSION_BLOCK_SIZE * 64, 4);
+
+		expectEquals<int>((int)mbParallel.getSize(), (int)mbSingle.getSize(), "Size mismatch");
+
+		if (mbParallel.getSize() != mbSingle.getSize())
+			return;
+
+		auto single = static_cast<const uint8*>(mbSingle.getData());
+		auto parallel = static_cast<const uint8*>(mbParallel.getData());
+		const int numBytes = (int)mbSingle.getSize();
+
+		for (int i = 0; i < numBytes; i++)
+		{
+			if (single[i] == parallel[i])
+				continue;
+
+			// The only bytes that may differ are the random checksum words, so find the valid checksum that covers this byte
+			bool isChecksum = false;
+
+			for (int start = jmax(0, i - 3); start <= i && start + 4 <= numBytes; start++)
+			{
+				auto c1 = ByteOrder::littleEndianInt(single + start);
+				auto c2 = ByteOrder::littleEndianInt(parallel + start);
+
+				if (CompressionHelpers::Misc::validateChecksum(c1) && CompressionHelpers::Misc::validateChecksum(c2))
+				{
+					isChecksum = true;
+					i = start + 3;
+					break;
+				}
+			}
+
+			if (!isChecksum)
+			{
+				expect(false, "Byte mismatch at " + String(i));
+				break;
+			}
+		}
+	}
+
 	void testHiseSampleBufferReadWithOffset()
 	{
 		beginTest("Test decoding into buffer with offset");
@@ -2016,6 +2133,7 @@ public:
 	}
 
 	HlacEncoder::CompressorOptions currentOption;
+	int numEncoderThreads = 1;
 private:
 
 	
@@ -2024,3 +2142,206 @@ private:
 };
 
 static FormatTest formatTest; 
+
+class SIMDKernelTest : public UnitTest
+{
+public:
+
+	using InstructionSet = SIMDKernels::InstructionSet;
+
+	SIMDKernelTest() :
+		UnitTest("Testing HLAC SIMD kernels")
+	{}
+
+	void runTest() override
+	{
+		auto previous = SIMDKernels::getInstructionSet();
+
+		logMessage("Best instruction set: " + SIMDKernels::getName(SIMDKernels::getBestInstructionSet()));
+
+		BitCompressors::FourBit fourBit;
+		BitCompressors::SixBit sixBit;
+		BitCompressors::EightBit eightBit;
+		BitCompressors::TenBit tenBit;
+		BitCompressors::TwelveBit twelveBit;
+		BitCompressors::FourteenBit fourteenBit;
+
+		for (int i = 1; i < (int)InstructionSet::numInstructionSets; i++)
+		{
+			auto s = (InstructionSet)i;
+
+			if (!SIMDKernels::isAvailable(s))
+				continue;
+
+			testDecompression(&fourBit, s);
+			testDecompression(&sixBit, s);
+			testDecompression(&eightBit, s);
+			testDecompression(&tenBit, s);
+			testDecompression(&twelveBit, s);
+			testDecompression(&fourteenBit, s);
+			testUnsupportedGroupLayout(s);
+
+			testVectorOperations(s);
+		}
+
+		SIMDKernels::setInstructionSet(previous);
+	}
+
+private:
+
+	void fillWithBitDepth(int16* data, int numValues, int bitDepth)
+	{
+		const int max = (1 << (bitDepth - 1)) - 1;
+
+		for (int i = 0; i < numValues; i++)
+			data[i] = (int16)r.nextInt(Range<int>(-max, max + 1));
+	}
+
+	double measure(BitCompressors::Base* c, int16* destination, const uint8* data, int numValues, InstructionSet s)
+	{
+		SIMDKernels::setInstructionSet(s);
+
+		const double start = Time::getMillisecondCounterHiRes();
+
+		for (int i = 0; i < NumIterations; i++)
+			c->decompress(destination, data, numValues);
+
+		return Time::getMillisecondCounterHiRes() - start;
+	}
+
+	void testDecompression(BitCompressors::Base* c, InstructionSet s)
+	{
+		const int bitDepth = c->getAllowedBitRange();
+
+		beginTest("Testing " + String(bitDepth) + " bit decompression with " + SIMDKernels::getName(s));
+
+		// Use an odd size to check the remainder handling
+		const int numValues = COMPRESSION_BLOCK_SIZE + r.nextInt(31);
+
+		HeapBlock<int16> input(numValues, true);
+		HeapBlock<uint8> compressed(c->getByteAmount(numValues), true);
+		HeapBlock<int16, true> scalarOutput, simdOutput;
+
+		scalarOutput.allocate(numValues + 8, true);
+		simdOutput.allocate(numValues + 8, true);
+
+		fillWithBitDepth(input, numValues, bitDepth);
+		c->compress(compressed, input, numValues);
+
+		auto scalarTime = measure(c, scalarOutput, compressed, numValues, InstructionSet::Scalar);
+		auto simdTime = measure(c, simdOutput, compressed, numValues, s);
+
+		for (int i = 0; i < numValues; i++)
+		{
+			if (input[i] != simdOutput[i] || scalarOutput[i] != simdOutput[i])
+			{
+				expectEquals<int>(simdOutput[i], input[i], "Mismatch at " + String(i));
+				break;
+			}
+		}
+
+		logMessage("Speedup: " + String(scalarTime / jmax(0.001, simdTime), 2) + "x");
+	}
+
+	void testUnsupportedGroupLayout(InstructionSet s)
+	{
+		beginTest("Testing unsupported bit depth with " + SIMDKernels::getName(s));
+
+		SIMDKernels::setInstructionSet(s);
+
+		HeapBlock<uint8> data(64, true);
+		HeapBlock<int16> output(32, true);
+
+		// There is no group layout for these bit depths, so the scalar code must decode them
+		for (auto bitDepth : { 4, 8, 16 })
+			expectEquals(SIMDKernels::unpackGroups(output, data, 32, 64, bitDepth), 0, "unpacked " + String(bitDepth) + " bit values");
+	}
+
+	void testVectorOperations(InstructionSet s)
+	{
+		beginTest("Testing vector operations with " + SIMDKernels::getName(s));
+
+		const int numValues = 1000 + r.nextInt(31);
+
+		HeapBlock<int16> a(numValues), b(numValues), scalarSum(numValues), simdSum(numValues);
+		HeapBlock<float> scalarFloat(numValues), simdFloat(numValues);
+
+		fillWithBitDepth(a, numValues, 14);
+		fillWithBitDepth(b, numValues, 14);
+
+		memcpy(scalarSum, a, sizeof(int16) * numValues);
+		memcpy(simdSum, a, sizeof(int16) * numValues);
+
+		SIMDKernels::setInstructionSet(InstructionSet::Scalar);
+		CompressionHelpers::IntVectorOperations::add(scalarSum, b, numValues);
+		CompressionHelpers::fastInt16ToFloat(a, scalarFloat, numValues);
+
+		SIMDKernels::setInstructionSet(s);
+		CompressionHelpers::IntVectorOperations::add(simdSum, b, numValues);
+		CompressionHelpers::fastInt16ToFloat(a, simdFloat, numValues);
+
+		for (int i = 0; i < numValues; i++)
+		{
+			expectEquals<int>(simdSum[i], scalarSum[i], "add mismatch");
+			expect(simdFloat[i] == scalarFloat[i], "conversion mismatch at " + String(i));
+
+			if (simdSum[i] != scalarSum[i] || simdFloat[i] != scalarFloat[i])
+				break;
+		}
+
+		for (uint8 amount = 0; amount < 8; amount++)
+			testNormalisedConversion(s, amount);
+	}
+
+	void testNormalisedConversion(InstructionSet s, uint8 amount)
+	{
+		// Use an odd size and offset to check the remainder handling at the normalisation block boundaries
+		const int numValues = COMPRESSION_BLOCK_SIZE + r.nextInt(31);
+		const int offset = r.nextInt(8);
+
+		CompressionHelpers::NormaliseMap map;
+		map.setMode(CompressionHelpers::NormaliseMap::StaticNormalisation);
+		map.setUseStaticNormalisation(amount);
+
+		HeapBlock<int16> input(numValues);
+		HeapBlock<float> scalarFloat(numValues), simdFloat(numValues);
+
+		fillWithBitDepth(input, numValues, 16);
+
+		SIMDKernels::setInstructionSet(InstructionSet::Scalar);
+		map.normalisedInt16ToFloat(scalarFloat, input, offset, numValues - offset);
+
+		SIMDKernels::setInstructionSet(s);
+		map.normalisedInt16ToFloat(simdFloat, input, offset, numValues - offset);
+
+		for (int i = 0; i < numValues - offset; i++)
+		{
+			if (simdFloat[i] != scalarFloat[i])
+			{
+				expect(false, "normalised conversion mismatch at " + String(i) + " with gain " + String(1 << amount));
+				break;
+			}
+		}
+
+		if (amount == 0)
+			return;
+
+		// The scalar path must still divide like the decoder of the previous versions
+		const float divisor = (float)INT16_MAX * (float)(1 << amount);
+
+		for (int i = 0; i < numValues - offset; i++)
+		{
+			if (scalarFloat[i] != (float)input[i] / divisor)
+			{
+				expect(false, "normalised conversion changed at " + String(i) + " with gain " + String(1 << amount));
+				break;
+			}
+		}
+	}
+
+	static constexpr int NumIterations = 1000;
+
+	Random r;
+};
+
+static SIMDKernelTest simdKernelTest;